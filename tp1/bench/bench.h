@@ -0,0 +1,105 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef BENCH_H
+#define BENCH_H
+
+/** \brief Funciones comunes de los programas de medicion
+ **
+ ** Cada fichero de bench/ es un programa independiente enlazado con los modulos de src/ y con
+ ** bench/support/ (ver el objetivo bench del Makefile). Imprimen una linea por medicion.
+ **
+ ** \addtogroup bench module
+ ** \brief Header file for bench module
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#define BENCH_NS_PER_S 1000000000.0
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+static inline uint64_t BenchNowNs(void) {
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+// Contador de ciclos donde existe, nanosegundos en otro caso
+static inline uint64_t BenchCycles(void) {
+
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return BenchNowNs();
+#endif
+}
+
+// Generador xorshift, para que las corridas se repitan igual con cualquier libc
+static inline uint32_t BenchRandom(uint32_t * state) {
+
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+// Argumento numero index de la linea de comandos, o el valor por defecto
+static inline long BenchArg(int argc, char ** argv, int index, long default_value) {
+
+    return (argc > index) ? strtol(argv[index], NULL, 0) : default_value;
+}
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* BENCH_H */
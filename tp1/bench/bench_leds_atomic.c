@@ -0,0 +1,190 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Prueba de carga del driver de leds con varios hilos
+ **
+ ** Varios hilos prenden y apagan sus propios leds de un mismo banco. Antes de cada cambio el
+ ** hilo compara su led con lo ultimo que escribio en el; si otro hilo lo piso al escribir el
+ ** banco completo, es una actualizacion perdida. Al terminar se compara el puerto con el
+ ** ultimo estado de cada hilo, para contar tambien las perdidas posteriores. Compilado sin
+ ** LEDS_ATOMIC (bench_leds_mutex.elf) mide el driver sin proteccion y con un mutex alrededor de
+ ** cada llamada, como se usa hoy; compilado con LEDS_ATOMIC (bench_leds_atomic.elf) mide el modo
+ ** atomico sin bloqueos.
+ **
+ ** Las perdidas solo aparecen si los hilos corren a la vez en distintos nucleos. Con un solo
+ ** nucleo el driver sin proteccion solo pierde actualizaciones cuando el planificador
+ ** interrumpe un hilo entre la lectura y la escritura, y puede informar 0 aunque la carrera
+ ** existe; tampoco se ejercitan los reordenamientos de memoria del modo atomico. Se informan
+ ** los nucleos disponibles para leer el resultado con eso en cuenta.
+ **
+ ** Usage: bench_leds_atomic.elf [operaciones] [hilos] (por defecto 1M por hilo, 4 hilos)
+ **
+ ** \addtogroup bench module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "bench.h"
+#include "leds.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define DEFAULT_OPERATIONS (1024L * 1024L)
+#define DEFAULT_THREADS    4
+#define MAX_THREADS        LEDS_ULTIMO_LED
+
+/* === Private data type declarations ========================================================== */
+
+typedef struct {
+    const char * name;
+    bool locked; // Cada llamada se protege con el mutex
+} bench_mode_t;
+
+typedef struct {
+    int index;
+    int threads;
+    long operations;
+    bool locked;
+    leds_port_t expected; // Ultimo estado escrito por el hilo en sus leds
+    long lost;            // Actualizaciones propias pisadas por otro hilo
+} worker_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static leds_port_t port;
+static leds_t pool[1];
+static leds_t * leds;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+#ifdef LEDS_ATOMIC
+static const bench_mode_t modes[] = {{"atomico", false}};
+#else
+static const bench_mode_t modes[] = {{"sin bloqueo", false}, {"mutex", true}};
+#endif
+
+/* === Private function implementation ========================================================= */
+
+static void Toggle(worker_t * worker, int led, bool on) {
+
+    leds_port_t mask = (leds_port_t)1 << (led - LEDS_PRIMER_LED);
+
+    if (worker->locked) {
+        pthread_mutex_lock(&lock);
+    }
+    if (LedsBankIsOn(leds, led) != ((worker->expected & mask) != 0)) {
+        worker->lost++;
+    }
+    if (on) {
+        LedsBankTurnOn(leds, led);
+    } else {
+        LedsBankTurnOff(leds, led);
+    }
+    if (worker->locked) {
+        pthread_mutex_unlock(&lock);
+    }
+    worker->expected = on ? (worker->expected | mask) : (worker->expected & ~mask);
+}
+
+// Cada hilo maneja los leds index + 1, index + 1 + hilos, ...
+static void * Worker(void * arg) {
+
+    worker_t * worker = arg;
+    int led = worker->index + 1;
+
+    for (long operation = 0; operation < worker->operations; operation++) {
+        Toggle(worker, led, (operation & 1) != 0);
+        led += worker->threads;
+        if (led > LEDS_ULTIMO_LED) {
+            led = worker->index + 1;
+        }
+    }
+    return NULL;
+}
+
+static void Run(const bench_mode_t * mode, int threads, long operations) {
+
+    pthread_t ids[MAX_THREADS];
+    worker_t workers[MAX_THREADS];
+    long lost = 0;
+
+    LedsPoolInit(pool, 1);
+    leds = LedsCreate(&port, LEDS_ULTIMO_LED);
+
+    uint64_t start = BenchNowNs();
+    for (int index = 0; index < threads; index++) {
+        workers[index] = (worker_t){index, threads, operations, mode->locked, 0, 0};
+        pthread_create(&ids[index], NULL, Worker, &workers[index]);
+    }
+    for (int index = 0; index < threads; index++) {
+        pthread_join(ids[index], NULL);
+    }
+    uint64_t elapsed = BenchNowNs() - start;
+
+    // Cada led es de un solo hilo: sus bits deben quedar como los escribio por ultima vez
+    for (int index = 0; index < threads; index++) {
+        for (int led = index + 1; led <= LEDS_ULTIMO_LED; led += threads) {
+            leds_port_t mask = (leds_port_t)1 << (led - LEDS_PRIMER_LED);
+            lost += ((port ^ workers[index].expected) & mask) != 0;
+        }
+        lost += workers[index].lost;
+    }
+
+    printf("%-12s %2d hilos %8.2f ns/op  actualizaciones perdidas %ld\n", mode->name, threads,
+           (double)elapsed / ((double)operations * threads), lost);
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char ** argv) {
+
+    long operations = BenchArg(argc, argv, 1, DEFAULT_OPERATIONS);
+    int threads = (int)BenchArg(argc, argv, 2, DEFAULT_THREADS);
+
+    if (operations < 1 || threads < 1 || threads > MAX_THREADS) {
+        fprintf(stderr, "Uso: %s [operaciones] [hilos (1 a %d)]\n", argv[0], MAX_THREADS);
+        return EXIT_FAILURE;
+    }
+
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    printf("%ld nucleos%s\n", cores,
+           (cores < 2) ? ": los hilos no corren a la vez, 0 perdidas no prueba nada" : "");
+
+    for (size_t mode = 0; mode < sizeof(modes) / sizeof(modes[0]); mode++) {
+        for (int count = 1; count <= threads; count *= 2) {
+            Run(&modes[mode], count, operations);
+        }
+    }
+    return 0;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
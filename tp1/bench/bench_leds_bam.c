@@ -0,0 +1,132 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Costo por interrupcion del brillo por modulacion de angulo de bit
+ **
+ ** Compara un ciclo de brillo de 8 bits hecho con leds_bam (8 interrupciones, una escritura
+ ** precalculada cada una) contra el PWM por software que se usa hoy, que en cada una de las 256
+ ** interrupciones del ciclo prende o apaga cada led con LedsTurnOn y LedsTurnOff. Tambien mide
+ ** el costo de cambiar brillos.
+ **
+ ** Usage: bench_leds_bam.elf [ciclos] (por defecto 100000)
+ **
+ ** \addtogroup bench module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "bench.h"
+#include "leds.h"
+#include "leds_bam.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define DEFAULT_CYCLES 100000L
+#define PWM_TICKS      256 // Interrupciones por ciclo del PWM por software
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static leds_port_t port;
+static leds_t pool[1];
+static leds_bam_t bam;
+static uint8_t levels[LEDS_ULTIMO_LED];
+
+/* === Private function implementation ========================================================= */
+
+static void PwmTick(int tick) {
+
+    for (int led = LEDS_PRIMER_LED; led <= LEDS_ULTIMO_LED; led++) {
+        if (tick < levels[led - LEDS_PRIMER_LED]) {
+            LedsTurnOn(led);
+        } else {
+            LedsTurnOff(led);
+        }
+    }
+}
+
+static void Report(const char * name, uint64_t elapsed, long ticks, long cycles) {
+
+    printf("%-12s %8.2f ns/interrupcion %10.2f ns/ciclo %4ld interrupciones/ciclo\n", name,
+           (double)elapsed / (double)ticks, (double)elapsed / (double)cycles, ticks / cycles);
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char ** argv) {
+
+    long cycles = BenchArg(argc, argv, 1, DEFAULT_CYCLES);
+    uint32_t seed = 1;
+
+    if (cycles < 1) {
+        fprintf(stderr, "Uso: %s [ciclos]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    for (int led = 0; led < LEDS_ULTIMO_LED; led++) {
+        levels[led] = (uint8_t)BenchRandom(&seed);
+    }
+
+    LedsInitDriver(&port);
+    uint64_t start = BenchNowNs();
+    for (long cycle = 0; cycle < cycles; cycle++) {
+        for (int tick = 0; tick < PWM_TICKS; tick++) {
+            PwmTick(tick);
+        }
+    }
+    Report("pwm", BenchNowNs() - start, cycles * PWM_TICKS, cycles);
+
+    LedsPoolInit(pool, 1);
+    LedsBamInit(&bam, LedsCreate(&port, LEDS_ULTIMO_LED));
+    LedsBamSetLevels(&bam, levels);
+    start = BenchNowNs();
+    for (long cycle = 0; cycle < cycles; cycle++) {
+        for (int tick = 0; tick < LEDS_BAM_BITS; tick++) {
+            LedsBamTick(&bam);
+        }
+    }
+    Report("bam", BenchNowNs() - start, cycles * LEDS_BAM_BITS, cycles);
+
+    start = BenchNowNs();
+    for (long change = 0; change < cycles; change++) {
+        LedsBamSetLevel(&bam, (int)(change % LEDS_ULTIMO_LED) + LEDS_PRIMER_LED, (uint8_t)change);
+    }
+    printf("%-12s %8.2f ns/led\n", "set_level", (double)(BenchNowNs() - start) / (double)cycles);
+
+    start = BenchNowNs();
+    for (long change = 0; change < cycles; change++) {
+        levels[change % LEDS_ULTIMO_LED] = (uint8_t)change;
+        LedsBamSetLevels(&bam, levels);
+    }
+    printf("%-12s %8.2f ns/banco\n", "set_levels", (double)(BenchNowNs() - start) / (double)cycles);
+    return 0;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
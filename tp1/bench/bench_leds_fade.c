@@ -0,0 +1,163 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Costo por interrupcion de los fundidos de brillo
+ **
+ ** Compara los fundidos de leds_fade (punto fijo, 4 leds por palabra y tabla gamma) contra el
+ ** fundido que se hace hoy en la aplicacion, en punto flotante y led por led con powf para la
+ ** correccion gamma. Los dos escriben los brillos en un modulador leds_bam en cada interrupcion
+ ** y reinician los fundidos de todos los leds, con duraciones distintas, cada 256 interrupciones.
+ **
+ ** Usage: bench_leds_fade.elf [interrupciones] (por defecto 1M)
+ **
+ ** \addtogroup bench module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "bench.h"
+#include "leds.h"
+#include "leds_bam.h"
+#include "leds_fade.h"
+
+#include <math.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define DEFAULT_TICKS (1000L * 1000L)
+#define RESTART_TICKS 256  // Interrupciones entre reinicios de los fundidos
+#define GAMMA         2.2f
+
+/* === Private data type declarations ========================================================== */
+
+typedef struct {
+    float level;
+    float step;
+    float target;
+    int remaining;
+} float_fade_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static leds_port_t port;
+static leds_t pool[1];
+static leds_bam_t bam;
+static leds_fade_t fade;
+static float_fade_t float_fades[LEDS_ULTIMO_LED];
+static uint8_t targets[LEDS_ULTIMO_LED];
+static uint16_t durations[LEDS_ULTIMO_LED];
+
+/* === Private function implementation ========================================================= */
+
+static void FloatStart(void) {
+
+    for (int led = 0; led < LEDS_ULTIMO_LED; led++) {
+        float_fade_t * current = &float_fades[led];
+        current->target = targets[led];
+        current->step = (current->target - current->level) / durations[led];
+        current->remaining = durations[led];
+    }
+}
+
+static void FloatTick(void) {
+
+    uint8_t levels[LEDS_ULTIMO_LED];
+
+    for (int led = 0; led < LEDS_ULTIMO_LED; led++) {
+        float_fade_t * current = &float_fades[led];
+        if (current->remaining > 0) {
+            current->level += current->step;
+            current->remaining--;
+            if (current->remaining == 0) {
+                current->level = current->target;
+            }
+        }
+        levels[led] = (uint8_t)(powf(current->level / 255.0f, GAMMA) * 255.0f + 0.5f);
+    }
+    LedsBamSetLevels(&bam, levels);
+}
+
+static void FixedStart(void) {
+
+    for (int led = LEDS_PRIMER_LED; led <= LEDS_ULTIMO_LED; led++) {
+        LedsFadeStart(&fade, led, LedsFadeGetLevel(&fade, led), targets[led - LEDS_PRIMER_LED],
+                      durations[led - LEDS_PRIMER_LED]);
+    }
+}
+
+static void Report(const char * name, uint64_t elapsed, long ticks) {
+
+    printf("%-12s %8.2f ns/interrupcion %8.2f ns/led\n", name, (double)elapsed / (double)ticks,
+           (double)elapsed / (double)ticks / LEDS_ULTIMO_LED);
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char ** argv) {
+
+    long ticks = BenchArg(argc, argv, 1, DEFAULT_TICKS);
+    uint32_t seed = 1;
+
+    if (ticks < 1) {
+        fprintf(stderr, "Uso: %s [interrupciones]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    for (int led = 0; led < LEDS_ULTIMO_LED; led++) {
+        targets[led] = (uint8_t)BenchRandom(&seed);
+        durations[led] = (uint16_t)(BenchRandom(&seed) % RESTART_TICKS + 1);
+    }
+
+    LedsPoolInit(pool, 1);
+    LedsBamInit(&bam, LedsCreate(&port, LEDS_ULTIMO_LED));
+    uint64_t start = BenchNowNs();
+    for (long tick = 0; tick < ticks; tick++) {
+        if (tick % RESTART_TICKS == 0) {
+            targets[tick / RESTART_TICKS % LEDS_ULTIMO_LED] ^= 0xFF;
+            FloatStart();
+        }
+        FloatTick();
+    }
+    Report("flotante", BenchNowNs() - start, ticks);
+
+    LedsFadeInit(&fade, &bam);
+    start = BenchNowNs();
+    for (long tick = 0; tick < ticks; tick++) {
+        if (tick % RESTART_TICKS == 0) {
+            targets[tick / RESTART_TICKS % LEDS_ULTIMO_LED] ^= 0xFF;
+            FixedStart();
+        }
+        LedsFadeTick(&fade);
+    }
+    Report("punto fijo", BenchNowNs() - start, ticks);
+    return 0;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
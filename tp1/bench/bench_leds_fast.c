@@ -0,0 +1,120 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Costo por llamada de prender y apagar leds constantes
+ **
+ ** Compara LedsBankTurnOn, LedsBankTurnOff y LedsBankIsOn, que validan el led en cada llamada,
+ ** contra LEDS_BANK_TURN_ON, LEDS_BANK_TURN_OFF y LEDS_BANK_IS_ON, que lo validan al compilar y
+ ** se reducen a una mascara en linea. Cada iteracion prende, consulta y apaga cuatro leds fijos.
+ **
+ ** Usage: bench_leds_fast.elf [iteraciones] (por defecto 10M)
+ **
+ ** \addtogroup bench module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "bench.h"
+#include "leds.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define DEFAULT_ITERATIONS  (10L * 1000L * 1000L)
+#define CALLS_PER_ITERATION 12 // Cuatro leds prendidos, consultados y apagados
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static leds_port_t port;
+static leds_t pool[1];
+
+/* === Private function implementation ========================================================= */
+
+static void Report(const char * name, uint64_t elapsed, uint64_t cycles, long iterations,
+                   int lit) {
+
+    double calls = (double)iterations * CALLS_PER_ITERATION;
+
+    printf("%-10s %8.2f ns/llamada %6.2f ciclos/llamada  prendidos %d\n", name,
+           (double)elapsed / calls, (double)cycles / calls, lit);
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char ** argv) {
+
+    long iterations = BenchArg(argc, argv, 1, DEFAULT_ITERATIONS);
+
+    if (iterations < 1) {
+        fprintf(stderr, "Uso: %s [iteraciones]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    LedsPoolInit(pool, 1);
+    leds_t * leds = LedsCreate(&port, LEDS_ULTIMO_LED);
+
+    int lit = 0;
+    uint64_t start = BenchNowNs();
+    uint64_t cycles = BenchCycles();
+    for (long iteration = 0; iteration < iterations; iteration++) {
+        LedsBankTurnOn(leds, 1);
+        LedsBankTurnOn(leds, 5);
+        LedsBankTurnOn(leds, 9);
+        LedsBankTurnOn(leds, LEDS_ULTIMO_LED);
+        lit += LedsBankIsOn(leds, 1) + LedsBankIsOn(leds, 5) + LedsBankIsOn(leds, 9) +
+               LedsBankIsOn(leds, LEDS_ULTIMO_LED);
+        LedsBankTurnOff(leds, 1);
+        LedsBankTurnOff(leds, 5);
+        LedsBankTurnOff(leds, 9);
+        LedsBankTurnOff(leds, LEDS_ULTIMO_LED);
+    }
+    Report("validado", BenchNowNs() - start, BenchCycles() - cycles, iterations, lit);
+
+    lit = 0;
+    start = BenchNowNs();
+    cycles = BenchCycles();
+    for (long iteration = 0; iteration < iterations; iteration++) {
+        LEDS_BANK_TURN_ON(leds, 1);
+        LEDS_BANK_TURN_ON(leds, 5);
+        LEDS_BANK_TURN_ON(leds, 9);
+        LEDS_BANK_TURN_ON(leds, LEDS_ULTIMO_LED);
+        lit += LEDS_BANK_IS_ON(leds, 1) + LEDS_BANK_IS_ON(leds, 5) + LEDS_BANK_IS_ON(leds, 9) +
+               LEDS_BANK_IS_ON(leds, LEDS_ULTIMO_LED);
+        LEDS_BANK_TURN_OFF(leds, 1);
+        LEDS_BANK_TURN_OFF(leds, 5);
+        LEDS_BANK_TURN_OFF(leds, 9);
+        LEDS_BANK_TURN_OFF(leds, LEDS_ULTIMO_LED);
+    }
+    Report("constante", BenchNowNs() - start, BenchCycles() - cycles, iterations, lit);
+    return 0;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,143 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Costo del barrido de matrices de leds
+ **
+ ** Mide sobre el puerto virtual el costo de cada interrupcion de barrido, con y sin borrado, y
+ ** la frecuencia maxima de refresco de la pantalla completa que permite, ademas del costo de
+ ** cambiar un led y una imagen completa. Cada tamano de matriz se mide solo si entra en el
+ ** puerto: compilado por defecto (bench_leds_matrix.elf) solo la de 8x8, con puertos de 32 bits
+ ** (bench_leds_matrix32.elf) tambien la de 16x16.
+ **
+ ** Usage: bench_leds_matrix.elf [interrupciones] (por defecto 10M)
+ **
+ ** \addtogroup bench module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "bench.h"
+#include "leds.h"
+#include "leds_matrix.h"
+
+#include <stdbool.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define DEFAULT_TICKS (10L * 1000L * 1000L)
+
+/* === Private data type declarations ========================================================== */
+
+typedef struct {
+    int rows;
+    int columns;
+} geometry_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static const geometry_t geometries[] = {{8, 8}, {16, 16}};
+
+static leds_port_t port;
+static leds_t pool[1];
+static leds_matrix_t matrix;
+static leds_port_t images[2][LEDS_MATRIX_MAX_ROWS];
+
+/* === Private function implementation ========================================================= */
+
+static void MeasureScan(const geometry_t * geometry, bool blanking, long ticks) {
+
+    LedsPoolInit(pool, 1);
+    LedsMatrixInit(&matrix, LedsCreate(&port, LEDS_ULTIMO_LED), geometry->rows, geometry->columns,
+                   0, blanking);
+    LedsMatrixWriteImage(&matrix, images[0]);
+
+    uint64_t start = BenchNowNs();
+    for (long tick = 0; tick < ticks; tick++) {
+        LedsMatrixTick(&matrix);
+    }
+    double tick_ns = (double)(BenchNowNs() - start) / (double)ticks;
+
+    printf("%2dx%-2d %-12s %8.2f ns/interrupcion %12.0f Hz de refresco maximo\n", geometry->rows,
+           geometry->columns, blanking ? "con borrado" : "sin borrado", tick_ns,
+           BENCH_NS_PER_S / (tick_ns * geometry->rows));
+}
+
+static void MeasureUpdates(const geometry_t * geometry, long changes) {
+
+    uint64_t start = BenchNowNs();
+    for (long change = 0; change < changes; change++) {
+        LedsMatrixSetPixel(&matrix, (int)(change % geometry->rows) + 1,
+                           (int)(change % geometry->columns) + 1, (change & 1) != 0);
+    }
+    double pixel_ns = (double)(BenchNowNs() - start) / (double)changes;
+
+    // Imagenes alternadas que difieren en una sola fila
+    start = BenchNowNs();
+    for (long change = 0; change < changes; change++) {
+        LedsMatrixWriteImage(&matrix, images[change & 1]);
+    }
+    double image_ns = (double)(BenchNowNs() - start) / (double)changes;
+
+    printf("%2dx%-2d %8.2f ns/led %8.2f ns/imagen con una fila distinta\n", geometry->rows,
+           geometry->columns, pixel_ns, image_ns);
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char ** argv) {
+
+    long ticks = BenchArg(argc, argv, 1, DEFAULT_TICKS);
+    uint32_t seed = 1;
+
+    if (ticks < 1) {
+        fprintf(stderr, "Uso: %s [interrupciones]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    for (int row = 0; row < LEDS_MATRIX_MAX_ROWS; row++) {
+        images[0][row] = (leds_port_t)BenchRandom(&seed);
+        images[1][row] = images[0][row];
+    }
+    images[1][0] = (leds_port_t)~images[0][0];
+
+    for (size_t index = 0; index < sizeof(geometries) / sizeof(geometries[0]); index++) {
+        const geometry_t * geometry = &geometries[index];
+        if (geometry->rows + geometry->columns > LEDS_PORT_BITS) {
+            printf("%2dx%-2d no entra en un puerto de %d bits\n", geometry->rows,
+                   geometry->columns, LEDS_PORT_BITS);
+            continue;
+        }
+        MeasureScan(geometry, false, ticks);
+        MeasureScan(geometry, true, ticks);
+        MeasureUpdates(geometry, ticks / 10);
+    }
+    return 0;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
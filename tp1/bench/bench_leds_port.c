@@ -0,0 +1,213 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Accesos al puerto y costo por operacion del driver de leds
+ **
+ ** Se compila con LEDS_INSTRUMENTED: cada escritura del driver llega a LedsPortWrite, que la
+ ** cuenta sobre un puerto virtual en memoria y marca con el contador de ciclos cada cambio de
+ ** valor. Para cada carga de trabajo (conmutar leds, prender y apagar todos, rangos y patrones
+ ** aleatorios) informa el tiempo y los ciclos por operacion, las escrituras y los cambios del
+ ** puerto por operacion y los ciclos entre cambios. El driver no lee nunca el puerto (trabaja
+ ** sobre su copia), asi que los accesos al bus son solo escrituras. El tiempo incluye el costo
+ ** del instrumento; bench_leds_port_atomic.elf repite las cargas con LEDS_ATOMIC.
+ **
+ ** Usage: bench_leds_port.elf [operaciones] (por defecto 1M por carga)
+ **
+ ** \addtogroup bench module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "bench.h"
+#include "leds.h"
+
+#ifndef LEDS_INSTRUMENTED
+#error "bench_leds_port se compila con LEDS_INSTRUMENTED"
+#endif
+
+/* === Macros definitions ====================================================================== */
+
+#define DEFAULT_OPERATIONS (1000L * 1000L)
+#define PATTERNS           1024 // Potencia de dos, patrones aleatorios precalculados
+#define HALF_BANK          (LEDS_ULTIMO_LED / 2)
+
+/* === Private data type declarations ========================================================== */
+
+typedef struct {
+    long writes;          // Escrituras recibidas
+    long changes;         // Escrituras que cambiaron el valor del puerto
+    uint64_t last_change; // Ciclo del ultimo cambio
+    uint64_t min_gap;     // Menor cantidad de ciclos entre dos cambios
+} virtual_port_t;
+
+typedef struct {
+    const char * name;
+    void (*run)(long operation);
+} workload_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+static void ToggleOne(long operation);
+static void ToggleConstant(long operation);
+static void ToggleAll(long operation);
+static void ToggleRange(long operation);
+static void WriteRandom(long operation);
+static void ApplyRandom(long operation);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static const workload_t workloads[] = {
+    {"conmutar", ToggleOne},
+    {"conmutar cte", ToggleConstant},
+    {"todos", ToggleAll},
+    {"rango", ToggleRange},
+    {"escribir aleatorio", WriteRandom},
+    {"aplicar aleatorio", ApplyRandom},
+};
+
+static leds_port_t port;
+static leds_t pool[1];
+static leds_t * leds;
+static virtual_port_t virtual_port;
+static leds_port_t patterns[PATTERNS];
+
+/* === Private function implementation ========================================================= */
+
+// Cada led se prende en una operacion y se apaga en la siguiente
+static void ToggleOne(long operation) {
+
+    int led = (int)((operation / 2) % LEDS_ULTIMO_LED) + LEDS_PRIMER_LED;
+
+    if (operation & 1) {
+        LedsBankTurnOff(leds, led);
+    } else {
+        LedsBankTurnOn(leds, led);
+    }
+}
+
+static void ToggleConstant(long operation) {
+
+    if (operation & 1) {
+        LEDS_BANK_TURN_OFF(leds, 5);
+    } else {
+        LEDS_BANK_TURN_ON(leds, 5);
+    }
+}
+
+static void ToggleAll(long operation) {
+
+    if (operation & 1) {
+        LedsBankTurnOffAll(leds);
+    } else {
+        LedsBankTurnOnAll(leds);
+    }
+}
+
+static void ToggleRange(long operation) {
+
+    if (operation & 1) {
+        LedsBankTurnOffRange(leds, LEDS_PRIMER_LED, HALF_BANK);
+    } else {
+        LedsBankTurnOnRange(leds, LEDS_PRIMER_LED, HALF_BANK);
+    }
+}
+
+static void WriteRandom(long operation) {
+
+    LedsBankWrite(leds, patterns[operation & (PATTERNS - 1)]);
+}
+
+static void ApplyRandom(long operation) {
+
+    LedsBankApply(leds, patterns[operation & (PATTERNS - 1)],
+                  patterns[(operation + 1) & (PATTERNS - 1)]);
+}
+
+static void Measure(const workload_t * workload, long operations) {
+
+    LedsBankTurnOffAll(leds);
+    virtual_port = (virtual_port_t){.min_gap = UINT64_MAX};
+
+    uint64_t start = BenchNowNs();
+    uint64_t cycles = BenchCycles();
+    for (long operation = 0; operation < operations; operation++) {
+        workload->run(operation);
+    }
+    cycles = BenchCycles() - cycles;
+    uint64_t elapsed = BenchNowNs() - start;
+
+    double per_op = (double)operations;
+    double gap = (virtual_port.changes > 0) ? (double)cycles / (double)virtual_port.changes : 0.0;
+    uint64_t min_gap = (virtual_port.changes > 1) ? virtual_port.min_gap : 0;
+
+    printf("%-18s %7.2f ns/op %7.2f ciclos/op %5.2f escrituras/op %5.2f cambios/op "
+           "%8.1f ciclos entre cambios (min %llu)\n",
+           workload->name, (double)elapsed / per_op, (double)cycles / per_op,
+           (double)virtual_port.writes / per_op, (double)virtual_port.changes / per_op, gap,
+           (unsigned long long)min_gap);
+}
+
+/* === Public function implementation ========================================================== */
+
+void LedsPortWrite(leds_port_t * target, leds_port_t state) {
+
+    virtual_port.writes++;
+    if (*target != state) {
+        uint64_t now = BenchCycles();
+        if (virtual_port.changes > 0 && now - virtual_port.last_change < virtual_port.min_gap) {
+            virtual_port.min_gap = now - virtual_port.last_change;
+        }
+        virtual_port.last_change = now;
+        virtual_port.changes++;
+    }
+    *target = state;
+}
+
+int main(int argc, char ** argv) {
+
+    long operations = BenchArg(argc, argv, 1, DEFAULT_OPERATIONS);
+    uint32_t seed = 1;
+
+    if (operations < 1) {
+        fprintf(stderr, "Uso: %s [operaciones]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    for (int index = 0; index < PATTERNS; index++) {
+        patterns[index] = (leds_port_t)(((uint64_t)BenchRandom(&seed) << 32) | BenchRandom(&seed));
+    }
+
+    LedsPoolInit(pool, 1);
+    leds = LedsCreate(&port, LEDS_ULTIMO_LED);
+    for (size_t index = 0; index < sizeof(workloads) / sizeof(workloads[0]); index++) {
+        Measure(&workloads[index], operations);
+    }
+    return 0;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -24,7 +24,8 @@ SPDX-License-Identifier: MIT
 
 /** \brief Brief description of the file
  **
- ** Full file description
+ ** El ancho del puerto se elige al compilar con LEDS_PORT_BITS (16 por defecto, 32 o 64) y
+ ** fija el tipo leds_port_t de puertos, mascaras y estados.
  **
  ** \addtogroup leds module
  ** \brief Header file for leds module
@@ -34,6 +35,10 @@ SPDX-License-Identifier: MIT
 #include <stdint.h>
 #include <stdbool.h>
 
+#ifdef LEDS_ATOMIC
+#include <stdatomic.h>
+#endif
+
 /* === Cabecera C++ ============================================================================ */
 
 #ifdef __cplusplus
@@ -42,13 +47,110 @@ extern "C" {
 
 /* === Public macros definitions =============================================================== */
 
+#ifndef LEDS_PORT_BITS
+#define LEDS_PORT_BITS 16 // Ancho del puerto: 16, 32 o 64 bits
+#endif
+
+#define LEDS_PRIMER_LED 1
+#define LEDS_ULTIMO_LED LEDS_PORT_BITS
+#define LEDS_NINGUNO    0 // Resultado de las busquedas sin leds prendidos
+
+#ifndef __cplusplus // La estructura con _Static_assert dentro de sizeof solo es valida en C
+
+/**
+ * \brief Vale cero, y no compila si led no es una constante entre LEDS_PRIMER_LED y LEDS_ULTIMO_LED
+ */
+#define LEDS_CHECK_LED(led)                                                                        \
+    (0 * sizeof(struct {                                                                           \
+         _Static_assert((led) >= LEDS_PRIMER_LED && (led) <= LEDS_ULTIMO_LED,                      \
+                        "El led no es valido");                                                    \
+         char valid;                                                                               \
+     }))
+
+/**
+ * \brief Mascara de un led constante, validado al compilar
+ */
+#define LEDS_LED_MASK(led)                                                                         \
+    ((leds_port_t)(((leds_port_t)1 << ((led) - LEDS_PRIMER_LED)) + LEDS_CHECK_LED(led)))
+
+/**
+ * \brief Prende, apaga o consulta un led constante de un banco sin validarlo en ejecucion
+ *
+ * El numero de led se valida al compilar contra el ancho del puerto y cada llamada se reduce a
+ * una operacion de mascara sobre la copia y una escritura del puerto, sin llamadas ni Alerta.
+ * Un led valido para el puerto pero fuera de la cantidad del banco se ignora (se considera
+ * apagado) sin generar errores. Para numeros de led calculados en ejecucion se usan las
+ * funciones LedsBank, que los validan.
+ *
+ * Solo hay version para bancos creados con LedsCreate: LedsTurnOn y LedsTurnOff siguen siendo
+ * llamadas validadas, porque el banco de LedsInitDriver es privado del driver. Con LEDS_ATOMIC
+ * prender y apagar llaman a LedsBankApply, que publica el puerto con una operacion atomica, y
+ * solo se ahorra la validacion; la consulta sigue siendo en linea.
+ */
+#define LEDS_BANK_TURN_ON(leds, led)  LedsBankSet((leds), LEDS_LED_MASK(led))
+#define LEDS_BANK_TURN_OFF(leds, led) LedsBankClear((leds), LEDS_LED_MASK(led))
+#define LEDS_BANK_IS_ON(leds, led)    LedsBankTest((leds), LEDS_LED_MASK(led))
+
+#endif
+
+/**
+ * \brief Escritura del puerto, unico acceso del driver al hardware
+ *
+ * Compilando con LEDS_INSTRUMENTED cada escritura se entrega a LedsPortWrite, para que el banco
+ * de pruebas cuente los accesos por operacion.
+ */
+#if defined(LEDS_INSTRUMENTED)
+#define LEDS_PORT_WRITE(port, state) LedsPortWrite((port), (state))
+#elif defined(LEDS_ATOMIC)
+#define LEDS_PORT_WRITE(port, state) (*(volatile leds_port_t *)(port) = (state))
+#else
+#define LEDS_PORT_WRITE(port, state) (*(port) = (state))
+#endif
+
 /* === Public data type declarations =========================================================== */
 
+#if LEDS_PORT_BITS == 16
+typedef uint16_t leds_port_t;
+#elif LEDS_PORT_BITS == 32
+typedef uint32_t leds_port_t;
+#elif LEDS_PORT_BITS == 64
+typedef uint64_t leds_port_t;
+#else
+#error "LEDS_PORT_BITS debe ser 16, 32 o 64"
+#endif
+
+/**
+ * \brief Tipo de la copia del puerto
+ *
+ * Compilando con LEDS_ATOMIC la copia es atomica: prender, apagar y aplicar mascaras usan
+ * atomic_fetch_or, atomic_fetch_and y compare_exchange sin bloqueos, por lo que varios hilos y
+ * manejadores de interrupcion pueden usar el mismo banco sin perder actualizaciones.
+ */
+#ifdef LEDS_ATOMIC
+typedef _Atomic leds_port_t leds_shadow_t;
+#else
+typedef leds_port_t leds_shadow_t;
+#endif
+
+/**
+ * \brief Banco de leds conectado a un puerto
+ *
+ * La aplicacion reserva las instancias (normalmente en un arreglo estatico entregado a
+ * LedsPoolInit) y el driver las inicializa en LedsCreate; los campos no deben modificarse
+ * desde afuera.
+ */
+typedef struct leds_s {
+    leds_port_t * port;   // Direccion del puerto
+    leds_shadow_t shadow; // Copia del ultimo valor escrito, el puerto nunca se lee
+    leds_port_t valid;    // Mascara de los leds conectados
+    int count;            // Cantidad de leds conectados, desde el bit 0
+} leds_t;
+
 /* === Public variable declarations ============================================================ */
 
 /* === Public function declarations ============================================================ */
 
-void LedsInitDriver(uint16_t * port);
+void LedsInitDriver(leds_port_t * port);
 
 void LedsTurnOn(int led);
 
@@ -62,6 +164,171 @@ bool LedsIsOn(int led);
 
 bool LedsIsOff(int led);
 
+/**
+ * \brief Actualiza varios leds con una sola escritura del puerto
+ *
+ * Los leds de clear_mask se apagan y despues se prenden los de set_mask, asi que un bit presente
+ * en ambas mascaras queda prendido. El bit 0 corresponde al led 1.
+ *
+ * \param set_mask Leds a prender
+ * \param clear_mask Leds a apagar
+ */
+void LedsApply(leds_port_t set_mask, leds_port_t clear_mask);
+
+/**
+ * \brief Escribe el estado completo de los leds con una sola escritura del puerto
+ *
+ * \param state Estado de los leds, el bit 0 corresponde al led 1
+ */
+void LedsWrite(leds_port_t state);
+
+/**
+ * \brief Devuelve el ultimo estado escrito, sin leer el puerto
+ *
+ * El driver mantiene una copia del puerto, por lo que funciona tambien con registros de solo
+ * escritura.
+ */
+leds_port_t LedsState(void);
+
+/**
+ * \brief Cuenta los leds prendidos con una sola operacion sobre la copia del puerto
+ */
+int LedsCountOn(void);
+
+/**
+ * \brief Devuelve el primer led prendido, o LEDS_NINGUNO
+ */
+int LedsFirstOn(void);
+
+/**
+ * \brief Devuelve el siguiente led prendido despues de led, o LEDS_NINGUNO
+ *
+ * Con led igual a LEDS_NINGUNO equivale a LedsFirstOn, de modo que todos los leds prendidos se
+ * recorren con for (led = LedsFirstOn(); led != LEDS_NINGUNO; led = LedsNextOn(led)).
+ */
+int LedsNextOn(int led);
+
+/**
+ * \brief Prende los leds de first a last inclusive con una sola escritura del puerto
+ */
+void LedsTurnOnRange(int first, int last);
+
+/**
+ * \brief Apaga los leds de first a last inclusive con una sola escritura del puerto
+ */
+void LedsTurnOffRange(int first, int last);
+
+/**
+ * \brief Entrega al driver el arreglo de instancias de donde LedsCreate toma los bancos
+ *
+ * Las instancias quedan contiguas, en el orden de creacion, y las operaciones LedsBanks
+ * recorren todas en una sola pasada. Volver a llamarla descarta los bancos creados.
+ *
+ * \param pool Arreglo de instancias, debe vivir mientras se usen los bancos
+ * \param size Cantidad de instancias del arreglo
+ */
+void LedsPoolInit(leds_t * pool, int size);
+
+/**
+ * \brief Crea un banco de leds y los apaga
+ *
+ * \param port Direccion del puerto del banco
+ * \param count Cantidad de leds conectados, de LEDS_PRIMER_LED a LEDS_ULTIMO_LED
+ * \return Manejador del banco, NULL si los parametros son invalidos o el pool esta lleno
+ */
+leds_t * LedsCreate(leds_port_t * port, int count);
+
+void LedsBankTurnOn(leds_t * leds, int led);
+
+void LedsBankTurnOff(leds_t * leds, int led);
+
+void LedsBankTurnOnAll(leds_t * leds);
+
+void LedsBankTurnOffAll(leds_t * leds);
+
+void LedsBankApply(leds_t * leds, leds_port_t set_mask, leds_port_t clear_mask);
+
+void LedsBankWrite(leds_t * leds, leds_port_t state);
+
+leds_port_t LedsBankState(const leds_t * leds);
+
+bool LedsBankIsOn(const leds_t * leds, int led);
+
+bool LedsBankIsOff(const leds_t * leds, int led);
+
+int LedsBankCountOn(const leds_t * leds);
+
+int LedsBankFirstOn(const leds_t * leds);
+
+int LedsBankNextOn(const leds_t * leds, int led);
+
+void LedsBankTurnOnRange(leds_t * leds, int first, int last);
+
+void LedsBankTurnOffRange(leds_t * leds, int first, int last);
+
+/**
+ * \brief Devuelve la cantidad de bancos creados en el pool
+ */
+int LedsBanksCount(void);
+
+void LedsBanksTurnOnAll(void);
+
+void LedsBanksTurnOffAll(void);
+
+/**
+ * \brief Escribe el estado de todos los bancos del pool en una sola pasada
+ *
+ * \param states Un estado por banco, en el orden de creacion (ver LedsBanksCount); las palabras
+ * de un leds_array_t con un banco completo por palabra se pueden escribir directamente
+ */
+void LedsBanksWrite(const leds_port_t * states);
+
+/**
+ * \brief Vuelve a escribir cada puerto con su copia, por ejemplo tras reiniciar el hardware
+ */
+void LedsBanksRefresh(void);
+
+#ifdef LEDS_INSTRUMENTED
+/**
+ * \brief Recibe cada escritura de un puerto, compilando con LEDS_INSTRUMENTED
+ *
+ * La implementa el banco de pruebas (ver bench/bench_leds_port.c), que debe guardar el valor en
+ * el puerto y puede contar o marcar en el tiempo las escrituras.
+ */
+void LedsPortWrite(leds_port_t * port, leds_port_t state);
+#endif
+
+/* === Public inline function definitions ====================================================== */
+
+#ifdef LEDS_ATOMIC
+
+// Las operaciones atomicas deben republicar el puerto, se delega en la version sin validacion
+static inline void LedsBankSet(leds_t * leds, leds_port_t mask) {
+    LedsBankApply(leds, mask, 0);
+}
+
+static inline void LedsBankClear(leds_t * leds, leds_port_t mask) {
+    LedsBankApply(leds, 0, mask);
+}
+
+#else
+
+static inline void LedsBankSet(leds_t * leds, leds_port_t mask) {
+    leds->shadow = (leds->shadow | mask) & leds->valid;
+    LEDS_PORT_WRITE(leds->port, leds->shadow);
+}
+
+static inline void LedsBankClear(leds_t * leds, leds_port_t mask) {
+    leds->shadow &= (leds_port_t)~mask;
+    LEDS_PORT_WRITE(leds->port, leds->shadow);
+}
+
+#endif
+
+static inline bool LedsBankTest(const leds_t * leds, leds_port_t mask) {
+    return (leds->shadow & mask) != 0;
+}
+
 /* === End of documentation ==================================================================== */
 
 #ifdef __cplusplus
@@ -0,0 +1,114 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef LEDS_ARRAY_H
+#define LEDS_ARRAY_H
+
+/** \brief Arreglos de leds de largo arbitrario
+ **
+ ** Un arreglo guarda un bit por led en palabras del ancho del puerto (leds_port_t), de modo que
+ ** las consultas masivas trabajan de a una palabra: contar con popcount y buscar el siguiente
+ ** led prendido con ctz. Sirve para paneles de estado con miles de indicadores; si cada palabra
+ ** corresponde a un banco completo, LedsBanksWrite publica el arreglo entero en una pasada.
+ **
+ ** \addtogroup leds_array module
+ ** \brief Header file for leds_array module
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+#include "leds.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+// Cantidad de palabras necesarias para count leds
+#define LEDS_ARRAY_WORDS(count) (((count) + LEDS_PORT_BITS - 1) / LEDS_PORT_BITS)
+
+/* === Public data type declarations =========================================================== */
+
+typedef struct leds_array_s {
+    leds_port_t * words; // El bit 0 de la primera palabra es el led 1
+    int count;           // Cantidad de leds del arreglo
+} leds_array_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * \brief Inicializa un arreglo de leds con todos apagados
+ *
+ * \param array Arreglo a inicializar
+ * \param words Palabras del arreglo, al menos LEDS_ARRAY_WORDS(count)
+ * \param count Cantidad de leds
+ * \return Falso si los parametros son invalidos
+ */
+bool LedsArrayInit(leds_array_t * array, leds_port_t * words, int count);
+
+void LedsArrayTurnOn(leds_array_t * array, int led);
+
+void LedsArrayTurnOff(leds_array_t * array, int led);
+
+bool LedsArrayIsOn(const leds_array_t * array, int led);
+
+/**
+ * \brief Prende los leds de first a last inclusive, de a una palabra
+ */
+void LedsArrayTurnOnRange(leds_array_t * array, int first, int last);
+
+/**
+ * \brief Apaga los leds de first a last inclusive, de a una palabra
+ */
+void LedsArrayTurnOffRange(leds_array_t * array, int first, int last);
+
+int LedsArrayCountOn(const leds_array_t * array);
+
+/**
+ * \brief Devuelve el primer led prendido, o LEDS_NINGUNO
+ */
+int LedsArrayFirstOn(const leds_array_t * array);
+
+/**
+ * \brief Devuelve el siguiente led prendido despues de led, o LEDS_NINGUNO
+ */
+int LedsArrayNextOn(const leds_array_t * array, int led);
+
+/**
+ * \brief Copia el estado de todos los leds
+ *
+ * \param copy Destino, al menos LEDS_ARRAY_WORDS(array->count) palabras
+ */
+void LedsArraySnapshot(const leds_array_t * array, leds_port_t * copy);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* LEDS_ARRAY_H */
@@ -0,0 +1,104 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef LEDS_BAM_H
+#define LEDS_BAM_H
+
+/** \brief Brillo de los leds por modulacion de angulo de bit
+ **
+ ** Cada led tiene un brillo de 8 bits. Para cada bit del brillo se precalcula un cuadro: el
+ ** estado del puerto con los leds que tienen ese bit en 1. El cuadro del bit b se muestra
+ ** durante 2^b unidades de tiempo, asi que un ciclo son 8 interrupciones de duracion creciente
+ ** (255 unidades) en lugar de 256 interrupciones iguales, y cada interrupcion es una sola
+ ** escritura del puerto con el cuadro ya calculado.
+ **
+ ** \addtogroup leds_bam module
+ ** \brief Header file for leds_bam module
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+#include "leds.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#define LEDS_BAM_BITS   8   // Bits de brillo, uno por cuadro
+#define LEDS_BAM_PERIOD 255 // Unidades de tiempo de un ciclo completo
+
+/* === Public data type declarations =========================================================== */
+
+typedef struct leds_bam_s {
+    leds_t * leds;                     // Banco donde se escriben los cuadros
+    uint8_t levels[LEDS_ULTIMO_LED];   // Brillo de cada led, el primero es el led 1
+    leds_port_t frames[LEDS_BAM_BITS]; // Cuadro de cada bit del brillo
+    int bit;                           // Bit del proximo cuadro a escribir
+} leds_bam_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * \brief Inicializa el modulador con todos los leds del banco apagados
+ *
+ * \param bam Modulador a inicializar
+ * \param leds Banco donde se escriben los cuadros
+ * \return Falso si los parametros son invalidos
+ */
+bool LedsBamInit(leds_bam_t * bam, leds_t * leds);
+
+/**
+ * \brief Cambia el brillo de un led, actualizando un bit de cada cuadro
+ *
+ * \param level Brillo de 0 (apagado) a 255 (siempre prendido)
+ */
+void LedsBamSetLevel(leds_bam_t * bam, int led, uint8_t level);
+
+uint8_t LedsBamGetLevel(const leds_bam_t * bam, int led);
+
+/**
+ * \brief Cambia el brillo de todos los leds del banco y recalcula los cuadros de a 8 leds
+ *
+ * \param levels Un brillo por led del banco, el primero es el led 1
+ */
+void LedsBamSetLevels(leds_bam_t * bam, const uint8_t * levels);
+
+/**
+ * \brief Escribe el proximo cuadro en el puerto, para llamar desde la interrupcion del temporizador
+ *
+ * \return Unidades de tiempo que debe mostrarse el cuadro, es decir hasta la proxima llamada
+ */
+int LedsBamTick(leds_bam_t * bam);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* LEDS_BAM_H */
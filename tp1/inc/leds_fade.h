@@ -0,0 +1,114 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+#ifndef LEDS_FADE_H
+#define LEDS_FADE_H
+
+/** \brief Fundidos de brillo en punto fijo con correccion gamma
+ **
+ ** Cada led tiene un fundido propio: brillo inicial, brillo final y duracion en interrupciones.
+ ** El brillo se lleva en punto fijo Q8.8 (8 bits enteros y 8 fraccionarios) y los de 4 leds
+ ** comparten una palabra de 64 bits, asi que cada interrupcion avanza 4 leds con una suma y
+ ** una mascara, sin punto flotante ni saltos por led. Al terminar la duracion el brillo queda
+ ** exactamente en el final aunque el paso no sea exacto.
+ **
+ ** La salida pasa por una tabla gamma precalculada (gamma 2.2) para que el fundido se vea
+ ** lineal, y se escribe como cuadros de un modulador leds_bam.
+ **
+ ** \addtogroup leds_fade module
+ ** \brief Header file for leds_fade module
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+#include "leds.h"
+#include "leds_bam.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#define LEDS_FADE_LANES 4 // Brillos Q8.8 por palabra de 64 bits
+#define LEDS_FADE_WORDS ((LEDS_ULTIMO_LED + LEDS_FADE_LANES - 1) / LEDS_FADE_LANES)
+
+/* === Public data type declarations =========================================================== */
+
+typedef struct leds_fade_s {
+    leds_bam_t * bam;                    // Modulador donde se escriben los brillos
+    uint64_t levels[LEDS_FADE_WORDS];    // Brillo actual de cada led en Q8.8
+    uint64_t targets[LEDS_FADE_WORDS];   // Brillo final de cada led en Q8.8
+    uint64_t steps[LEDS_FADE_WORDS];     // Paso por interrupcion, en complemento a dos
+    uint64_t remaining[LEDS_FADE_WORDS]; // Interrupciones que faltan de cada fundido
+    bool running;                        // Hay fundidos sin escribir en el modulador
+} leds_fade_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * \brief Inicializa los fundidos con todos los leds apagados y sin fundidos en curso
+ *
+ * \param fade Fundidos a inicializar
+ * \param bam Modulador ya inicializado donde se escriben los brillos
+ * \return Falso si los parametros son invalidos
+ */
+bool LedsFadeInit(leds_fade_t * fade, leds_bam_t * bam);
+
+/**
+ * \brief Empieza el fundido de un led, reemplazando el que tuviera en curso
+ *
+ * \param start Brillo inicial, sin corregir
+ * \param target Brillo final, sin corregir
+ * \param ticks Duracion en interrupciones, 0 pasa al brillo final en la proxima interrupcion
+ */
+void LedsFadeStart(leds_fade_t * fade, int led, uint8_t start, uint8_t target, uint16_t ticks);
+
+/**
+ * \brief Avanza todos los fundidos y escribe los brillos corregidos en el modulador
+ *
+ * \return Verdadero mientras quede algun fundido en curso
+ */
+bool LedsFadeTick(leds_fade_t * fade);
+
+/**
+ * \brief Brillo actual de un led, antes de la correccion gamma
+ */
+uint8_t LedsFadeGetLevel(const leds_fade_t * fade, int led);
+
+/**
+ * \brief Brillo corregido que se escribe en el modulador para un brillo lineal
+ */
+uint8_t LedsFadeGamma(uint8_t level);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* LEDS_FADE_H */
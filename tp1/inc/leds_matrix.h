@@ -0,0 +1,124 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef LEDS_MATRIX_H
+#define LEDS_MATRIX_H
+
+/** \brief Barrido de matrices de leds multiplexadas por filas y columnas
+ **
+ ** La matriz se conecta a un banco que ocupa todo el puerto: los bits 0 a columnas - 1 son los
+ ** datos de las columnas (el bit 0 es la columna 1) y los siguientes seleccionan la fila, un
+ ** bit por fila. Una matriz de 8x8 entra en el puerto de 16 bits; una de 16x16 necesita 32 bits
+ ** (LEDS_PORT_BITS=32).
+ **
+ ** La imagen se guarda como una palabra por fila y para cada fila se precalcula la palabra del
+ ** puerto, asi que cambiar la imagen cuesta lo mismo que las filas que cambian y cada
+ ** interrupcion de barrido solo escribe la palabra de la fila siguiente. Con el borrado activo
+ ** antes se escribe una palabra sin fila seleccionada, para que la fila anterior no se vea con
+ ** los datos de la nueva (efecto fantasma).
+ **
+ ** \addtogroup leds_matrix module
+ ** \brief Header file for leds_matrix module
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+#include "leds.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#define LEDS_MATRIX_MAX_ROWS (LEDS_PORT_BITS - 1) // Al menos una columna
+
+/* === Public data type declarations =========================================================== */
+
+typedef struct leds_matrix_s {
+    leds_t * leds;                           // Banco que ocupa todo el puerto
+    int rows;                                // Cantidad de filas
+    int columns;                             // Cantidad de columnas
+    leds_port_t active_low;                  // Bits del puerto activos en bajo
+    bool blanking;                           // Borrar el puerto antes de cambiar de fila
+    leds_port_t image[LEDS_MATRIX_MAX_ROWS]; // Columnas prendidas de cada fila
+    leds_port_t scan[LEDS_MATRIX_MAX_ROWS];  // Palabra del puerto de cada fila
+    int row;                                 // Proxima fila a barrer
+} leds_matrix_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * \brief Inicializa una matriz con todos los leds apagados
+ *
+ * \param matrix Matriz a inicializar
+ * \param leds Banco de LEDS_ULTIMO_LED leds donde se escriben las filas
+ * \param rows Cantidad de filas
+ * \param columns Cantidad de columnas, filas y columnas juntas deben entrar en el puerto
+ * \param active_low Bits del puerto que encienden en bajo, por ejemplo las filas con catodo comun
+ * \param blanking Escribir un puerto sin fila seleccionada antes de cada fila
+ * \return Falso si los parametros son invalidos
+ */
+bool LedsMatrixInit(leds_matrix_t * matrix, leds_t * leds, int rows, int columns,
+                    leds_port_t active_low, bool blanking);
+
+/**
+ * \brief Prende o apaga un led de la matriz; solo recalcula su fila
+ *
+ * \param row Fila, desde LEDS_PRIMER_LED
+ * \param column Columna, desde LEDS_PRIMER_LED
+ */
+void LedsMatrixSetPixel(leds_matrix_t * matrix, int row, int column, bool on);
+
+bool LedsMatrixIsOn(const leds_matrix_t * matrix, int row, int column);
+
+/**
+ * \brief Cambia una fila completa; solo recalcula esa fila
+ *
+ * \param columns Columnas prendidas, el bit 0 es la columna 1
+ */
+void LedsMatrixSetRow(leds_matrix_t * matrix, int row, leds_port_t columns);
+
+/**
+ * \brief Cambia la imagen completa, recalculando solo las filas distintas
+ *
+ * \param image Una palabra por fila, como en LedsMatrixSetRow
+ * \return Cantidad de filas que cambiaron
+ */
+int LedsMatrixWriteImage(leds_matrix_t * matrix, const leds_port_t * image);
+
+/**
+ * \brief Muestra la fila siguiente, para llamar desde la interrupcion del temporizador
+ */
+void LedsMatrixTick(leds_matrix_t * matrix);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* LEDS_MATRIX_H */
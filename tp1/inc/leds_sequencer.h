@@ -0,0 +1,141 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef LEDS_SEQUENCER_H
+#define LEDS_SEQUENCER_H
+
+/** \brief Secuenciador de patrones de leds con doble buffer
+ **
+ ** Los patrones se describen con leds_pattern_t y se compilan a cuadros: un estado del puerto y
+ ** la cantidad de interrupciones que se muestra. La interrupcion del temporizador llama a
+ ** LedsSequencerTick, que solo descuenta la duracion del cuadro y al terminarlo escribe el
+ ** siguiente en el puerto con una sola escritura.
+ **
+ ** Los cuadros se reproducen desde uno de dos buffers. Mientras tanto la aplicacion prepara el
+ ** proximo patron en el otro (LedsSequencerBack) y lo entrega con LedsSequencerSubmit; el
+ ** intercambio se hace en la interrupcion al terminar el cuadro actual, por lo que nunca se
+ ** reproduce un patron a medio escribir.
+ **
+ ** \addtogroup leds_sequencer module
+ ** \brief Header file for leds_sequencer module
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+#include "leds.h"
+
+#include <stdatomic.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/* === Public data type declarations =========================================================== */
+
+typedef struct leds_frame_s {
+    leds_port_t state; // Estado del puerto
+    uint16_t duration; // Interrupciones que se muestra, al menos una
+} leds_frame_t;
+
+typedef enum leds_pattern_kind_e {
+    LEDS_PATRON_FIJO,     // Los leds de la mascara prendidos
+    LEDS_PATRON_PARPADEO, // Los leds de la mascara prendidos y despues apagados
+    LEDS_PATRON_BARRIDO,  // Cada led de la mascara solo, del primero al ultimo
+    LEDS_PATRON_LLENADO,  // Los leds de la mascara se van sumando del primero al ultimo
+} leds_pattern_kind_t;
+
+typedef struct leds_pattern_s {
+    leds_pattern_kind_t kind;
+    leds_port_t mask;  // Leds que participan del patron
+    uint16_t duration; // Interrupciones de cada cuadro
+    int repeat;        // Veces que se repiten los cuadros del patron
+} leds_pattern_t;
+
+typedef struct leds_sequencer_s {
+    leds_t * leds;             // Banco donde se escriben los cuadros
+    leds_frame_t * buffers[2]; // Buffers de cuadros entregados por la aplicacion
+    int capacity;              // Cuadros de cada buffer
+    int counts[2];             // Cuadros cargados en cada buffer
+    bool repeats[2];           // La secuencia de cada buffer vuelve a empezar al terminar
+    int front;                 // Buffer que se esta reproduciendo
+    int step;                  // Cuadro actual del buffer que se reproduce
+    int remaining;             // Interrupciones que faltan para terminar el cuadro actual
+    atomic_bool pending;       // El otro buffer tiene una secuencia nueva
+} leds_sequencer_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * \brief Compila una lista de patrones a cuadros, uno detras de otro
+ *
+ * \param patterns Patrones a compilar
+ * \param count Cantidad de patrones
+ * \param frames Destino de los cuadros
+ * \param capacity Cuadros que entran en el destino
+ * \return Cantidad de cuadros generados, 0 si algun patron es invalido o no entran
+ */
+int LedsPatternCompile(const leds_pattern_t * patterns, int count, leds_frame_t * frames,
+                       int capacity);
+
+/**
+ * \brief Inicializa el secuenciador, sin secuencia y con todos los leds del banco apagados
+ *
+ * \param buffers Dos buffers de capacity cuadros cada uno, uno detras del otro
+ * \return Falso si los parametros son invalidos
+ */
+bool LedsSequencerInit(leds_sequencer_t * sequencer, leds_t * leds, leds_frame_t * buffers,
+                       int capacity);
+
+/**
+ * \brief Devuelve el buffer libre para preparar la proxima secuencia
+ *
+ * \return Buffer de capacity cuadros, NULL si la secuencia entregada antes todavia no empezo
+ */
+leds_frame_t * LedsSequencerBack(leds_sequencer_t * sequencer);
+
+/**
+ * \brief Entrega la secuencia preparada en el buffer libre; empieza al terminar el cuadro actual
+ *
+ * \param count Cuadros cargados en el buffer libre
+ * \param repeat Vuelve a empezar al terminar; si no, queda mostrando el ultimo cuadro
+ * \return Falso si no hay buffer libre o la cantidad es invalida
+ */
+bool LedsSequencerSubmit(leds_sequencer_t * sequencer, int count, bool repeat);
+
+/**
+ * \brief Avanza la secuencia una interrupcion, para llamar desde la interrupcion del temporizador
+ */
+void LedsSequencerTick(leds_sequencer_t * sequencer);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* LEDS_SEQUENCER_H */
@@ -30,37 +30,149 @@ SPDX-License-Identifier: MIT
 #include "errores.h"
 
 #include <stdbool.h>
+#include <stddef.h>
+
+#ifdef LEDS_ATOMIC
+#include <stdatomic.h>
+#endif
 
 /* === Macros definitions ====================================================================== */
 
 #define LEDS_ALL_OFF      0x0000
 #define FIRST_BIT         1
 #define LED_TO_BIT_OFFSET 1
-#define LEDS_PRIMER_LED   1
-#define LEDS_ULTIMO_LED   16
+
+#ifdef LEDS_ATOMIC
+#if LEDS_PORT_BITS == 16
+#define LEDS_PORT_LOCK_FREE ATOMIC_SHORT_LOCK_FREE
+#elif LEDS_PORT_BITS == 32
+#define LEDS_PORT_LOCK_FREE ATOMIC_INT_LOCK_FREE
+#else
+#define LEDS_PORT_LOCK_FREE ATOMIC_LLONG_LOCK_FREE
+#endif
+// Sin bloqueos tambien se puede llamar desde un manejador de interrupcion o de senal
+_Static_assert(LEDS_PORT_LOCK_FREE == 2, "Las operaciones atomicas del puerto usan bloqueos");
+#endif
 
 /* === Private data type declarations ========================================================== */
 
 /* === Private variable declarations =========================================================== */
 
-static uint16_t * _port; // Direccion del puerto virtual
+static leds_t _default;  // Instancia usada por las funciones sin manejador
+static leds_t * _pool;   // Instancias entregadas por la aplicacion, contiguas en memoria
+static int _pool_size;   // Cantidad de instancias del pool
+static int _pool_used;   // Cantidad de instancias creadas
 
 /* === Private function declarations =========================================================== */
 
-static uint16_t LedsToMask(int led) {
-    return FIRST_BIT << (led - LED_TO_BIT_OFFSET);
+static leds_port_t LedsToMask(int led) {
+    return (leds_port_t)FIRST_BIT << (led - LED_TO_BIT_OFFSET);
 }
 
-static bool ISLedValid(int led) {
-    bool result = led >= LEDS_PRIMER_LED && led <= LEDS_ULTIMO_LED;
+// Leds first a last inclusive, sin desplazar el ancho completo del puerto
+static leds_port_t LedsRangeToMask(int first, int last) {
+    leds_port_t upto_last = (leds_port_t)~LEDS_ALL_OFF >> (LEDS_PORT_BITS - last);
+    return upto_last & ~(LedsToMask(first) - FIRST_BIT);
+}
+
+static leds_port_t LedsCountToMask(int count) {
+    return LedsRangeToMask(LEDS_PRIMER_LED, count);
+}
+
+static int LedsLowestOn(leds_port_t state) {
+    return (state == LEDS_ALL_OFF) ? LEDS_NINGUNO : __builtin_ctzll(state) + LED_TO_BIT_OFFSET;
+}
+
+static bool ISLedValid(const leds_t * leds, int led) {
+    bool result = led >= LEDS_PRIMER_LED && led <= leds->count;
     if (!result) {
         Alerta("El led no es valido");
     }
     return result;
 }
 
-static bool LedsRawState(int led) {
-    return (*_port & LedsToMask(led)) != LEDS_ALL_OFF;
+static bool ISRangeValid(const leds_t * leds, int first, int last) {
+    bool result = first >= LEDS_PRIMER_LED && first <= last && last <= leds->count;
+    if (!result) {
+        Alerta("El rango de leds no es valido");
+    }
+    return result;
+}
+
+static bool LedsRawState(const leds_t * leds, int led) {
+    return (leds->shadow & LedsToMask(led)) != LEDS_ALL_OFF;
+}
+
+#ifdef LEDS_ATOMIC
+
+static void LedsPublish(leds_t * leds, leds_port_t state) {
+    leds_port_t current = state;
+    // Otro hilo pudo escribir en el puerto un estado anterior despues de este, asi que se repite
+    // hasta que el puerto refleje la copia; el ultimo en escribir siempre deja el estado final
+    do {
+        state = current;
+        LEDS_PORT_WRITE(leds->port, state);
+        // La escritura del puerto no es atomica: sin la barrera el procesador puede adelantar la
+        // lectura de la copia a la escritura aun pendiente, y esta pisaria la de otro hilo que
+        // ya leyo su propio estado como final
+        atomic_thread_fence(memory_order_seq_cst);
+        current = atomic_load(&leds->shadow);
+    } while (current != state);
+}
+
+static void LedsUpdatePort(leds_t * leds, leds_port_t state) {
+    state &= leds->valid; // Los bits sin led conectado no se modifican
+    atomic_store(&leds->shadow, state);
+    LedsPublish(leds, state);
+}
+
+static void LedsSetBits(leds_t * leds, leds_port_t mask) {
+    LedsPublish(leds, atomic_fetch_or(&leds->shadow, mask) | mask);
+}
+
+static void LedsClearBits(leds_t * leds, leds_port_t mask) {
+    LedsPublish(leds, atomic_fetch_and(&leds->shadow, (leds_port_t)~mask) & ~mask);
+}
+
+static void LedsUpdateBits(leds_t * leds, leds_port_t set_mask, leds_port_t clear_mask) {
+    leds_port_t current = atomic_load(&leds->shadow);
+    leds_port_t state;
+    do {
+        state = ((current & ~clear_mask) | set_mask) & leds->valid;
+    } while (!atomic_compare_exchange_weak(&leds->shadow, &current, state));
+    LedsPublish(leds, state);
+}
+
+#else
+
+static void LedsPublish(leds_t * leds, leds_port_t state) {
+    LEDS_PORT_WRITE(leds->port, state); // Una unica escritura por actualizacion
+}
+
+static void LedsUpdatePort(leds_t * leds, leds_port_t state) {
+    leds->shadow = state & leds->valid; // Los bits sin led conectado no se modifican
+    LedsPublish(leds, leds->shadow);
+}
+
+static void LedsSetBits(leds_t * leds, leds_port_t mask) {
+    LedsUpdatePort(leds, leds->shadow | mask);
+}
+
+static void LedsClearBits(leds_t * leds, leds_port_t mask) {
+    LedsUpdatePort(leds, leds->shadow & ~mask);
+}
+
+static void LedsUpdateBits(leds_t * leds, leds_port_t set_mask, leds_port_t clear_mask) {
+    LedsUpdatePort(leds, (leds->shadow & ~clear_mask) | set_mask);
+}
+
+#endif
+
+static void LedsSetup(leds_t * leds, leds_port_t * port, int count) {
+    leds->port = port;
+    leds->count = count;
+    leds->valid = LedsCountToMask(count);
+    LedsUpdatePort(leds, LEDS_ALL_OFF);
 }
 
 /* === Public variable definitions ============================================================= */
@@ -71,50 +183,227 @@ static bool LedsRawState(int led) {
 
 /* === Public function implementation ========================================================== */
 
-void LedsInitDriver(uint16_t * port) {
+void LedsInitDriver(leds_port_t * port) {
 
-    _port = port;
-    LedsTurnOffAll();
+    LedsSetup(&_default, port, LEDS_ULTIMO_LED);
 }
 
 void LedsTurnOn(int led) {
 
-    if (!ISLedValid(led))
-        return; // Evito que se apague un led invalido
-
-    *_port |= LedsToMask(led);
+    LedsBankTurnOn(&_default, led);
 }
 
 void LedsTurnOff(int led) {
 
-    if (!ISLedValid(led))
-        return; // Evito que se apague un led invalido
-
-    *_port &= ~LedsToMask(led);
+    LedsBankTurnOff(&_default, led);
 }
 
 void LedsTurnOnAll(void) {
 
-    *_port = ~LEDS_ALL_OFF;
+    LedsBankTurnOnAll(&_default);
 }
 
 void LedsTurnOffAll(void) {
 
-    *_port = LEDS_ALL_OFF;
+    LedsBankTurnOffAll(&_default);
+}
+
+void LedsApply(leds_port_t set_mask, leds_port_t clear_mask) {
+
+    LedsBankApply(&_default, set_mask, clear_mask);
+}
+
+void LedsWrite(leds_port_t state) {
+
+    LedsBankWrite(&_default, state);
+}
+
+leds_port_t LedsState(void) {
+
+    return LedsBankState(&_default);
 }
 
 bool LedsIsOn(int led) {
 
-    if (!ISLedValid(led))
-        return false; // Un led invalido se considera apagado
-    return LedsRawState(led);
+    return LedsBankIsOn(&_default, led);
 }
 
 bool LedsIsOff(int led) {
 
-    if (!ISLedValid(led))
+    return LedsBankIsOff(&_default, led);
+}
+
+int LedsCountOn(void) {
+
+    return LedsBankCountOn(&_default);
+}
+
+int LedsFirstOn(void) {
+
+    return LedsBankFirstOn(&_default);
+}
+
+int LedsNextOn(int led) {
+
+    return LedsBankNextOn(&_default, led);
+}
+
+void LedsTurnOnRange(int first, int last) {
+
+    LedsBankTurnOnRange(&_default, first, last);
+}
+
+void LedsTurnOffRange(int first, int last) {
+
+    LedsBankTurnOffRange(&_default, first, last);
+}
+
+void LedsPoolInit(leds_t * pool, int size) {
+
+    _pool = pool;
+    _pool_size = (pool != NULL && size > 0) ? size : 0;
+    _pool_used = 0;
+}
+
+leds_t * LedsCreate(leds_port_t * port, int count) {
+
+    leds_t * leds = NULL;
+
+    if (port == NULL || count < LEDS_PRIMER_LED || count > LEDS_ULTIMO_LED) {
+        Alerta("El banco de leds no es valido");
+    } else if (_pool_used >= _pool_size) {
+        Alerta("No quedan instancias libres en el pool");
+    } else {
+        leds = &_pool[_pool_used++];
+        LedsSetup(leds, port, count);
+    }
+    return leds;
+}
+
+void LedsBankTurnOn(leds_t * leds, int led) {
+
+    if (!ISLedValid(leds, led))
+        return; // Evito que se prenda un led invalido
+
+    LedsSetBits(leds, LedsToMask(led));
+}
+
+void LedsBankTurnOff(leds_t * leds, int led) {
+
+    if (!ISLedValid(leds, led))
+        return; // Evito que se apague un led invalido
+
+    LedsClearBits(leds, LedsToMask(led));
+}
+
+void LedsBankTurnOnAll(leds_t * leds) {
+
+    LedsUpdatePort(leds, ~LEDS_ALL_OFF);
+}
+
+void LedsBankTurnOffAll(leds_t * leds) {
+
+    LedsUpdatePort(leds, LEDS_ALL_OFF);
+}
+
+void LedsBankApply(leds_t * leds, leds_port_t set_mask, leds_port_t clear_mask) {
+
+    LedsUpdateBits(leds, set_mask, clear_mask);
+}
+
+void LedsBankWrite(leds_t * leds, leds_port_t state) {
+
+    LedsUpdatePort(leds, state);
+}
+
+leds_port_t LedsBankState(const leds_t * leds) {
+
+    return leds->shadow;
+}
+
+bool LedsBankIsOn(const leds_t * leds, int led) {
+
+    if (!ISLedValid(leds, led))
         return false; // Un led invalido se considera apagado
-    return LedsRawState(led) == false;
+    return LedsRawState(leds, led);
+}
+
+bool LedsBankIsOff(const leds_t * leds, int led) {
+
+    if (!ISLedValid(leds, led))
+        return false; // Un led invalido se considera apagado
+    return LedsRawState(leds, led) == false;
+}
+
+int LedsBankCountOn(const leds_t * leds) {
+
+    return __builtin_popcountll(leds->shadow);
+}
+
+int LedsBankFirstOn(const leds_t * leds) {
+
+    return LedsLowestOn(leds->shadow);
+}
+
+int LedsBankNextOn(const leds_t * leds, int led) {
+
+    if (led < LEDS_PRIMER_LED - 1 || led > leds->count) {
+        Alerta("El led no es valido");
+        return LEDS_NINGUNO;
+    }
+    if (led < LEDS_PRIMER_LED)
+        return LedsLowestOn(leds->shadow); // Busqueda desde el principio
+
+    return LedsLowestOn(leds->shadow & ~LedsRangeToMask(LEDS_PRIMER_LED, led));
+}
+
+void LedsBankTurnOnRange(leds_t * leds, int first, int last) {
+
+    if (!ISRangeValid(leds, first, last))
+        return; // Evito prender leds fuera del banco
+
+    LedsSetBits(leds, LedsRangeToMask(first, last));
+}
+
+void LedsBankTurnOffRange(leds_t * leds, int first, int last) {
+
+    if (!ISRangeValid(leds, first, last))
+        return; // Evito apagar leds fuera del banco
+
+    LedsClearBits(leds, LedsRangeToMask(first, last));
+}
+
+int LedsBanksCount(void) {
+
+    return _pool_used;
+}
+
+void LedsBanksTurnOnAll(void) {
+
+    for (int index = 0; index < _pool_used; index++) {
+        LedsUpdatePort(&_pool[index], ~LEDS_ALL_OFF);
+    }
+}
+
+void LedsBanksTurnOffAll(void) {
+
+    for (int index = 0; index < _pool_used; index++) {
+        LedsUpdatePort(&_pool[index], LEDS_ALL_OFF);
+    }
+}
+
+void LedsBanksWrite(const leds_port_t * states) {
+
+    for (int index = 0; index < _pool_used; index++) {
+        LedsUpdatePort(&_pool[index], states[index]);
+    }
+}
+
+void LedsBanksRefresh(void) {
+
+    for (int index = 0; index < _pool_used; index++) {
+        LedsPublish(&_pool[index], _pool[index].shadow);
+    }
 }
 
 /* === End of documentation ==================================================================== */
@@ -0,0 +1,208 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Arreglos de leds de largo arbitrario
+ **
+ ** \addtogroup leds_array module
+ ** \brief Arreglos de leds
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "leds_array.h"
+#include "errores.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define LEDS_ALL_OFF      0x0000
+#define FIRST_BIT         1
+#define LED_TO_BIT_OFFSET 1
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+static int LedsToWord(int led) {
+    return (led - LED_TO_BIT_OFFSET) / LEDS_PORT_BITS;
+}
+
+static int LedsToBit(int led) {
+    return (led - LED_TO_BIT_OFFSET) % LEDS_PORT_BITS;
+}
+
+// Bits de la palabra desde bit hacia arriba
+static leds_port_t LedsFromBitMask(int bit) {
+    return (leds_port_t)((leds_port_t)~LEDS_ALL_OFF << bit);
+}
+
+// Bits de la palabra desde 0 hasta bit inclusive
+static leds_port_t LedsUpToBitMask(int bit) {
+    return (leds_port_t)((leds_port_t)~LEDS_ALL_OFF >> (LEDS_PORT_BITS - 1 - bit));
+}
+
+static bool ISLedValid(const leds_array_t * array, int led) {
+    bool result = led >= LEDS_PRIMER_LED && led <= array->count;
+    if (!result) {
+        Alerta("El led no es valido");
+    }
+    return result;
+}
+
+static bool ISRangeValid(const leds_array_t * array, int first, int last) {
+    bool result = first >= LEDS_PRIMER_LED && first <= last && last <= array->count;
+    if (!result) {
+        Alerta("El rango de leds no es valido");
+    }
+    return result;
+}
+
+// Aplica la mascara de cada palabra del rango: parcial en los extremos, completa en el medio
+static void LedsArrayUpdateRange(leds_array_t * array, int first, int last, bool on) {
+    int first_word = LedsToWord(first);
+    int last_word = LedsToWord(last);
+
+    for (int word = first_word; word <= last_word; word++) {
+        leds_port_t mask = (leds_port_t)~LEDS_ALL_OFF;
+        if (word == first_word) {
+            mask &= LedsFromBitMask(LedsToBit(first));
+        }
+        if (word == last_word) {
+            mask &= LedsUpToBitMask(LedsToBit(last));
+        }
+        if (on) {
+            array->words[word] |= mask;
+        } else {
+            array->words[word] &= (leds_port_t)~mask;
+        }
+    }
+}
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+bool LedsArrayInit(leds_array_t * array, leds_port_t * words, int count) {
+
+    if (array == NULL || words == NULL || count < LEDS_PRIMER_LED) {
+        Alerta("El arreglo de leds no es valido");
+        return false;
+    }
+
+    array->words = words;
+    array->count = count;
+    memset(words, LEDS_ALL_OFF, (size_t)LEDS_ARRAY_WORDS(count) * sizeof(leds_port_t));
+    return true;
+}
+
+void LedsArrayTurnOn(leds_array_t * array, int led) {
+
+    if (!ISLedValid(array, led))
+        return; // Evito que se prenda un led invalido
+
+    array->words[LedsToWord(led)] |= (leds_port_t)FIRST_BIT << LedsToBit(led);
+}
+
+void LedsArrayTurnOff(leds_array_t * array, int led) {
+
+    if (!ISLedValid(array, led))
+        return; // Evito que se apague un led invalido
+
+    array->words[LedsToWord(led)] &= (leds_port_t) ~((leds_port_t)FIRST_BIT << LedsToBit(led));
+}
+
+bool LedsArrayIsOn(const leds_array_t * array, int led) {
+
+    if (!ISLedValid(array, led))
+        return false; // Un led invalido se considera apagado
+
+    return (array->words[LedsToWord(led)] & ((leds_port_t)FIRST_BIT << LedsToBit(led))) !=
+           LEDS_ALL_OFF;
+}
+
+void LedsArrayTurnOnRange(leds_array_t * array, int first, int last) {
+
+    if (!ISRangeValid(array, first, last))
+        return; // Evito prender leds fuera del arreglo
+
+    LedsArrayUpdateRange(array, first, last, true);
+}
+
+void LedsArrayTurnOffRange(leds_array_t * array, int first, int last) {
+
+    if (!ISRangeValid(array, first, last))
+        return; // Evito apagar leds fuera del arreglo
+
+    LedsArrayUpdateRange(array, first, last, false);
+}
+
+int LedsArrayCountOn(const leds_array_t * array) {
+
+    int count = 0;
+    for (int word = 0; word < LEDS_ARRAY_WORDS(array->count); word++) {
+        count += __builtin_popcountll(array->words[word]);
+    }
+    return count;
+}
+
+int LedsArrayFirstOn(const leds_array_t * array) {
+
+    return LedsArrayNextOn(array, LEDS_NINGUNO);
+}
+
+int LedsArrayNextOn(const leds_array_t * array, int led) {
+
+    if (led < LEDS_NINGUNO || led > array->count) {
+        Alerta("El led no es valido");
+        return LEDS_NINGUNO;
+    }
+    if (led == array->count)
+        return LEDS_NINGUNO; // No quedan leds por encima
+
+    // El bit de led + 1 es el numero led contando desde 0
+    int word = led / LEDS_PORT_BITS;
+    leds_port_t pending = array->words[word] & LedsFromBitMask(led % LEDS_PORT_BITS);
+
+    while (pending == LEDS_ALL_OFF && ++word < LEDS_ARRAY_WORDS(array->count)) {
+        pending = array->words[word];
+    }
+    if (pending == LEDS_ALL_OFF)
+        return LEDS_NINGUNO;
+
+    return word * LEDS_PORT_BITS + __builtin_ctzll(pending) + LED_TO_BIT_OFFSET;
+}
+
+void LedsArraySnapshot(const leds_array_t * array, leds_port_t * copy) {
+
+    memcpy(copy, array->words, (size_t)LEDS_ARRAY_WORDS(array->count) * sizeof(leds_port_t));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,143 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Brillo de los leds por modulacion de angulo de bit
+ **
+ ** \addtogroup leds_bam module
+ ** \brief Modulacion de angulo de bit
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "leds_bam.h"
+#include "errores.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define LEDS_ALL_OFF      0x0000
+#define FIRST_BIT         1
+#define LED_TO_BIT_OFFSET 1
+
+#define LEDS_PER_GROUP    8                     // Brillos que entran en una palabra de 64 bits
+#define BYTES_LOW_BITS    0x0101010101010101ULL // Bit 0 de cada byte
+#define GATHER_LOW_BITS   0x0102040810204080ULL // Junta el bit 0 del byte i en el bit 56 + i
+#define GATHERED_SHIFT    56
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+static bool ISLedValid(const leds_bam_t * bam, int led) {
+    bool result = led >= LEDS_PRIMER_LED && led <= bam->leds->count;
+    if (!result) {
+        Alerta("El led no es valido");
+    }
+    return result;
+}
+
+// Empaqueta los brillos de un grupo de leds, el del primero en el byte 0
+static uint64_t LedsBamPackGroup(const uint8_t * levels, int count) {
+    uint64_t packed = 0;
+    for (int led = 0; led < count; led++) {
+        packed |= (uint64_t)levels[led] << (led * LEDS_PER_GROUP);
+    }
+    return packed;
+}
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+bool LedsBamInit(leds_bam_t * bam, leds_t * leds) {
+
+    if (bam == NULL || leds == NULL) {
+        Alerta("El modulador no es valido");
+        return false;
+    }
+
+    memset(bam, 0, sizeof(*bam));
+    bam->leds = leds;
+    LedsBankWrite(leds, LEDS_ALL_OFF);
+    return true;
+}
+
+void LedsBamSetLevel(leds_bam_t * bam, int led, uint8_t level) {
+
+    if (!ISLedValid(bam, led))
+        return; // Evito cambiar el brillo de un led invalido
+
+    leds_port_t mask = (leds_port_t)FIRST_BIT << (led - LED_TO_BIT_OFFSET);
+    bam->levels[led - LED_TO_BIT_OFFSET] = level;
+    for (int bit = 0; bit < LEDS_BAM_BITS; bit++) {
+        // Todos unos si el bit del brillo esta en 1, sin saltos
+        leds_port_t on = (leds_port_t)0 - ((level >> bit) & FIRST_BIT);
+        bam->frames[bit] = (bam->frames[bit] & (leds_port_t)~mask) | (on & mask);
+    }
+}
+
+uint8_t LedsBamGetLevel(const leds_bam_t * bam, int led) {
+
+    if (!ISLedValid(bam, led))
+        return 0; // Un led invalido se considera apagado
+
+    return bam->levels[led - LED_TO_BIT_OFFSET];
+}
+
+void LedsBamSetLevels(leds_bam_t * bam, const uint8_t * levels) {
+
+    int count = bam->leds->count;
+
+    memcpy(bam->levels, levels, (size_t)count);
+    memset(bam->frames, LEDS_ALL_OFF, sizeof(bam->frames));
+
+    // Cada grupo de 8 brillos se trata como una palabra: el bit b de los 8 bytes se junta en un
+    // byte con una multiplicacion, que es la parte del cuadro b de esos 8 leds
+    for (int first = 0; first < count; first += LEDS_PER_GROUP) {
+        int size = (count - first < LEDS_PER_GROUP) ? count - first : LEDS_PER_GROUP;
+        uint64_t packed = LedsBamPackGroup(&levels[first], size);
+        for (int bit = 0; bit < LEDS_BAM_BITS; bit++) {
+            uint64_t plane = ((packed >> bit) & BYTES_LOW_BITS) * GATHER_LOW_BITS;
+            bam->frames[bit] |= (leds_port_t)((plane >> GATHERED_SHIFT) << first);
+        }
+    }
+}
+
+int LedsBamTick(leds_bam_t * bam) {
+
+    int bit = bam->bit;
+
+    LedsBankWrite(bam->leds, bam->frames[bit]);
+    bam->bit = (bit + 1) % LEDS_BAM_BITS;
+    return FIRST_BIT << bit;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,189 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Fundidos de brillo en punto fijo con correccion gamma
+ **
+ ** \addtogroup leds_fade module
+ ** \brief Fundidos de brillo
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "leds_fade.h"
+#include "errores.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define LED_TO_LANE_OFFSET 1
+#define LANE_BITS          16
+#define LEVEL_FRACTION     8    // Bits fraccionarios de un brillo Q8.8
+#define LEVEL_MASK         0xFF // Parte entera de un brillo Q8.8
+
+#define LANES_HIGH         0x8000800080008000ULL // Bit alto de cada brillo
+#define LANES_LOW          0x7FFF7FFF7FFF7FFFULL // Bits bajos de cada brillo
+#define LANES_ONES         0x0001000100010001ULL // Uno en cada brillo
+#define LANE_ALL           0xFFFFULL
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+static bool ISLedValid(const leds_fade_t * fade, int led) {
+    bool result = led >= LEDS_PRIMER_LED && led <= fade->bam->leds->count;
+    if (!result) {
+        Alerta("El led no es valido");
+    }
+    return result;
+}
+
+// Suma de a 16 bits sin acarreo entre brillos: los bits altos se suman aparte con un o exclusivo
+static uint64_t LanesAdd(uint64_t left, uint64_t right) {
+    return ((left & LANES_LOW) + (right & LANES_LOW)) ^ ((left ^ right) & LANES_HIGH);
+}
+
+// Todos unos en los brillos distintos de cero y ceros en los demas, sin saltos
+static uint64_t LanesNonZero(uint64_t lanes) {
+    uint64_t high = (((lanes & LANES_LOW) + LANES_LOW) | lanes) & LANES_HIGH;
+    return (high >> (LANE_BITS - 1)) * LANE_ALL;
+}
+
+static int LaneShift(int led) {
+    return ((led - LED_TO_LANE_OFFSET) % LEDS_FADE_LANES) * LANE_BITS;
+}
+
+static uint64_t * LaneWord(uint64_t * words, int led) {
+    return &words[(led - LED_TO_LANE_OFFSET) / LEDS_FADE_LANES];
+}
+
+static void LaneSet(uint64_t * words, int led, uint16_t value) {
+    uint64_t * word = LaneWord(words, led);
+    int shift = LaneShift(led);
+    *word = (*word & ~(LANE_ALL << shift)) | ((uint64_t)value << shift);
+}
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+// Brillo corregido para gamma 2.2, round(255 * (i / 255) ^ 2.2)
+static const uint8_t gamma_table[256] = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+      3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,
+      6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  11,  11,  11,  12,
+     12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,
+     20,  20,  21,  22,  22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,
+     30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,
+     42,  43,  43,  44,  45,  46,  47,  48,  49,  49,  50,  51,  52,  53,  54,  55,
+     56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+     73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,  87,  88,  89,  90,
+     91,  93,  94,  95,  97,  98,  99, 100, 102, 103, 105, 106, 107, 109, 110, 111,
+    113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+    137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+    163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+    192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+    223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255,
+};
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+bool LedsFadeInit(leds_fade_t * fade, leds_bam_t * bam) {
+
+    if (fade == NULL || bam == NULL) {
+        Alerta("Los fundidos no son validos");
+        return false;
+    }
+
+    memset(fade, 0, sizeof(*fade));
+    fade->bam = bam;
+    fade->running = true; // La primera interrupcion escribe los leds apagados
+    return true;
+}
+
+void LedsFadeStart(leds_fade_t * fade, int led, uint8_t start, uint8_t target, uint16_t ticks) {
+
+    if (!ISLedValid(fade, led))
+        return; // Evito empezar el fundido de un led invalido
+
+    int delta = (target - start) * (1 << LEVEL_FRACTION);
+    int step = (ticks == 0) ? 0 : delta / ticks;
+
+    LaneSet(fade->levels, led, (uint16_t)(start << LEVEL_FRACTION));
+    LaneSet(fade->targets, led, (uint16_t)(target << LEVEL_FRACTION));
+    LaneSet(fade->steps, led, (uint16_t)step);
+    LaneSet(fade->remaining, led, ticks);
+    fade->running = true;
+}
+
+bool LedsFadeTick(leds_fade_t * fade) {
+
+    uint8_t levels[LEDS_ULTIMO_LED];
+    int count = fade->bam->leds->count;
+    uint64_t pending = 0;
+
+    if (!fade->running)
+        return false; // Evito recalcular los cuadros si no cambio ningun brillo
+
+    for (int word = 0; word < LEDS_FADE_WORDS; word++) {
+        // Los fundidos terminados no avanzan y quedan exactamente en el brillo final
+        uint64_t active = LanesNonZero(fade->remaining[word]);
+        uint64_t level = LanesAdd(fade->levels[word], fade->steps[word] & active);
+        fade->remaining[word] -= LANES_ONES & active;
+        active = LanesNonZero(fade->remaining[word]);
+        fade->levels[word] = (level & active) | (fade->targets[word] & ~active);
+        pending |= fade->remaining[word];
+    }
+
+    for (int led = LEDS_PRIMER_LED; led <= count; led++) {
+        uint64_t level = *LaneWord(fade->levels, led) >> (LaneShift(led) + LEVEL_FRACTION);
+        levels[led - LED_TO_LANE_OFFSET] = gamma_table[level & LEVEL_MASK];
+    }
+    LedsBamSetLevels(fade->bam, levels);
+
+    fade->running = (pending != 0);
+    return fade->running;
+}
+
+uint8_t LedsFadeGetLevel(const leds_fade_t * fade, int led) {
+
+    if (!ISLedValid(fade, led))
+        return 0; // Un led invalido se considera apagado
+
+    int index = (led - LED_TO_LANE_OFFSET) / LEDS_FADE_LANES;
+    return (uint8_t)(fade->levels[index] >> (LaneShift(led) + LEVEL_FRACTION));
+}
+
+uint8_t LedsFadeGamma(uint8_t level) {
+
+    return gamma_table[level];
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
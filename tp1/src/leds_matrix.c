@@ -0,0 +1,150 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Barrido de matrices de leds multiplexadas por filas y columnas
+ **
+ ** \addtogroup leds_matrix module
+ ** \brief Matrices de leds
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "leds_matrix.h"
+#include "errores.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define LEDS_ALL_OFF      0x0000
+#define FIRST_BIT         1
+#define LED_TO_BIT_OFFSET 1
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+static leds_port_t LedsColumnsMask(const leds_matrix_t * matrix) {
+    return ((leds_port_t)FIRST_BIT << matrix->columns) - FIRST_BIT;
+}
+
+static bool ISPixelValid(const leds_matrix_t * matrix, int row, int column) {
+    bool result = row >= LEDS_PRIMER_LED && row <= matrix->rows && column >= LEDS_PRIMER_LED &&
+                  column <= matrix->columns;
+    if (!result) {
+        Alerta("El led de la matriz no es valido");
+    }
+    return result;
+}
+
+// Guarda la fila (desde 0) y precalcula su palabra del puerto
+static void LedsMatrixUpdateRow(leds_matrix_t * matrix, int row, leds_port_t columns) {
+    leds_port_t select = (leds_port_t)FIRST_BIT << (matrix->columns + row);
+    matrix->image[row] = columns & LedsColumnsMask(matrix);
+    matrix->scan[row] = (matrix->image[row] | select) ^ matrix->active_low;
+}
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+bool LedsMatrixInit(leds_matrix_t * matrix, leds_t * leds, int rows, int columns,
+                    leds_port_t active_low, bool blanking) {
+
+    if (matrix == NULL || leds == NULL || rows < 1 || columns < 1 ||
+        rows + columns > leds->count) {
+        Alerta("La matriz no es valida");
+        return false;
+    }
+
+    memset(matrix, 0, sizeof(*matrix));
+    matrix->leds = leds;
+    matrix->rows = rows;
+    matrix->columns = columns;
+    matrix->active_low = active_low;
+    matrix->blanking = blanking;
+    for (int row = 0; row < rows; row++) {
+        LedsMatrixUpdateRow(matrix, row, LEDS_ALL_OFF);
+    }
+    LedsBankWrite(leds, active_low); // Ninguna fila seleccionada
+    return true;
+}
+
+void LedsMatrixSetPixel(leds_matrix_t * matrix, int row, int column, bool on) {
+
+    if (!ISPixelValid(matrix, row, column))
+        return; // Evito cambiar un led fuera de la matriz
+
+    leds_port_t mask = (leds_port_t)FIRST_BIT << (column - LED_TO_BIT_OFFSET);
+    leds_port_t columns = matrix->image[row - LED_TO_BIT_OFFSET] & (leds_port_t)~mask;
+    LedsMatrixUpdateRow(matrix, row - LED_TO_BIT_OFFSET, columns | (on ? mask : LEDS_ALL_OFF));
+}
+
+bool LedsMatrixIsOn(const leds_matrix_t * matrix, int row, int column) {
+
+    if (!ISPixelValid(matrix, row, column))
+        return false; // Un led invalido se considera apagado
+
+    return ((matrix->image[row - LED_TO_BIT_OFFSET] >> (column - LED_TO_BIT_OFFSET)) &
+            FIRST_BIT) != LEDS_ALL_OFF;
+}
+
+void LedsMatrixSetRow(leds_matrix_t * matrix, int row, leds_port_t columns) {
+
+    if (!ISPixelValid(matrix, row, LEDS_PRIMER_LED))
+        return; // Evito cambiar una fila fuera de la matriz
+
+    LedsMatrixUpdateRow(matrix, row - LED_TO_BIT_OFFSET, columns);
+}
+
+int LedsMatrixWriteImage(leds_matrix_t * matrix, const leds_port_t * image) {
+
+    int changed = 0;
+
+    for (int row = 0; row < matrix->rows; row++) {
+        leds_port_t columns = image[row] & LedsColumnsMask(matrix);
+        if (columns != matrix->image[row]) {
+            LedsMatrixUpdateRow(matrix, row, columns);
+            changed++;
+        }
+    }
+    return changed;
+}
+
+void LedsMatrixTick(leds_matrix_t * matrix) {
+
+    if (matrix->blanking) {
+        LedsBankWrite(matrix->leds, matrix->active_low); // Ninguna fila ni columna activa
+    }
+    LedsBankWrite(matrix->leds, matrix->scan[matrix->row]);
+    matrix->row = (matrix->row + 1 == matrix->rows) ? 0 : matrix->row + 1;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
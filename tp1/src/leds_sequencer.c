@@ -0,0 +1,208 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Secuenciador de patrones de leds con doble buffer
+ **
+ ** \addtogroup leds_sequencer module
+ ** \brief Secuenciador de patrones
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "leds_sequencer.h"
+#include "errores.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define LEDS_ALL_OFF 0x0000
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+static int LedsPatternSize(const leds_pattern_t * pattern) {
+    int size = 0;
+    switch (pattern->kind) {
+    case LEDS_PATRON_FIJO:
+        size = 1;
+        break;
+    case LEDS_PATRON_PARPADEO:
+        size = 2;
+        break;
+    case LEDS_PATRON_BARRIDO:
+    case LEDS_PATRON_LLENADO:
+        size = __builtin_popcountll(pattern->mask);
+        break;
+    }
+    return size;
+}
+
+static bool ISPatternValid(const leds_pattern_t * pattern) {
+    bool result = pattern->duration > 0 && pattern->repeat > 0 && LedsPatternSize(pattern) > 0;
+    if (!result) {
+        Alerta("El patron no es valido");
+    }
+    return result;
+}
+
+// Genera los cuadros de una repeticion del patron y devuelve cuantos son
+static int LedsPatternEmit(const leds_pattern_t * pattern, leds_frame_t * frames) {
+    leds_port_t pending = pattern->mask;
+    leds_port_t filled = LEDS_ALL_OFF;
+    int count = 0;
+
+    switch (pattern->kind) {
+    case LEDS_PATRON_FIJO:
+        frames[count++] = (leds_frame_t){pattern->mask, pattern->duration};
+        break;
+    case LEDS_PATRON_PARPADEO:
+        frames[count++] = (leds_frame_t){pattern->mask, pattern->duration};
+        frames[count++] = (leds_frame_t){LEDS_ALL_OFF, pattern->duration};
+        break;
+    case LEDS_PATRON_BARRIDO:
+    case LEDS_PATRON_LLENADO:
+        // Los leds de la mascara de menor a mayor, aislando el bit mas bajo en cada paso
+        while (pending != LEDS_ALL_OFF) {
+            leds_port_t lowest = pending & (leds_port_t)(~pending + 1);
+            filled |= lowest;
+            pending &= (leds_port_t)~lowest;
+            leds_port_t state = (pattern->kind == LEDS_PATRON_BARRIDO) ? lowest : filled;
+            frames[count++] = (leds_frame_t){state, pattern->duration};
+        }
+        break;
+    }
+    return count;
+}
+
+static void LedsSequencerShow(leds_sequencer_t * sequencer) {
+    const leds_frame_t * frame = &sequencer->buffers[sequencer->front][sequencer->step];
+    LedsBankWrite(sequencer->leds, frame->state);
+    sequencer->remaining = frame->duration;
+}
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+int LedsPatternCompile(const leds_pattern_t * patterns, int count, leds_frame_t * frames,
+                       int capacity) {
+
+    int total = 0;
+
+    for (int index = 0; index < count; index++) {
+        const leds_pattern_t * pattern = &patterns[index];
+        if (!ISPatternValid(pattern))
+            return 0; // No se entrega una secuencia incompleta
+
+        // Dividir en lugar de multiplicar: size * repeat puede desbordar un int
+        int size = LedsPatternSize(pattern);
+        if (pattern->repeat > (capacity - total) / size) {
+            Alerta("Los cuadros no entran en el buffer");
+            return 0;
+        }
+
+        LedsPatternEmit(pattern, &frames[total]);
+        for (int copy = 1; copy < pattern->repeat; copy++) {
+            memcpy(&frames[total + copy * size], &frames[total], (size_t)size * sizeof(*frames));
+        }
+        total += size * pattern->repeat;
+    }
+    return total;
+}
+
+bool LedsSequencerInit(leds_sequencer_t * sequencer, leds_t * leds, leds_frame_t * buffers,
+                       int capacity) {
+
+    if (sequencer == NULL || leds == NULL || buffers == NULL || capacity < 1) {
+        Alerta("El secuenciador no es valido");
+        return false;
+    }
+
+    memset(sequencer, 0, sizeof(*sequencer));
+    sequencer->leds = leds;
+    sequencer->buffers[0] = buffers;
+    sequencer->buffers[1] = buffers + capacity;
+    sequencer->capacity = capacity;
+    atomic_init(&sequencer->pending, false);
+    LedsBankWrite(leds, LEDS_ALL_OFF);
+    return true;
+}
+
+leds_frame_t * LedsSequencerBack(leds_sequencer_t * sequencer) {
+
+    // La interrupcion solo cambia front mientras hay una entrega pendiente
+    if (atomic_load_explicit(&sequencer->pending, memory_order_acquire))
+        return NULL;
+
+    return sequencer->buffers[1 - sequencer->front];
+}
+
+bool LedsSequencerSubmit(leds_sequencer_t * sequencer, int count, bool repeat) {
+
+    if (count < 1 || count > sequencer->capacity) {
+        Alerta("La secuencia no es valida");
+        return false;
+    }
+    if (atomic_load_explicit(&sequencer->pending, memory_order_acquire))
+        return false; // La entrega anterior todavia no empezo
+
+    int back = 1 - sequencer->front;
+    sequencer->counts[back] = count;
+    sequencer->repeats[back] = repeat;
+    // Los cuadros y la cantidad quedan visibles para la interrupcion antes que la marca
+    atomic_store_explicit(&sequencer->pending, true, memory_order_release);
+    return true;
+}
+
+void LedsSequencerTick(leds_sequencer_t * sequencer) {
+
+    if (sequencer->remaining > 1) {
+        sequencer->remaining--;
+        return; // El cuadro actual sigue, no hay nada que escribir
+    }
+
+    if (atomic_load_explicit(&sequencer->pending, memory_order_acquire)) {
+        sequencer->front = 1 - sequencer->front;
+        sequencer->step = 0;
+        atomic_store_explicit(&sequencer->pending, false, memory_order_release);
+    } else if (sequencer->step + 1 < sequencer->counts[sequencer->front]) {
+        sequencer->step++;
+    } else if (sequencer->repeats[sequencer->front]) {
+        sequencer->step = 0;
+    } else {
+        sequencer->remaining = 0; // Sin secuencia, o queda mostrando su ultimo cuadro
+        return;
+    }
+    LedsSequencerShow(sequencer);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -37,6 +37,20 @@ SPDX-License-Identifier: MIT
  ** - Consultar el estado de un led apagado fuera de rango
  ** - Apagar algunos leds mas de una vez y verificar que siguen apagados
  ** - Prender los leds extremos y apagarlos
+ ** - Prender y apagar varios leds con una sola aplicacion de mascaras
+ ** - Aplicar la misma mascara para prender y apagar y verificar que el led queda prendido
+ ** - Escribir el estado completo de los leds y consultarlo
+ ** - Modificar el puerto desde afuera y verificar que el driver no lo lee
+ ** - Crear dos bancos y verificar que cada uno maneja solo su puerto
+ ** - Prender un led fuera de la cantidad del banco y comprobar que se genera un error
+ ** - Prender todos los leds de un banco parcial sin tocar los bits libres del puerto
+ ** - Crear mas bancos que el tamano del pool y comprobar que se genera un error
+ ** - Escribir, prender y apagar todos los bancos en una sola pasada
+ ** - Contar los leds prendidos y recorrerlos del primero al ultimo
+ ** - Prender y apagar un rango de leds con una sola escritura
+ ** - Prender un rango de leds invalido y comprobar que se genera un error
+ ** - Prender y apagar leds constantes de un banco validados al compilar
+ ** - Prender un led constante fuera de la cantidad del banco y verificar que se ignora
  **
  ** \addtogroup name Module denomination
  ** \brief Brief description of the module
@@ -57,6 +71,8 @@ SPDX-License-Identifier: MIT
 /* === Private variable declarations =========================================================== */
 
 static uint16_t port;
+static uint16_t ports[3];
+static leds_t pool[2];
 
 /* === Private function declarations =========================================================== */
 
@@ -202,6 +218,195 @@ void test_prender_los_leds_extremos_y_apagarlos(void) {
     TEST_ASSERT_EQUAL_HEX16(0x0000, port);
 }
 
+void test_prender_y_apagar_varios_leds_con_una_sola_aplicacion_de_mascaras(void) {
+
+    LedsTurnOn(2);
+    LedsTurnOn(9);
+    LedsApply((1 << 0) | (1 << 11), (1 << 1) | (1 << 4));
+    TEST_ASSERT_EQUAL_HEX16((1 << 0) | (1 << 8) | (1 << 11), port);
+    TEST_ASSERT_TRUE(LedsIsOn(12));
+    TEST_ASSERT_TRUE(LedsIsOff(2));
+}
+
+void test_aplicar_la_misma_mascara_para_prender_y_apagar_y_verificar_que_el_led_queda_prendido(void) {
+
+    LedsApply(1 << 6, 1 << 6);
+    TEST_ASSERT_EQUAL_HEX16(1 << 6, port);
+}
+
+void test_escribir_el_estado_completo_de_los_leds_y_consultarlo(void) {
+
+    LedsWrite(0xA5C3);
+    TEST_ASSERT_EQUAL_HEX16(0xA5C3, port);
+    TEST_ASSERT_EQUAL_HEX16(0xA5C3, LedsState());
+    TEST_ASSERT_TRUE(LedsIsOn(1));
+    TEST_ASSERT_TRUE(LedsIsOff(3));
+}
+
+void test_modificar_el_puerto_desde_afuera_y_verificar_que_el_driver_no_lo_lee(void) {
+
+    LedsTurnOn(4);
+    port = 0xFFFF; // Simula un registro de solo escritura que devuelve basura al leerlo
+    TEST_ASSERT_TRUE(LedsIsOff(5));
+    LedsTurnOn(5);
+    TEST_ASSERT_EQUAL_HEX16((1 << 3) | (1 << 4), port);
+}
+
+void test_crear_dos_bancos_y_verificar_que_cada_uno_maneja_solo_su_puerto(void) {
+
+    LedsPoolInit(pool, 2);
+    leds_t * first = LedsCreate(&ports[0], 16);
+    leds_t * second = LedsCreate(&ports[1], 16);
+    TEST_ASSERT_NOT_NULL(first);
+    TEST_ASSERT_NOT_NULL(second);
+
+    LedsBankTurnOn(first, 3);
+    LedsBankTurnOn(second, 7);
+    LedsBankTurnOff(first, 3);
+    LedsTurnOn(1);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, ports[0]);
+    TEST_ASSERT_EQUAL_HEX16(1 << 6, ports[1]);
+    TEST_ASSERT_EQUAL_HEX16(1 << 0, port);
+    TEST_ASSERT_TRUE(LedsBankIsOn(second, 7));
+    TEST_ASSERT_TRUE(LedsBankIsOff(first, 3));
+}
+
+void test_prender_un_led_fuera_de_la_cantidad_del_banco_y_comprobar_que_se_genera_un_error(void) {
+
+    LedsPoolInit(pool, 2);
+    leds_t * leds = LedsCreate(&ports[0], 8);
+
+    RegistrarMensaje_ExpectAnyArgs();
+    LedsBankTurnOn(leds, 9);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, ports[0]);
+
+    RegistrarMensaje_ExpectAnyArgs();
+    TEST_ASSERT_FALSE(LedsBankIsOn(leds, 9));
+}
+
+void test_prender_todos_los_leds_de_un_banco_parcial_sin_tocar_los_bits_libres_del_puerto(void) {
+
+    LedsPoolInit(pool, 2);
+    leds_t * leds = LedsCreate(&ports[0], 5);
+
+    LedsBankTurnOnAll(leds);
+    TEST_ASSERT_EQUAL_HEX16(0x001F, ports[0]);
+    LedsBankWrite(leds, 0xFFF0);
+    TEST_ASSERT_EQUAL_HEX16(0x0010, ports[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x0010, LedsBankState(leds));
+}
+
+void test_crear_mas_bancos_que_el_tamano_del_pool_y_comprobar_que_se_genera_un_error(void) {
+
+    LedsPoolInit(pool, 2);
+    TEST_ASSERT_NOT_NULL(LedsCreate(&ports[0], 16));
+    TEST_ASSERT_NOT_NULL(LedsCreate(&ports[1], 16));
+
+    RegistrarMensaje_ExpectAnyArgs();
+    TEST_ASSERT_NULL(LedsCreate(&ports[2], 16));
+
+    RegistrarMensaje_ExpectAnyArgs();
+    RegistrarMensaje_ExpectAnyArgs();
+    LedsPoolInit(pool, 2);
+    TEST_ASSERT_NULL(LedsCreate(&ports[2], 17));
+    TEST_ASSERT_NULL(LedsCreate(NULL, 16));
+    TEST_ASSERT_EQUAL(0, LedsBanksCount());
+}
+
+void test_escribir_prender_y_apagar_todos_los_bancos_en_una_sola_pasada(void) {
+
+    const uint16_t states[] = {0x1234, 0x00FF};
+
+    LedsPoolInit(pool, 2);
+    leds_t * first = LedsCreate(&ports[0], 16);
+    LedsCreate(&ports[1], 4);
+    TEST_ASSERT_EQUAL(2, LedsBanksCount());
+
+    LedsBanksWrite(states);
+    TEST_ASSERT_EQUAL_HEX16(0x1234, ports[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x000F, ports[1]);
+
+    LedsBanksTurnOnAll();
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, ports[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x000F, ports[1]);
+
+    LedsBanksTurnOffAll();
+    TEST_ASSERT_EQUAL_HEX16(0x0000, ports[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, ports[1]);
+
+    LedsBankTurnOn(first, 2);
+    ports[0] = 0xFFFF;
+    LedsBanksRefresh();
+    TEST_ASSERT_EQUAL_HEX16(1 << 1, ports[0]);
+}
+
+void test_contar_los_leds_prendidos_y_recorrerlos_del_primero_al_ultimo(void) {
+
+    const int expected[] = {1, 6, 7, 16};
+    int index = 0;
+
+    TEST_ASSERT_EQUAL(0, LedsCountOn());
+    TEST_ASSERT_EQUAL(LEDS_NINGUNO, LedsFirstOn());
+
+    LedsWrite((1 << 0) | (1 << 5) | (1 << 6) | (1 << 15));
+    TEST_ASSERT_EQUAL(4, LedsCountOn());
+    for (int led = LedsFirstOn(); led != LEDS_NINGUNO; led = LedsNextOn(led)) {
+        TEST_ASSERT_EQUAL(expected[index++], led);
+    }
+    TEST_ASSERT_EQUAL(4, index);
+    TEST_ASSERT_EQUAL(7, LedsNextOn(6));
+}
+
+void test_prender_y_apagar_un_rango_de_leds_con_una_sola_escritura(void) {
+
+    LedsTurnOnRange(4, 9);
+    TEST_ASSERT_EQUAL_HEX16(0x01F8, port);
+    LedsTurnOffRange(5, 6);
+    TEST_ASSERT_EQUAL_HEX16(0x01C8, port);
+    LedsTurnOnRange(1, 16);
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, port);
+}
+
+void test_prender_un_rango_de_leds_invalido_y_comprobar_que_se_genera_un_error(void) {
+
+    RegistrarMensaje_ExpectAnyArgs();
+    LedsTurnOnRange(0, 3);
+    RegistrarMensaje_ExpectAnyArgs();
+    LedsTurnOnRange(9, 17);
+    RegistrarMensaje_ExpectAnyArgs();
+    LedsTurnOffRange(5, 4);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, port);
+}
+
+void test_prender_y_apagar_leds_constantes_de_un_banco_validados_al_compilar(void) {
+
+    LedsPoolInit(pool, 2);
+    leds_t * leds = LedsCreate(&ports[0], LEDS_ULTIMO_LED);
+
+    LEDS_BANK_TURN_ON(leds, 1);
+    LEDS_BANK_TURN_ON(leds, 16);
+    LEDS_BANK_TURN_ON(leds, 7);
+    TEST_ASSERT_EQUAL_HEX16(0x8041, ports[0]);
+    TEST_ASSERT_TRUE(LEDS_BANK_IS_ON(leds, 7));
+    TEST_ASSERT_FALSE(LEDS_BANK_IS_ON(leds, 8));
+
+    LEDS_BANK_TURN_OFF(leds, 16);
+    TEST_ASSERT_EQUAL_HEX16(0x0041, ports[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x0041, LedsBankState(leds));
+    TEST_ASSERT_TRUE(LedsBankIsOn(leds, 1));
+}
+
+void test_prender_un_led_constante_fuera_de_la_cantidad_del_banco_y_verificar_que_se_ignora(void) {
+
+    LedsPoolInit(pool, 2);
+    leds_t * leds = LedsCreate(&ports[1], 10);
+
+    LEDS_BANK_TURN_ON(leds, 11);
+    LEDS_BANK_TURN_ON(leds, 10);
+    TEST_ASSERT_EQUAL_HEX16(0x0200, ports[1]);
+    TEST_ASSERT_FALSE(LEDS_BANK_IS_ON(leds, 11));
+}
+
 /* === End of documentation ==================================================================== */
 
 /** @} End of module definition for doxygen */
@@ -0,0 +1,170 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo de arreglos de leds
+ **
+ ** Pruebas a realizar:
+ ** - Iniciar un arreglo y revisar que todos los leds esten apagados
+ ** - Prender y apagar leds de distintas palabras y consultar su estado
+ ** - Prender y apagar un rango que cruza varias palabras
+ ** - Contar los leds prendidos y recorrerlos del primero al ultimo
+ ** - Copiar el estado del arreglo
+ ** - Usar leds y rangos fuera del arreglo y comprobar que se genera un error
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "leds_array.h"
+#include "errores.h"
+#include "mock_errores.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define LEDS_COUNT 100
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+static leds_port_t words[LEDS_ARRAY_WORDS(LEDS_COUNT)];
+static leds_array_t array;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+    memset(words, 0xFF, sizeof(words));
+    TEST_ASSERT_TRUE(LedsArrayInit(&array, words, LEDS_COUNT));
+}
+
+void tearDown(void) {
+}
+
+void test_iniciar_un_arreglo_y_revisar_que_todos_los_leds_esten_apagados(void) {
+
+    for (size_t word = 0; word < LEDS_ARRAY_WORDS(LEDS_COUNT); word++) {
+        TEST_ASSERT_EQUAL(0, words[word]);
+    }
+    TEST_ASSERT_EQUAL(0, LedsArrayCountOn(&array));
+    TEST_ASSERT_EQUAL(LEDS_NINGUNO, LedsArrayFirstOn(&array));
+}
+
+void test_prender_y_apagar_leds_de_distintas_palabras_y_consultar_su_estado(void) {
+
+    LedsArrayTurnOn(&array, 1);
+    LedsArrayTurnOn(&array, 50);
+    LedsArrayTurnOn(&array, 100);
+    LedsArrayTurnOff(&array, 50);
+
+    TEST_ASSERT_TRUE(LedsArrayIsOn(&array, 1));
+    TEST_ASSERT_FALSE(LedsArrayIsOn(&array, 50));
+    TEST_ASSERT_TRUE(LedsArrayIsOn(&array, 100));
+    TEST_ASSERT_FALSE(LedsArrayIsOn(&array, 99));
+    TEST_ASSERT_EQUAL(2, LedsArrayCountOn(&array));
+}
+
+void test_prender_y_apagar_un_rango_que_cruza_varias_palabras(void) {
+
+    LedsArrayTurnOnRange(&array, 10, 90);
+    TEST_ASSERT_EQUAL(81, LedsArrayCountOn(&array));
+    TEST_ASSERT_FALSE(LedsArrayIsOn(&array, 9));
+    TEST_ASSERT_TRUE(LedsArrayIsOn(&array, 10));
+    TEST_ASSERT_TRUE(LedsArrayIsOn(&array, 90));
+    TEST_ASSERT_FALSE(LedsArrayIsOn(&array, 91));
+
+    LedsArrayTurnOffRange(&array, 20, 80);
+    TEST_ASSERT_EQUAL(20, LedsArrayCountOn(&array));
+    TEST_ASSERT_TRUE(LedsArrayIsOn(&array, 19));
+    TEST_ASSERT_FALSE(LedsArrayIsOn(&array, 20));
+    TEST_ASSERT_FALSE(LedsArrayIsOn(&array, 80));
+    TEST_ASSERT_TRUE(LedsArrayIsOn(&array, 81));
+
+    LedsArrayTurnOnRange(&array, 1, LEDS_COUNT);
+    TEST_ASSERT_EQUAL(LEDS_COUNT, LedsArrayCountOn(&array));
+}
+
+void test_contar_los_leds_prendidos_y_recorrerlos_del_primero_al_ultimo(void) {
+
+    const int expected[] = {3, 16, 17, 64, 65, 100};
+    int index = 0;
+
+    for (size_t led = 0; led < sizeof(expected) / sizeof(expected[0]); led++) {
+        LedsArrayTurnOn(&array, expected[led]);
+    }
+
+    TEST_ASSERT_EQUAL(6, LedsArrayCountOn(&array));
+    for (int led = LedsArrayFirstOn(&array); led != LEDS_NINGUNO;
+         led = LedsArrayNextOn(&array, led)) {
+        TEST_ASSERT_EQUAL(expected[index++], led);
+    }
+    TEST_ASSERT_EQUAL(6, index);
+    TEST_ASSERT_EQUAL(64, LedsArrayNextOn(&array, 20));
+}
+
+void test_copiar_el_estado_del_arreglo(void) {
+
+    leds_port_t copy[LEDS_ARRAY_WORDS(LEDS_COUNT)];
+    leds_array_t saved = {copy, LEDS_COUNT};
+
+    LedsArrayTurnOnRange(&array, 30, 40);
+    LedsArraySnapshot(&array, copy);
+    LedsArrayTurnOffRange(&array, 1, LEDS_COUNT);
+
+    TEST_ASSERT_EQUAL(0, LedsArrayCountOn(&array));
+    TEST_ASSERT_EQUAL(11, LedsArrayCountOn(&saved));
+    TEST_ASSERT_EQUAL(30, LedsArrayFirstOn(&saved));
+}
+
+void test_usar_leds_y_rangos_fuera_del_arreglo_y_comprobar_que_se_genera_un_error(void) {
+
+    RegistrarMensaje_ExpectAnyArgs();
+    LedsArrayTurnOn(&array, LEDS_COUNT + 1);
+    RegistrarMensaje_ExpectAnyArgs();
+    LedsArrayTurnOff(&array, 0);
+    RegistrarMensaje_ExpectAnyArgs();
+    TEST_ASSERT_FALSE(LedsArrayIsOn(&array, LEDS_COUNT + 1));
+    RegistrarMensaje_ExpectAnyArgs();
+    LedsArrayTurnOnRange(&array, 90, LEDS_COUNT + 1);
+    RegistrarMensaje_ExpectAnyArgs();
+    TEST_ASSERT_EQUAL(LEDS_NINGUNO, LedsArrayNextOn(&array, LEDS_COUNT + 1));
+    RegistrarMensaje_ExpectAnyArgs();
+    TEST_ASSERT_FALSE(LedsArrayInit(&array, NULL, LEDS_COUNT));
+
+    TEST_ASSERT_EQUAL(0, LedsArrayCountOn(&array));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,153 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modo atomico del modulo de leds
+ **
+ ** Se compila con LEDS_ATOMIC (ver project.yml).
+ **
+ ** Pruebas a realizar:
+ ** - Prender y apagar leds desde varios hilos y verificar que no se pierden actualizaciones
+ ** - Aplicar mascaras desde varios hilos y verificar que no se pierden actualizaciones
+ ** - Escribir el estado de un banco parcial y verificar que el puerto refleja la copia
+ ** - Prender y apagar leds constantes validados al compilar y verificar el puerto
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "leds.h"
+#include "errores.h"
+#include "mock_errores.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define THREADS    4
+#define ITERATIONS 20000
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+static uint16_t port;
+static leds_t pool[1];
+static leds_t * leds;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+// Cada hilo maneja los leds index + 1, index + 1 + THREADS, ... y termina con todos prendidos
+static void * TurnOnOffWorker(void * arg) {
+
+    int index = (int)(intptr_t)arg;
+
+    for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+        for (int led = index + 1; led <= LEDS_ULTIMO_LED; led += THREADS) {
+            LedsBankTurnOff(leds, led);
+            LedsBankTurnOn(leds, led);
+        }
+    }
+    return NULL;
+}
+
+static void * ApplyWorker(void * arg) {
+
+    int index = (int)(intptr_t)arg;
+    uint16_t own = (uint16_t)(0x1111 << index);
+
+    for (int iteration = 0; iteration < ITERATIONS; iteration++) {
+        LedsBankApply(leds, 0, own);
+        LedsBankApply(leds, own, 0);
+    }
+    return NULL;
+}
+
+static void RunThreads(void * (*worker)(void *)) {
+
+    pthread_t threads[THREADS];
+
+    for (int index = 0; index < THREADS; index++) {
+        TEST_ASSERT_EQUAL(0, pthread_create(&threads[index], NULL, worker, (void *)(intptr_t)index));
+    }
+    for (int index = 0; index < THREADS; index++) {
+        pthread_join(threads[index], NULL);
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+    LedsPoolInit(pool, 1);
+    leds = LedsCreate(&port, LEDS_ULTIMO_LED);
+}
+
+void tearDown(void) {
+}
+
+void test_prender_y_apagar_leds_desde_varios_hilos_y_verificar_que_no_se_pierden_actualizaciones(void) {
+
+    RunThreads(TurnOnOffWorker);
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, LedsBankState(leds));
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, port);
+}
+
+void test_aplicar_mascaras_desde_varios_hilos_y_verificar_que_no_se_pierden_actualizaciones(void) {
+
+    RunThreads(ApplyWorker);
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, LedsBankState(leds));
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, port);
+}
+
+void test_escribir_el_estado_de_un_banco_parcial_y_verificar_que_el_puerto_refleja_la_copia(void) {
+
+    LedsPoolInit(pool, 1);
+    leds = LedsCreate(&port, 12);
+
+    LedsBankWrite(leds, 0xFFFF);
+    TEST_ASSERT_EQUAL_HEX16(0x0FFF, port);
+    LedsBankTurnOff(leds, 12);
+    TEST_ASSERT_EQUAL_HEX16(0x07FF, port);
+    TEST_ASSERT_EQUAL_HEX16(0x07FF, LedsBankState(leds));
+}
+
+void test_prender_y_apagar_leds_constantes_validados_al_compilar_y_verificar_el_puerto(void) {
+
+    LEDS_BANK_TURN_ON(leds, 3);
+    LEDS_BANK_TURN_ON(leds, 16);
+    LEDS_BANK_TURN_OFF(leds, 3);
+    TEST_ASSERT_EQUAL_HEX16(0x8000, port);
+    TEST_ASSERT_TRUE(LEDS_BANK_IS_ON(leds, 16));
+    TEST_ASSERT_FALSE(LEDS_BANK_IS_ON(leds, 3));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
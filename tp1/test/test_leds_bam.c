@@ -0,0 +1,184 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo de brillo por modulacion de angulo de bit
+ **
+ ** Pruebas a realizar:
+ ** - Iniciar el modulador y revisar que todos los leds esten apagados
+ ** - Verificar que un ciclo son 8 interrupciones y dura 255 unidades de tiempo
+ ** - Simular un ciclo y verificar que cada led esta prendido tantas unidades como su brillo
+ ** - Cambiar todos los brillos juntos y verificar que los cuadros son los de cambiarlos de a uno
+ ** - Cambiar los brillos de un banco parcial sin tocar los bits libres del puerto
+ ** - Cambiar el brillo de un led fuera de rango y comprobar que se genera un error
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "leds.h"
+#include "leds_bam.h"
+#include "errores.h"
+#include "mock_errores.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+static leds_port_t port;
+static leds_t pool[2];
+static leds_t * leds;
+static leds_bam_t bam;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+// Ejecuta un ciclo completo y acumula el tiempo que cada led estuvo prendido
+static int SimulateCycle(int on_time[LEDS_ULTIMO_LED]) {
+
+    int elapsed = 0;
+
+    memset(on_time, 0, LEDS_ULTIMO_LED * sizeof(int));
+    for (int tick = 0; tick < LEDS_BAM_BITS; tick++) {
+        int duration = LedsBamTick(&bam);
+        for (int led = 0; led < LEDS_ULTIMO_LED; led++) {
+            on_time[led] += ((port >> led) & 1) * duration;
+        }
+        elapsed += duration;
+    }
+    return elapsed;
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+    LedsPoolInit(pool, 2);
+    leds = LedsCreate(&port, LEDS_ULTIMO_LED);
+    TEST_ASSERT_TRUE(LedsBamInit(&bam, leds));
+}
+
+void tearDown(void) {
+}
+
+void test_iniciar_el_modulador_y_revisar_que_todos_los_leds_esten_apagados(void) {
+
+    port = 0xFFFF;
+    TEST_ASSERT_TRUE(LedsBamInit(&bam, leds));
+    TEST_ASSERT_EQUAL_HEX16(0x0000, port);
+    TEST_ASSERT_EQUAL(0, LedsBamGetLevel(&bam, 16));
+
+    LedsBamTick(&bam);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, port);
+}
+
+void test_verificar_que_un_ciclo_son_8_interrupciones_y_dura_255_unidades_de_tiempo(void) {
+
+    const int expected[] = {1, 2, 4, 8, 16, 32, 64, 128, 1};
+
+    for (size_t tick = 0; tick < sizeof(expected) / sizeof(expected[0]); tick++) {
+        TEST_ASSERT_EQUAL(expected[tick], LedsBamTick(&bam));
+    }
+}
+
+void test_simular_un_ciclo_y_verificar_que_cada_led_esta_prendido_tanto_como_su_brillo(void) {
+
+    const uint8_t levels[] = {0, 1, 2, 77, 128, 129, 200, 254, 255};
+    int on_time[LEDS_ULTIMO_LED];
+
+    for (size_t led = 0; led < sizeof(levels); led++) {
+        LedsBamSetLevel(&bam, (int)led + 1, levels[led]);
+    }
+
+    TEST_ASSERT_EQUAL(LEDS_BAM_PERIOD, SimulateCycle(on_time));
+    for (size_t led = 0; led < sizeof(levels); led++) {
+        TEST_ASSERT_EQUAL(levels[led], on_time[led]);
+        TEST_ASSERT_EQUAL(levels[led], LedsBamGetLevel(&bam, (int)led + 1));
+    }
+    TEST_ASSERT_EQUAL(0, on_time[LEDS_ULTIMO_LED - 1]);
+
+    LedsBamSetLevel(&bam, 4, 10);
+    TEST_ASSERT_EQUAL(LEDS_BAM_PERIOD, SimulateCycle(on_time));
+    TEST_ASSERT_EQUAL(10, on_time[3]);
+    TEST_ASSERT_EQUAL(128, on_time[4]);
+}
+
+void test_cambiar_todos_los_brillos_juntos_y_verificar_que_los_cuadros_son_los_de_a_uno(void) {
+
+    uint8_t levels[LEDS_ULTIMO_LED];
+    leds_port_t frames[LEDS_BAM_BITS];
+    uint32_t seed = 0x12345678;
+
+    for (int led = 0; led < LEDS_ULTIMO_LED; led++) {
+        seed = seed * 1103515245 + 12345;
+        levels[led] = (uint8_t)(seed >> 16);
+        LedsBamSetLevel(&bam, led + 1, levels[led]);
+    }
+    memcpy(frames, bam.frames, sizeof(frames));
+
+    TEST_ASSERT_TRUE(LedsBamInit(&bam, leds));
+    LedsBamSetLevels(&bam, levels);
+    TEST_ASSERT_EQUAL_MEMORY(frames, bam.frames, sizeof(frames));
+    TEST_ASSERT_EQUAL_MEMORY(levels, bam.levels, sizeof(levels));
+}
+
+void test_cambiar_los_brillos_de_un_banco_parcial_sin_tocar_los_bits_libres_del_puerto(void) {
+
+    static leds_port_t partial_port;
+    uint8_t levels[LEDS_ULTIMO_LED];
+
+    memset(levels, 0xFF, sizeof(levels));
+    leds = LedsCreate(&partial_port, 10);
+    TEST_ASSERT_TRUE(LedsBamInit(&bam, leds));
+    LedsBamSetLevels(&bam, levels);
+
+    for (int tick = 0; tick < LEDS_BAM_BITS; tick++) {
+        LedsBamTick(&bam);
+        TEST_ASSERT_EQUAL_HEX16(0x03FF, partial_port);
+    }
+}
+
+void test_cambiar_el_brillo_de_un_led_fuera_de_rango_y_comprobar_que_se_genera_un_error(void) {
+
+    RegistrarMensaje_ExpectAnyArgs();
+    LedsBamSetLevel(&bam, 0, 100);
+    RegistrarMensaje_ExpectAnyArgs();
+    LedsBamSetLevel(&bam, LEDS_ULTIMO_LED + 1, 100);
+    RegistrarMensaje_ExpectAnyArgs();
+    TEST_ASSERT_EQUAL(0, LedsBamGetLevel(&bam, LEDS_ULTIMO_LED + 1));
+    RegistrarMensaje_ExpectAnyArgs();
+    TEST_ASSERT_FALSE(LedsBamInit(&bam, NULL));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,178 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Fichero de pruebas unitarias del modulo de fundidos de brillo
+ **
+ ** Pruebas a realizar:
+ ** - Iniciar los fundidos y revisar que todos los leds esten apagados
+ ** - Fundir un led de 0 a 255 en 255 interrupciones y verificar el brillo en cada una
+ ** - Fundir varios leds con distinta duracion y sentido y verificar que terminan en el final
+ ** - Verificar que el modulador recibe el brillo con la correccion gamma
+ ** - Empezar un fundido de duracion cero y verificar que cambia en la proxima interrupcion
+ ** - Verificar que la tabla gamma es creciente y va de 0 a 255
+ ** - Empezar el fundido de un led fuera de rango y comprobar que se genera un error
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "leds.h"
+#include "leds_bam.h"
+#include "leds_fade.h"
+#include "errores.h"
+#include "mock_errores.h"
+
+#include <stdbool.h>
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+static leds_port_t port;
+static leds_t pool[1];
+static leds_bam_t bam;
+static leds_fade_t fade;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+    LedsPoolInit(pool, 1);
+    TEST_ASSERT_TRUE(LedsBamInit(&bam, LedsCreate(&port, LEDS_ULTIMO_LED)));
+    TEST_ASSERT_TRUE(LedsFadeInit(&fade, &bam));
+}
+
+void tearDown(void) {
+}
+
+void test_iniciar_los_fundidos_y_revisar_que_todos_los_leds_esten_apagados(void) {
+
+    LedsBamSetLevel(&bam, 3, 200);
+
+    TEST_ASSERT_FALSE(LedsFadeTick(&fade));
+    for (int led = LEDS_PRIMER_LED; led <= LEDS_ULTIMO_LED; led++) {
+        TEST_ASSERT_EQUAL(0, LedsFadeGetLevel(&fade, led));
+        TEST_ASSERT_EQUAL(0, LedsBamGetLevel(&bam, led));
+    }
+    TEST_ASSERT_FALSE(LedsFadeTick(&fade));
+}
+
+void test_fundir_un_led_de_0_a_255_en_255_interrupciones_y_verificar_cada_brillo(void) {
+
+    LedsFadeStart(&fade, 5, 0, 255, 255);
+    TEST_ASSERT_EQUAL(0, LedsFadeGetLevel(&fade, 5));
+
+    for (int tick = 1; tick < 255; tick++) {
+        TEST_ASSERT_TRUE(LedsFadeTick(&fade));
+        TEST_ASSERT_EQUAL(tick, LedsFadeGetLevel(&fade, 5));
+    }
+    TEST_ASSERT_FALSE(LedsFadeTick(&fade));
+    TEST_ASSERT_EQUAL(255, LedsFadeGetLevel(&fade, 5));
+    TEST_ASSERT_EQUAL(0, LedsFadeGetLevel(&fade, 4));
+    TEST_ASSERT_EQUAL(0, LedsFadeGetLevel(&fade, 6));
+}
+
+void test_fundir_varios_leds_con_distinta_duracion_y_verificar_que_terminan_en_el_final(void) {
+
+    LedsFadeStart(&fade, 1, 255, 0, 7);
+    LedsFadeStart(&fade, 4, 10, 200, 3);
+    LedsFadeStart(&fade, 5, 100, 101, 1000);
+    LedsFadeStart(&fade, LEDS_ULTIMO_LED, 200, 13, 11);
+
+    for (int tick = 1; tick <= 999; tick++) {
+        TEST_ASSERT_TRUE(LedsFadeTick(&fade));
+        if (tick == 3) {
+            TEST_ASSERT_EQUAL(200, LedsFadeGetLevel(&fade, 4));
+        }
+        if (tick == 6) {
+            TEST_ASSERT_GREATER_THAN(0, LedsFadeGetLevel(&fade, 1));
+            TEST_ASSERT_LESS_THAN(255, LedsFadeGetLevel(&fade, 1));
+        }
+    }
+    TEST_ASSERT_EQUAL(100, LedsFadeGetLevel(&fade, 5));
+    TEST_ASSERT_FALSE(LedsFadeTick(&fade));
+
+    TEST_ASSERT_EQUAL(0, LedsFadeGetLevel(&fade, 1));
+    TEST_ASSERT_EQUAL(200, LedsFadeGetLevel(&fade, 4));
+    TEST_ASSERT_EQUAL(101, LedsFadeGetLevel(&fade, 5));
+    TEST_ASSERT_EQUAL(13, LedsFadeGetLevel(&fade, LEDS_ULTIMO_LED));
+}
+
+void test_verificar_que_el_modulador_recibe_el_brillo_con_la_correccion_gamma(void) {
+
+    LedsFadeStart(&fade, 2, 0, 128, 4);
+
+    while (LedsFadeTick(&fade)) {
+        TEST_ASSERT_EQUAL(LedsFadeGamma(LedsFadeGetLevel(&fade, 2)), LedsBamGetLevel(&bam, 2));
+    }
+    TEST_ASSERT_EQUAL(128, LedsFadeGetLevel(&fade, 2));
+    TEST_ASSERT_EQUAL(LedsFadeGamma(128), LedsBamGetLevel(&bam, 2));
+    TEST_ASSERT_LESS_THAN(128, LedsFadeGamma(128));
+}
+
+void test_empezar_un_fundido_de_duracion_cero_y_verificar_que_cambia_en_la_proxima(void) {
+
+    LedsFadeTick(&fade);
+    LedsFadeStart(&fade, 7, 30, 255, 0);
+    TEST_ASSERT_EQUAL(30, LedsFadeGetLevel(&fade, 7));
+
+    TEST_ASSERT_FALSE(LedsFadeTick(&fade));
+    TEST_ASSERT_EQUAL(255, LedsFadeGetLevel(&fade, 7));
+    TEST_ASSERT_EQUAL(255, LedsBamGetLevel(&bam, 7));
+}
+
+void test_verificar_que_la_tabla_gamma_es_creciente_y_va_de_0_a_255(void) {
+
+    TEST_ASSERT_EQUAL(0, LedsFadeGamma(0));
+    TEST_ASSERT_EQUAL(255, LedsFadeGamma(255));
+    for (int level = 1; level <= 255; level++) {
+        TEST_ASSERT_TRUE(LedsFadeGamma((uint8_t)level) >= LedsFadeGamma((uint8_t)(level - 1)));
+    }
+}
+
+void test_empezar_el_fundido_de_un_led_fuera_de_rango_y_comprobar_que_se_genera_un_error(void) {
+
+    RegistrarMensaje_ExpectAnyArgs();
+    LedsFadeStart(&fade, 0, 0, 255, 10);
+    RegistrarMensaje_ExpectAnyArgs();
+    LedsFadeStart(&fade, LEDS_ULTIMO_LED + 1, 0, 255, 10);
+    RegistrarMensaje_ExpectAnyArgs();
+    TEST_ASSERT_EQUAL(0, LedsFadeGetLevel(&fade, LEDS_ULTIMO_LED + 1));
+    RegistrarMensaje_ExpectAnyArgs();
+    TEST_ASSERT_FALSE(LedsFadeInit(&fade, NULL));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
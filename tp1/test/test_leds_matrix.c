@@ -0,0 +1,177 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo de matrices de leds
+ **
+ ** Pruebas a realizar:
+ ** - Iniciar una matriz y revisar que no queda ninguna fila seleccionada
+ ** - Prender leds de la matriz y verificar la palabra de cada fila al barrerla
+ ** - Barrer la matriz con borrado y verificar que el resultado es el mismo
+ ** - Usar filas activas en bajo y verificar las palabras del puerto
+ ** - Cambiar la imagen completa y verificar que solo se recalculan las filas distintas
+ ** - Crear una matriz que no entra en el puerto y comprobar que se genera un error
+ ** - Usar un led fuera de la matriz y comprobar que se genera un error
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "leds.h"
+#include "leds_matrix.h"
+#include "errores.h"
+#include "mock_errores.h"
+
+#include <stdbool.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define ROWS_ACTIVE_LOW 0xFF00
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+static leds_port_t port;
+static leds_t pool[1];
+static leds_t * leds;
+static leds_matrix_t matrix;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+// Barre una pantalla completa y verifica la palabra del puerto de cada fila
+static void AssertScan(const leds_port_t * expected) {
+
+    for (int row = 0; row < matrix.rows; row++) {
+        LedsMatrixTick(&matrix);
+        TEST_ASSERT_EQUAL_HEX16(expected[row], port);
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+    LedsPoolInit(pool, 1);
+    leds = LedsCreate(&port, LEDS_ULTIMO_LED);
+    TEST_ASSERT_TRUE(LedsMatrixInit(&matrix, leds, 8, 8, 0, false));
+}
+
+void tearDown(void) {
+}
+
+void test_iniciar_una_matriz_y_revisar_que_no_queda_ninguna_fila_seleccionada(void) {
+
+    TEST_ASSERT_EQUAL_HEX16(0x0000, port);
+    LedsMatrixTick(&matrix);
+    TEST_ASSERT_EQUAL_HEX16(0x0100, port);
+    TEST_ASSERT_FALSE(LedsMatrixIsOn(&matrix, 1, 1));
+}
+
+void test_prender_leds_de_la_matriz_y_verificar_la_palabra_de_cada_fila_al_barrerla(void) {
+
+    const leds_port_t expected[] = {0x0101, 0x0200, 0x0400, 0x0800,
+                                    0x1000, 0x2000, 0x4000, 0x8081};
+
+    LedsMatrixSetPixel(&matrix, 1, 1, true);
+    LedsMatrixSetPixel(&matrix, 8, 8, true);
+    LedsMatrixSetPixel(&matrix, 8, 1, true);
+    LedsMatrixSetPixel(&matrix, 3, 5, true);
+    LedsMatrixSetPixel(&matrix, 3, 5, false);
+
+    AssertScan(expected);
+    AssertScan(expected);
+    TEST_ASSERT_TRUE(LedsMatrixIsOn(&matrix, 8, 1));
+    TEST_ASSERT_FALSE(LedsMatrixIsOn(&matrix, 3, 5));
+}
+
+void test_barrer_la_matriz_con_borrado_y_verificar_que_el_resultado_es_el_mismo(void) {
+
+    const leds_port_t expected[] = {0x01FF, 0x0200, 0x0400, 0x0800,
+                                    0x1000, 0x2000, 0x4000, 0x8000};
+
+    TEST_ASSERT_TRUE(LedsMatrixInit(&matrix, leds, 8, 8, 0, true));
+    LedsMatrixSetRow(&matrix, 1, 0xFF);
+    AssertScan(expected);
+}
+
+void test_usar_filas_activas_en_bajo_y_verificar_las_palabras_del_puerto(void) {
+
+    const leds_port_t expected[] = {0xFE00, 0xFD18, 0xFB00, 0xF700,
+                                    0xEF00, 0xDF00, 0xBF00, 0x7F00};
+
+    TEST_ASSERT_TRUE(LedsMatrixInit(&matrix, leds, 8, 8, ROWS_ACTIVE_LOW, true));
+    TEST_ASSERT_EQUAL_HEX16(ROWS_ACTIVE_LOW, port);
+    LedsMatrixSetRow(&matrix, 2, 0x18);
+    AssertScan(expected);
+}
+
+void test_cambiar_la_imagen_completa_y_verificar_que_solo_se_recalculan_las_filas_distintas(void) {
+
+    const leds_port_t image[] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+    leds_port_t next[8];
+
+    TEST_ASSERT_EQUAL(8, LedsMatrixWriteImage(&matrix, image));
+    TEST_ASSERT_EQUAL(0, LedsMatrixWriteImage(&matrix, image));
+
+    for (int row = 0; row < 8; row++) {
+        next[row] = image[row];
+    }
+    next[2] = 0xFF;
+    next[6] = 0x1FF; // La columna 9 no existe
+    TEST_ASSERT_EQUAL(2, LedsMatrixWriteImage(&matrix, next));
+    TEST_ASSERT_EQUAL(0, LedsMatrixWriteImage(&matrix, next));
+    TEST_ASSERT_TRUE(LedsMatrixIsOn(&matrix, 3, 8));
+    TEST_ASSERT_TRUE(LedsMatrixIsOn(&matrix, 7, 1));
+}
+
+void test_crear_una_matriz_que_no_entra_en_el_puerto_y_comprobar_que_se_genera_un_error(void) {
+
+    RegistrarMensaje_ExpectAnyArgs();
+    TEST_ASSERT_FALSE(LedsMatrixInit(&matrix, leds, 9, 8, 0, false));
+    RegistrarMensaje_ExpectAnyArgs();
+    TEST_ASSERT_FALSE(LedsMatrixInit(&matrix, leds, 16, 16, 0, false));
+    RegistrarMensaje_ExpectAnyArgs();
+    TEST_ASSERT_FALSE(LedsMatrixInit(&matrix, leds, 0, 8, 0, false));
+}
+
+void test_usar_un_led_fuera_de_la_matriz_y_comprobar_que_se_genera_un_error(void) {
+
+    RegistrarMensaje_ExpectAnyArgs();
+    LedsMatrixSetPixel(&matrix, 9, 1, true);
+    RegistrarMensaje_ExpectAnyArgs();
+    LedsMatrixSetPixel(&matrix, 1, 0, true);
+    RegistrarMensaje_ExpectAnyArgs();
+    LedsMatrixSetRow(&matrix, 0, 0xFF);
+    RegistrarMensaje_ExpectAnyArgs();
+    TEST_ASSERT_FALSE(LedsMatrixIsOn(&matrix, 1, 9));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
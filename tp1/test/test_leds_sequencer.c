@@ -0,0 +1,219 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo secuenciador de patrones
+ **
+ ** Pruebas a realizar:
+ ** - Compilar un patron fijo y un parpadeo y revisar los cuadros
+ ** - Compilar un barrido y un llenado repetidos y revisar los cuadros
+ ** - Compilar patrones invalidos o que no entran y comprobar que se genera un error
+ ** - Reproducir una secuencia y verificar el puerto en cada interrupcion
+ ** - Reproducir una secuencia sin repeticion y verificar que queda en el ultimo cuadro
+ ** - Entregar una secuencia nueva y verificar que empieza al terminar el cuadro actual
+ ** - No entregar el buffer libre hasta que empieza la secuencia anterior
+ ** - Reproducir una secuencia de miles de cuadros
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "leds.h"
+#include "leds_sequencer.h"
+#include "errores.h"
+#include "mock_errores.h"
+
+#include <limits.h>
+#include <stdbool.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define CAPACITY 4096
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+static leds_port_t port;
+static leds_t pool[1];
+static leds_frame_t buffers[2 * CAPACITY];
+static leds_sequencer_t sequencer;
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+// Carga los patrones en el buffer libre y los entrega
+static int Load(const leds_pattern_t * patterns, int count, bool repeat) {
+
+    leds_frame_t * back = LedsSequencerBack(&sequencer);
+    TEST_ASSERT_NOT_NULL(back);
+    int frames = LedsPatternCompile(patterns, count, back, CAPACITY);
+    TEST_ASSERT_TRUE(LedsSequencerSubmit(&sequencer, frames, repeat));
+    return frames;
+}
+
+// Verifica el estado del puerto en las proximas interrupciones
+static void AssertTicks(const leds_port_t * expected, int ticks) {
+
+    for (int tick = 0; tick < ticks; tick++) {
+        LedsSequencerTick(&sequencer);
+        TEST_ASSERT_EQUAL_HEX16(expected[tick], port);
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+    LedsPoolInit(pool, 1);
+    TEST_ASSERT_TRUE(LedsSequencerInit(&sequencer, LedsCreate(&port, 16), buffers, CAPACITY));
+}
+
+void tearDown(void) {
+}
+
+void test_compilar_un_patron_fijo_y_un_parpadeo_y_revisar_los_cuadros(void) {
+
+    const leds_pattern_t patterns[] = {
+        {LEDS_PATRON_FIJO, 0x00F0, 5, 1},
+        {LEDS_PATRON_PARPADEO, 0x0101, 2, 2},
+    };
+    leds_frame_t frames[8];
+
+    TEST_ASSERT_EQUAL(5, LedsPatternCompile(patterns, 2, frames, 8));
+    TEST_ASSERT_EQUAL_HEX16(0x00F0, frames[0].state);
+    TEST_ASSERT_EQUAL(5, frames[0].duration);
+    TEST_ASSERT_EQUAL_HEX16(0x0101, frames[1].state);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, frames[2].state);
+    TEST_ASSERT_EQUAL_HEX16(0x0101, frames[3].state);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, frames[4].state);
+    TEST_ASSERT_EQUAL(2, frames[4].duration);
+}
+
+void test_compilar_un_barrido_y_un_llenado_repetidos_y_revisar_los_cuadros(void) {
+
+    const leds_pattern_t patterns[] = {
+        {LEDS_PATRON_BARRIDO, 0x0025, 1, 2},
+        {LEDS_PATRON_LLENADO, 0x8003, 3, 1},
+    };
+    const leds_port_t expected[] = {0x0001, 0x0004, 0x0020, 0x0001, 0x0004,
+                                    0x0020, 0x0001, 0x0003, 0x8003};
+    leds_frame_t frames[9];
+
+    TEST_ASSERT_EQUAL(9, LedsPatternCompile(patterns, 2, frames, 9));
+    for (int frame = 0; frame < 9; frame++) {
+        TEST_ASSERT_EQUAL_HEX16(expected[frame], frames[frame].state);
+    }
+    TEST_ASSERT_EQUAL(3, frames[8].duration);
+}
+
+void test_compilar_patrones_invalidos_o_que_no_entran_y_comprobar_que_se_genera_un_error(void) {
+
+    const leds_pattern_t empty_chase = {LEDS_PATRON_BARRIDO, 0x0000, 1, 1};
+    const leds_pattern_t no_duration = {LEDS_PATRON_FIJO, 0x0001, 0, 1};
+    const leds_pattern_t too_long = {LEDS_PATRON_PARPADEO, 0x0001, 1, 3};
+    const leds_pattern_t overflowing = {LEDS_PATRON_LLENADO, 0x00FF, 1, INT_MAX / 4};
+    leds_frame_t frames[5];
+
+    RegistrarMensaje_ExpectAnyArgs();
+    TEST_ASSERT_EQUAL(0, LedsPatternCompile(&empty_chase, 1, frames, 5));
+    RegistrarMensaje_ExpectAnyArgs();
+    TEST_ASSERT_EQUAL(0, LedsPatternCompile(&no_duration, 1, frames, 5));
+    RegistrarMensaje_ExpectAnyArgs();
+    TEST_ASSERT_EQUAL(0, LedsPatternCompile(&too_long, 1, frames, 5));
+    RegistrarMensaje_ExpectAnyArgs();
+    TEST_ASSERT_EQUAL(0, LedsPatternCompile(&overflowing, 1, frames, 5));
+    RegistrarMensaje_ExpectAnyArgs();
+    TEST_ASSERT_FALSE(LedsSequencerSubmit(&sequencer, CAPACITY + 1, true));
+}
+
+void test_reproducir_una_secuencia_y_verificar_el_puerto_en_cada_interrupcion(void) {
+
+    const leds_pattern_t patterns[] = {
+        {LEDS_PATRON_FIJO, 0x000F, 3, 1},
+        {LEDS_PATRON_BARRIDO, 0x0030, 1, 1},
+    };
+    const leds_port_t expected[] = {0x000F, 0x000F, 0x000F, 0x0010, 0x0020, 0x000F, 0x000F};
+
+    LedsSequencerTick(&sequencer);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, port);
+
+    TEST_ASSERT_EQUAL(3, Load(patterns, 2, true));
+    AssertTicks(expected, 7);
+}
+
+void test_reproducir_una_secuencia_sin_repeticion_y_verificar_que_queda_en_el_ultimo_cuadro(void) {
+
+    const leds_pattern_t patterns[] = {{LEDS_PATRON_LLENADO, 0x0007, 1, 1}};
+    const leds_port_t expected[] = {0x0001, 0x0003, 0x0007, 0x0007, 0x0007};
+
+    Load(patterns, 1, false);
+    AssertTicks(expected, 5);
+}
+
+void test_entregar_una_secuencia_nueva_y_verificar_que_empieza_al_terminar_el_cuadro_actual(void) {
+
+    const leds_pattern_t first[] = {{LEDS_PATRON_FIJO, 0x00FF, 4, 1}};
+    const leds_pattern_t second[] = {{LEDS_PATRON_PARPADEO, 0xF000, 1, 1}};
+    const leds_port_t expected[] = {0x00FF, 0x00FF, 0xF000, 0x0000, 0xF000};
+
+    Load(first, 1, true);
+    LedsSequencerTick(&sequencer);
+    LedsSequencerTick(&sequencer);
+    Load(second, 1, true);
+    AssertTicks(expected, 5);
+}
+
+void test_no_entregar_el_buffer_libre_hasta_que_empieza_la_secuencia_anterior(void) {
+
+    const leds_pattern_t patterns[] = {{LEDS_PATRON_FIJO, 0x0001, 1, 1}};
+    leds_frame_t * back = LedsSequencerBack(&sequencer);
+
+    Load(patterns, 1, true);
+    TEST_ASSERT_NULL(LedsSequencerBack(&sequencer));
+    TEST_ASSERT_FALSE(LedsSequencerSubmit(&sequencer, 1, true));
+
+    LedsSequencerTick(&sequencer);
+    TEST_ASSERT_EQUAL_HEX16(0x0001, port);
+    TEST_ASSERT_NOT_NULL(LedsSequencerBack(&sequencer));
+    TEST_ASSERT_TRUE(LedsSequencerBack(&sequencer) != back);
+}
+
+void test_reproducir_una_secuencia_de_miles_de_cuadros(void) {
+
+    const leds_pattern_t patterns[] = {{LEDS_PATRON_BARRIDO, 0xFFFF, 1, CAPACITY / 16}};
+
+    TEST_ASSERT_EQUAL(CAPACITY, Load(patterns, 1, true));
+    for (int tick = 0; tick < 2 * CAPACITY; tick++) {
+        LedsSequencerTick(&sequencer);
+        TEST_ASSERT_EQUAL_HEX16(1 << (tick % 16), port);
+    }
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,143 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo de leds con un puerto de 64 bits
+ **
+ ** Se compila con LEDS_PORT_BITS=64 (ver project.yml).
+ **
+ ** Pruebas a realizar:
+ ** - Prender los leds extremos de un puerto de 64 bits y apagarlos
+ ** - Prender todos los leds de un banco parcial de 40 leds
+ ** - Prender un rango que cruza la mitad del puerto, contarlo y recorrerlo
+ ** - Encender un led fuera de rango y comprobar que se genera un error
+ ** - Barrer una matriz de 16x16, que no entra en un puerto de 16 bits
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "leds.h"
+#include "leds_matrix.h"
+#include "errores.h"
+#include "mock_errores.h"
+
+#include <stdbool.h>
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+static leds_port_t port;
+static leds_port_t bank_port;
+static leds_t pool[1];
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+    LedsInitDriver(&port);
+}
+
+void tearDown(void) {
+}
+
+void test_prender_los_leds_extremos_de_un_puerto_de_64_bits_y_apagarlos(void) {
+
+    TEST_ASSERT_EQUAL(64, LEDS_ULTIMO_LED);
+
+    LedsTurnOn(1);
+    LedsTurnOn(64);
+    TEST_ASSERT_EQUAL_HEX64(0x8000000000000001ULL, port);
+    TEST_ASSERT_TRUE(LedsIsOn(64));
+    LedsTurnOff(1);
+    LedsTurnOff(64);
+    TEST_ASSERT_EQUAL_HEX64(0, port);
+
+    LedsTurnOnAll();
+    TEST_ASSERT_EQUAL_HEX64(UINT64_MAX, port);
+    TEST_ASSERT_EQUAL(64, LedsCountOn());
+}
+
+void test_prender_todos_los_leds_de_un_banco_parcial_de_40_leds(void) {
+
+    LedsPoolInit(pool, 1);
+    leds_t * leds = LedsCreate(&bank_port, 40);
+
+    LedsBankTurnOnAll(leds);
+    TEST_ASSERT_EQUAL_HEX64(0x000000FFFFFFFFFFULL, bank_port);
+    TEST_ASSERT_EQUAL(40, LedsBankCountOn(leds));
+    TEST_ASSERT_EQUAL(LEDS_NINGUNO, LedsBankNextOn(leds, 40));
+}
+
+void test_prender_un_rango_que_cruza_la_mitad_del_puerto_contarlo_y_recorrerlo(void) {
+
+    int expected = 30;
+
+    LedsTurnOnRange(30, 40);
+    TEST_ASSERT_EQUAL_HEX64(0x000000FFE0000000ULL, port);
+    TEST_ASSERT_EQUAL(11, LedsCountOn());
+    for (int led = LedsFirstOn(); led != LEDS_NINGUNO; led = LedsNextOn(led)) {
+        TEST_ASSERT_EQUAL(expected++, led);
+    }
+    TEST_ASSERT_EQUAL(41, expected);
+}
+
+void test_encender_un_led_fuera_de_rango_y_comprobar_que_se_genera_un_error(void) {
+
+    RegistrarMensaje_ExpectAnyArgs();
+    LedsTurnOn(65);
+    RegistrarMensaje_ExpectAnyArgs();
+    LedsTurnOn(0);
+    TEST_ASSERT_EQUAL_HEX64(0, port);
+}
+
+void test_barrer_una_matriz_de_16x16_que_no_entra_en_un_puerto_de_16_bits(void) {
+
+    leds_matrix_t matrix;
+
+    LedsPoolInit(pool, 1);
+    TEST_ASSERT_TRUE(LedsMatrixInit(&matrix, LedsCreate(&bank_port, 64), 16, 16, 0, true));
+    LedsMatrixSetPixel(&matrix, 1, 16, true);
+    LedsMatrixSetPixel(&matrix, 16, 1, true);
+
+    LedsMatrixTick(&matrix);
+    TEST_ASSERT_EQUAL_HEX64(0x0000000000018000ULL, bank_port);
+    for (int row = 2; row <= 16; row++) {
+        LedsMatrixTick(&matrix);
+    }
+    TEST_ASSERT_EQUAL_HEX64(0x0000000080000001ULL, bank_port);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,109 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef BENCH_H
+#define BENCH_H
+
+/** \brief Helpers shared by the benchmark programs
+ **
+ ** Each file in bench/ is a standalone program linked against the modules of src/ (see the
+ ** bench target of the Makefile). They print one line per measurement.
+ **
+ ** \addtogroup bench module
+ ** \brief Header file for benchmark helpers
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#define BENCH_NS_PER_S 1000000000.0
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+static inline uint64_t BenchNowNs(void) {
+
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+
+}
+
+// Time stamp counter where there is one, nanoseconds elsewhere
+static inline uint64_t BenchCycles(void) {
+
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return BenchNowNs();
+#endif
+
+}
+
+// Small xorshift generator, so runs are repeatable across libc versions
+static inline uint32_t BenchRandom(uint32_t* state) {
+
+  uint32_t x = *state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return x;
+
+}
+
+// First command line argument as a count, or the default value
+static inline size_t BenchArgCount(int argc, char** argv, size_t default_count) {
+
+  return (argc > 1) ? (size_t)strtoull(argv[1], NULL, 0) : default_count;
+
+}
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* BENCH_H */
@@ -0,0 +1,143 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Benchmark of the external sort against sort(1)
+ **
+ ** Writes a file of random text lines, sorts it with es_sort_file and with
+ ** LC_ALL=C sort -S, both under the same memory limit so that both go through temporary
+ ** runs, checks that the outputs are identical and reports MB/s over the input size. The
+ ** limit of es_sort_file covers its input buffers and its record index, so it is the whole
+ ** sorting memory that sort -S is given too.
+ **
+ ** Usage: bench_external_sort.elf [megabytes] (default 128)
+ **
+ ** \addtogroup bench module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "bench.h"
+#include "external_sort.h"
+
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define DEFAULT_MEGABYTES 128U
+#define MEMORY_LIMIT      (16U * 1024U * 1024U)
+#define MAX_LINE          64U
+#define INPUT_PATH        "/tmp/bench_es_input.txt"
+#define OUTPUT_PATH       "/tmp/bench_es_output.txt"
+#define SORT_OUTPUT_PATH  "/tmp/bench_es_sort.txt"
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static size_t _make_input(size_t bytes) {
+
+  static const char alphabet[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+  FILE* file = fopen(INPUT_PATH, "wb");
+  uint32_t seed = 1;
+  size_t written = 0;
+  char line[MAX_LINE + 1];
+
+  while (NULL != file && written < bytes) {
+
+    size_t length = 8U + BenchRandom(&seed) % (MAX_LINE - 8U);
+
+    for (size_t i = 0; i < length; i++) {
+      line[i] = alphabet[BenchRandom(&seed) % (sizeof(alphabet) - 1U)];
+    }
+
+    line[length] = '\n';
+    written += fwrite(line, 1, length + 1U, file);
+
+  }
+
+  if (NULL != file) {
+    fclose(file);
+  }
+
+  return written;
+
+}
+
+static void _report(const char* name, size_t bytes, uint64_t elapsed_ns) {
+
+  double seconds = (double)elapsed_ns / BENCH_NS_PER_S;
+  printf("%-16s %8.3f s %8.1f MB/s\n", name, seconds, (double)bytes / seconds / 1e6);
+
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char** argv) {
+
+  size_t bytes = _make_input(BenchArgCount(argc, argv, DEFAULT_MEGABYTES) * 1024U * 1024U);
+  es_config_t config = { MEMORY_LIMIT, "/tmp" };
+  es_stats_t stats;
+  char command[256];
+  uint64_t start = 0;
+  int status = 0;
+
+  printf("%zu bytes, limite de memoria %u MiB\n", bytes, MEMORY_LIMIT / (1024U * 1024U));
+
+  start = BenchNowNs();
+  if (!es_sort_file(INPUT_PATH, OUTPUT_PATH, &config, &stats)) {
+    fprintf(stderr, "es_sort_file fallo\n");
+    return EXIT_FAILURE;
+  }
+  _report("es_sort_file", bytes, BenchNowNs() - start);
+  printf("  %zu corridas, %.2f comparaciones por registro en la mezcla\n", stats.runs,
+         (double)stats.merge_comparisons / (double)stats.records);
+
+  snprintf(command, sizeof(command), "LC_ALL=C sort -S %uK -T /tmp -o %s %s",
+           MEMORY_LIMIT / 1024U, SORT_OUTPUT_PATH, INPUT_PATH);
+
+  start = BenchNowNs();
+  status = system(command);
+  _report("sort(1)", bytes, BenchNowNs() - start);
+
+  if (0 == status) {
+    status = system("cmp -s " OUTPUT_PATH " " SORT_OUTPUT_PATH);
+    printf("salidas %s\n", (0 == status) ? "identicas" : "DISTINTAS");
+  }
+
+  unlink(SORT_OUTPUT_PATH);
+  unlink(OUTPUT_PATH);
+  unlink(INPUT_PATH);
+
+  return (0 == status) ? 0 : EXIT_FAILURE;
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,278 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Benchmark of shortest path queries
+ **
+ ** Generates a 4-neighbour grid with random weights and a random graph with 4 edges per
+ ** vertex, writes each one to a graph file and opens it back (reporting the load time), then
+ ** runs random point to point queries with Dijkstra and A* on both queue backends. Reports
+ ** queries per second and queue operations per query.
+ **
+ ** Usage: bench_graph_search.elf [vertices] (default 256K)
+ **
+ ** \addtogroup bench module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "bench.h"
+#include "graph_search.h"
+
+#include <math.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define DEFAULT_VERTICES  (256U * 1024U)
+#define RANDOM_DEGREE     4U
+#define GRID_MAX_WEIGHT   100U
+#define RANDOM_MAX_WEIGHT 1000U
+#define QUERIES           50U
+#define GRAPH_PATH        "/tmp/bench_graph_search.csr"
+
+/* === Private data type declarations ========================================================== */
+
+typedef struct {
+
+  uint32_t* offsets;
+  uint32_t* targets;
+  uint32_t* weights;
+
+} arrays_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static uint32_t grid_side = 0;
+
+/* === Private function implementation ========================================================= */
+
+static bool _alloc(arrays_t* arrays, uint32_t vertices, uint32_t edges) {
+
+  arrays->offsets = malloc(((size_t)vertices + 1U) * sizeof(uint32_t));
+  arrays->targets = malloc((size_t)edges * sizeof(uint32_t));
+  arrays->weights = malloc((size_t)edges * sizeof(uint32_t));
+
+  return (NULL != arrays->offsets && NULL != arrays->targets && NULL != arrays->weights);
+
+}
+
+static void _free(arrays_t* arrays) {
+
+  free(arrays->weights);
+  free(arrays->targets);
+  free(arrays->offsets);
+
+}
+
+static uint32_t _make_grid(arrays_t* arrays, uint32_t side, uint32_t* seed) {
+
+  const int32_t dx[] = { 1, -1, 0, 0 };
+  const int32_t dy[] = { 0, 0, 1, -1 };
+  uint32_t edge = 0;
+
+  for (uint32_t v = 0; v < side * side; v++) {
+
+    arrays->offsets[v] = edge;
+
+    for (unsigned d = 0; d < 4; d++) {
+
+      int32_t nx = (int32_t)(v % side) + dx[d];
+      int32_t ny = (int32_t)(v / side) + dy[d];
+
+      if (nx >= 0 && nx < (int32_t)side && ny >= 0 && ny < (int32_t)side) {
+
+        arrays->targets[edge] = (uint32_t)ny * side + (uint32_t)nx;
+        arrays->weights[edge] = 1U + BenchRandom(seed) % GRID_MAX_WEIGHT;
+        edge++;
+
+      }
+
+    }
+
+  }
+
+  arrays->offsets[side * side] = edge;
+
+  return edge;
+
+}
+
+static uint32_t _make_random(arrays_t* arrays, uint32_t vertices, uint32_t* seed) {
+
+  for (uint32_t v = 0; v < vertices; v++) {
+
+    arrays->offsets[v] = v * RANDOM_DEGREE;
+
+    for (uint32_t e = v * RANDOM_DEGREE; e < (v + 1U) * RANDOM_DEGREE; e++) {
+
+      arrays->targets[e] = BenchRandom(seed) % vertices;
+      arrays->weights[e] = 1U + BenchRandom(seed) % RANDOM_MAX_WEIGHT;
+
+    }
+
+  }
+
+  arrays->offsets[vertices] = vertices * RANDOM_DEGREE;
+
+  return vertices * RANDOM_DEGREE;
+
+}
+
+// Admissible and consistent on the grid: every step weighs at least 1
+static uint64_t _manhattan(uint32_t vertex, uint32_t target, void* ctx) {
+
+  uint32_t vx = vertex % grid_side;
+  uint32_t vy = vertex / grid_side;
+  uint32_t tx = target % grid_side;
+  uint32_t ty = target / grid_side;
+
+  (void)ctx;
+
+  return (uint64_t)((vx > tx) ? vx - tx : tx - vx) + ((vy > ty) ? vy - ty : ty - vy);
+
+}
+
+static void _run(const char* name, const graph_t* graph, gs_backend_t backend,
+                 gs_heuristic_t heuristic) {
+
+  void* pool = malloc(GS_MEMORY_SIZE(backend, (size_t)graph->vertex_count, (size_t)graph->edge_count));
+  graph_search_t gs;
+  gs_stats_t total = { 0, 0, 0, 0 };
+  uint32_t seed = 7;
+  size_t reached = 0;
+  uint64_t start = 0;
+  uint64_t elapsed = 0;
+
+  if (NULL == pool || !gs_init(&gs, graph, pool, backend)) {
+
+    fprintf(stderr, "Sin memoria para la busqueda %s\n", name);
+    free(pool);
+    return;
+
+  }
+
+  start = BenchNowNs();
+
+  for (unsigned q = 0; q < QUERIES; q++) {
+
+    uint32_t source = BenchRandom(&seed) % graph->vertex_count;
+    uint32_t target = BenchRandom(&seed) % graph->vertex_count;
+    uint64_t distance = (NULL != heuristic) ? gs_astar(&gs, source, target, heuristic, NULL)
+                                            : gs_dijkstra(&gs, source, target);
+
+    reached += (GS_UNREACHABLE != distance);
+    total.pushes += gs.stats.pushes;
+    total.decreases += gs.stats.decreases;
+    total.pops += gs.stats.pops;
+    total.settled += gs.stats.settled;
+
+  }
+
+  elapsed = BenchNowNs() - start;
+
+  printf("%-24s %9.1f consultas/s  push %9.0f  decrease %9.0f  pop %9.0f  settled %9.0f  (%zu/%u alcanzadas)\n",
+         name, QUERIES * BENCH_NS_PER_S / (double)elapsed, (double)total.pushes / QUERIES,
+         (double)total.decreases / QUERIES, (double)total.pops / QUERIES,
+         (double)total.settled / QUERIES, reached, QUERIES);
+
+  free(pool);
+
+}
+
+static bool _save_and_open(graph_t* graph, uint32_t vertices, uint32_t edges, const arrays_t* arrays) {
+
+  graph_t built;
+  uint64_t start = 0;
+  bool successful = graph_init(&built, vertices, edges, arrays->offsets, arrays->targets, arrays->weights) &&
+                    graph_save(&built, GRAPH_PATH);
+
+  if (successful) {
+
+    start = BenchNowNs();
+    successful = graph_open(graph, GRAPH_PATH);
+    printf("grafo de %u vertices y %u aristas abierto en %.1f ms\n", vertices, edges,
+           (double)(BenchNowNs() - start) / 1e6);
+
+  }
+
+  unlink(GRAPH_PATH);
+
+  return successful;
+
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char** argv) {
+
+  size_t vertices = BenchArgCount(argc, argv, DEFAULT_VERTICES);
+  arrays_t arrays;
+  graph_t graph;
+  uint32_t seed = 1;
+  uint32_t edges = 0;
+
+  grid_side = (uint32_t)sqrt((double)vertices);
+  vertices = (size_t)grid_side * grid_side;
+
+  if (vertices < 2 || !_alloc(&arrays, (uint32_t)vertices, (uint32_t)vertices * RANDOM_DEGREE)) {
+
+    fprintf(stderr, "Sin memoria para %zu vertices\n", vertices);
+    return EXIT_FAILURE;
+
+  }
+
+  edges = _make_grid(&arrays, grid_side, &seed);
+
+  if (_save_and_open(&graph, (uint32_t)vertices, edges, &arrays)) {
+
+    _run("grilla dijkstra indexado", &graph, GS_INDEXED_HEAP, NULL);
+    _run("grilla dijkstra radix", &graph, GS_RADIX_HEAP, NULL);
+    _run("grilla A* indexado", &graph, GS_INDEXED_HEAP, _manhattan);
+    _run("grilla A* radix", &graph, GS_RADIX_HEAP, _manhattan);
+    graph_close(&graph);
+
+  }
+
+  edges = _make_random(&arrays, (uint32_t)vertices, &seed);
+
+  if (_save_and_open(&graph, (uint32_t)vertices, edges, &arrays)) {
+
+    _run("aleatorio dijkstra indexado", &graph, GS_INDEXED_HEAP, NULL);
+    _run("aleatorio dijkstra radix", &graph, GS_RADIX_HEAP, NULL);
+    graph_close(&graph);
+
+  }
+
+  _free(&arrays);
+
+  return 0;
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
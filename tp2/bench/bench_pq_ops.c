@@ -0,0 +1,167 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Benchmark of every priority queue operation
+ **
+ ** Times each operation of priority_queue_t on a queue with random priorities and prints one
+ ** line per operation with the nanoseconds per element ("operation ns ns/op"), the format the
+ ** report target of the Makefile collects to compare builds. It is also the training workload
+ ** of the profile guided build (make pgo).
+ **
+ ** Usage: bench_pq_ops.elf [entries] (default 1M)
+ **
+ ** \addtogroup bench module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "bench.h"
+#include "priority_queue.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define DEFAULT_ENTRIES (1024U * 1024U)
+#define ITER_FRACTION   16 // The iterator walks the first entries / ITER_FRACTION nodes
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static volatile uintptr_t sink;
+
+/* === Private function implementation ========================================================= */
+
+static bool _is_odd(const pq_node_t* node, void* ctx) {
+
+  (void)ctx;
+  return (node->id & 1U) != 0;
+
+}
+
+static void _report(const char* name, uint64_t elapsed_ns, size_t operations) {
+
+  printf("%-14s %8.2f ns/op\n", name, (double)elapsed_ns / (double)operations);
+
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char** argv) {
+
+  size_t entries = BenchArgCount(argc, argv, DEFAULT_ENTRIES);
+  size_t walked = entries / ITER_FRACTION + 1;
+  void* pool = malloc(PQ_MEMORY_SIZE(entries));
+  void* src_pool = malloc(PQ_MEMORY_SIZE(entries));
+  void** payloads = malloc(entries * sizeof(void*));
+  uint16_t* priorities = malloc(entries * sizeof(uint16_t));
+  pq_node_t* out = malloc(entries * sizeof(pq_node_t));
+  size_t* frontier = malloc(PQ_ITER_FRONTIER_SIZE(walked) * sizeof(size_t));
+  priority_queue_t* pq = NULL;
+  priority_queue_t* src = NULL;
+  pq_iter_t iter;
+  uint64_t start = 0;
+  uint32_t seed = 1;
+  size_t removed = 0;
+
+  if (NULL == pool || NULL == src_pool || NULL == payloads || NULL == priorities || NULL == out ||
+      NULL == frontier || 0 == entries) {
+
+    fprintf(stderr, "Sin memoria para %zu elementos\n", entries);
+    return EXIT_FAILURE;
+
+  }
+
+  for (size_t i = 0; i < entries; i++) {
+
+    payloads[i] = (void*)(pq_id_t)(i + 1);
+    priorities[i] = (uint16_t)BenchRandom(&seed);
+
+  }
+
+  pq = pq_create(pool, entries, PQ_MIN_PRIORITY_QUEUE);
+
+  start = BenchNowNs();
+  for (size_t i = 0; i < entries; i++) {
+    pq_insert(pq, payloads[i], priorities[i]);
+  }
+  _report("insert", BenchNowNs() - start, entries);
+
+  start = BenchNowNs();
+  for (size_t i = 0; i < entries; i++) {
+    sink += (uintptr_t)pq_peek(pq);
+  }
+  _report("peek", BenchNowNs() - start, entries);
+
+  start = BenchNowNs();
+  pq_iter_sorted(&iter, pq, frontier, PQ_ITER_FRONTIER_SIZE(walked));
+  for (size_t i = 0; i < walked; i++) {
+    sink += (uintptr_t)pq_iter_next(&iter);
+  }
+  _report("iter_next", BenchNowNs() - start, walked);
+
+  start = BenchNowNs();
+  pq_export_sorted(pq, out);
+  _report("export_sorted", BenchNowNs() - start, entries);
+
+  start = BenchNowNs();
+  for (size_t i = 0; i < entries; i++) {
+    sink += (uintptr_t)pq_extract(pq);
+  }
+  _report("extract", BenchNowNs() - start, entries);
+
+  pq = pq_create(pool, entries, PQ_MIN_PRIORITY_QUEUE);
+
+  start = BenchNowNs();
+  pq_insert_bulk(pq, payloads, priorities, entries);
+  _report("insert_bulk", BenchNowNs() - start, entries);
+
+  start = BenchNowNs();
+  removed = pq_remove_if(pq, _is_odd, NULL);
+  _report("remove_if", BenchNowNs() - start, entries);
+
+  // The removed half comes back from a second queue
+  src = pq_create(src_pool, entries, PQ_MIN_PRIORITY_QUEUE);
+  pq_insert_bulk(src, payloads, priorities, removed);
+
+  start = BenchNowNs();
+  pq_merge(pq, src);
+  _report("merge", BenchNowNs() - start, entries);
+
+  free(frontier);
+  free(out);
+  free(priorities);
+  free(payloads);
+  free(src_pool);
+  free(pool);
+
+  return 0;
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,203 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Benchmark of the parallel bulk operations
+ **
+ ** Builds a large queue with random priorities, exports it sorted and removes a third of it,
+ ** first with the sequential functions and then with 1, 2, 4... threads up to the maximum,
+ ** checking that every parallel result is byte for byte the sequential one.
+ **
+ ** Usage: bench_pq_parallel.elf [entries] [threads] (default 4M, every online CPU)
+ **
+ ** \addtogroup bench module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "bench.h"
+#include "priority_queue.h"
+#include "pq_parallel.h"
+
+#include <string.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define DEFAULT_ENTRIES (4U * 1024U * 1024U)
+#define REMOVE_DIVISOR  3
+
+/* === Private data type declarations ========================================================== */
+
+typedef struct {
+
+  void** payloads;
+  uint16_t* priorities;
+  size_t entries;
+  priority_queue_t* built;     // Sequential results
+  priority_queue_t* removed;
+  pq_node_t* sorted;
+  void* pool;                  // Queue under test
+  pq_node_t* out;
+  pq_node_t* scratch;
+  uint64_t sequential_ns[3];
+
+} bench_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static bool _is_multiple(const pq_node_t* node, void* ctx) {
+
+  (void)ctx;
+  return (node->id % REMOVE_DIVISOR) == 0;
+
+}
+
+static bool _same_queue(const priority_queue_t* a, const priority_queue_t* b) {
+
+  return a->size == b->size && a->next_insertion_index == b->next_insertion_index &&
+         0 == memcmp(a->nodes, b->nodes, a->size * sizeof(pq_node_t));
+
+}
+
+static void _report(const char* name, size_t threads, uint64_t elapsed_ns, uint64_t base_ns,
+                    bool identical) {
+
+  printf("%-14s %3zu hilos %10.3f ms  x%5.2f  %s\n", name, threads, (double)elapsed_ns / 1e6,
+         (double)base_ns / (double)elapsed_ns, identical ? "identico" : "DISTINTO");
+
+}
+
+static void _run_sequential(bench_t* b) {
+
+  uint64_t start = BenchNowNs();
+  pq_insert_bulk(b->built, b->payloads, b->priorities, b->entries);
+  b->sequential_ns[0] = BenchNowNs() - start;
+
+  start = BenchNowNs();
+  pq_export_sorted(b->built, b->sorted);
+  b->sequential_ns[1] = BenchNowNs() - start;
+
+  pq_insert_bulk(b->removed, b->payloads, b->priorities, b->entries);
+  start = BenchNowNs();
+  pq_remove_if(b->removed, _is_multiple, NULL);
+  b->sequential_ns[2] = BenchNowNs() - start;
+
+  _report("insert_bulk", 0, b->sequential_ns[0], b->sequential_ns[0], true);
+  _report("export_sorted", 0, b->sequential_ns[1], b->sequential_ns[1], true);
+  _report("remove_if", 0, b->sequential_ns[2], b->sequential_ns[2], true);
+
+}
+
+static void _run_parallel(bench_t* b, size_t threads) {
+
+  priority_queue_t* pq = pq_create(b->pool, b->entries, PQ_MIN_PRIORITY_QUEUE);
+  uint64_t start = BenchNowNs();
+  size_t exported = 0;
+
+  pq_parallel_insert_bulk(pq, b->payloads, b->priorities, b->entries, threads);
+  _report("insert_bulk", threads, BenchNowNs() - start, b->sequential_ns[0],
+          _same_queue(b->built, pq));
+
+  start = BenchNowNs();
+  exported = pq_parallel_export_sorted(pq, b->out, b->scratch, threads);
+  _report("export_sorted", threads, BenchNowNs() - start, b->sequential_ns[1],
+          exported == b->entries && 0 == memcmp(b->sorted, b->out, exported * sizeof(pq_node_t)));
+
+  start = BenchNowNs();
+  pq_parallel_remove_if(pq, _is_multiple, NULL, threads);
+  _report("remove_if", threads, BenchNowNs() - start, b->sequential_ns[2],
+          _same_queue(b->removed, pq));
+
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char** argv) {
+
+  size_t entries = BenchArgCount(argc, argv, DEFAULT_ENTRIES);
+  long online = sysconf(_SC_NPROCESSORS_ONLN);
+  size_t max_threads = (argc > 2) ? (size_t)strtoull(argv[2], NULL, 0) : (size_t)online;
+  void* built_pool = malloc(PQ_MEMORY_SIZE(entries));
+  void* removed_pool = malloc(PQ_MEMORY_SIZE(entries));
+  bench_t b;
+  uint32_t seed = 1;
+
+  memset(&b, 0, sizeof(b));
+  b.payloads = malloc(entries * sizeof(void*));
+  b.priorities = malloc(entries * sizeof(uint16_t));
+  b.entries = entries;
+  b.built = pq_create(built_pool, entries, PQ_MIN_PRIORITY_QUEUE);
+  b.removed = pq_create(removed_pool, entries, PQ_MIN_PRIORITY_QUEUE);
+  b.sorted = malloc(entries * sizeof(pq_node_t));
+  b.pool = malloc(PQ_MEMORY_SIZE(entries));
+  b.out = malloc(entries * sizeof(pq_node_t));
+  b.scratch = malloc(entries * sizeof(pq_node_t));
+
+  if (NULL == b.payloads || NULL == b.priorities || NULL == b.built || NULL == b.removed ||
+      NULL == b.sorted || NULL == b.pool || NULL == b.out || NULL == b.scratch) {
+
+    fprintf(stderr, "Sin memoria para %zu elementos\n", entries);
+    return EXIT_FAILURE;
+
+  }
+
+  for (size_t i = 0; i < entries; i++) {
+
+    b.payloads[i] = (void*)(pq_id_t)(i + 1);
+    b.priorities[i] = (uint16_t)BenchRandom(&seed);
+
+  }
+
+  printf("%zu elementos, hasta %zu hilos (%ld CPU), 0 hilos = secuencial\n", entries,
+         max_threads, online);
+
+  _run_sequential(&b);
+
+  for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+
+    _run_parallel(&b, threads);
+
+  }
+
+  free(b.scratch);
+  free(b.out);
+  free(b.pool);
+  free(b.sorted);
+  free(b.priorities);
+  free(b.payloads);
+  free(removed_pool);
+  free(built_pool);
+
+  return 0;
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,137 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Benchmark of queue snapshot and restore
+ **
+ ** Fills a queue with random priorities and measures the snapshot/restore cycle to a memory
+ ** buffer and to a file, reporting GB/s over the snapshot size.
+ **
+ ** Usage: bench_pq_snapshot.elf [entries] (default 4M)
+ **
+ ** \addtogroup bench module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "bench.h"
+#include "priority_queue.h"
+#include "pq_snapshot.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define DEFAULT_ENTRIES (4U * 1024U * 1024U)
+#define REPETITIONS     5
+#define SNAPSHOT_PATH   "/tmp/bench_pq_snapshot.bin"
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void _report(const char* name, size_t bytes, uint64_t elapsed_ns) {
+
+  double seconds = (double)elapsed_ns / BENCH_NS_PER_S / REPETITIONS;
+  printf("%-18s %10.3f ms %8.2f GB/s\n", name, seconds * 1000.0, (double)bytes / seconds / 1e9);
+
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char** argv) {
+
+  size_t entries = BenchArgCount(argc, argv, DEFAULT_ENTRIES);
+  void* pool = malloc(PQ_MEMORY_SIZE(entries));
+  void* restored_pool = malloc(PQ_MEMORY_SIZE(entries));
+  void* buffer = malloc(PQ_SNAPSHOT_SIZE(entries));
+  priority_queue_t* pq = pq_create(pool, entries, PQ_MIN_PRIORITY_QUEUE);
+  uint32_t seed = 1;
+  size_t bytes = 0;
+  uint64_t start = 0;
+  int fd = -1;
+
+  if (NULL == restored_pool || NULL == buffer || NULL == pq) {
+
+    fprintf(stderr, "Sin memoria para %zu elementos\n", entries);
+    return EXIT_FAILURE;
+
+  }
+
+  for (size_t i = 0; i < entries; i++) {
+
+    pq_insert(pq, (void*)(pq_id_t)(i + 1), (uint16_t)BenchRandom(&seed));
+
+  }
+
+  bytes = pq_snapshot_size(pq);
+  printf("%zu elementos, instantanea de %zu bytes\n", entries, bytes);
+
+  start = BenchNowNs();
+  for (int i = 0; i < REPETITIONS; i++) {
+    pq_snapshot(pq, buffer, bytes);
+  }
+  _report("snapshot buffer", bytes, BenchNowNs() - start);
+
+  start = BenchNowNs();
+  for (int i = 0; i < REPETITIONS; i++) {
+    pq_restore(restored_pool, entries, buffer, bytes);
+  }
+  _report("restore buffer", bytes, BenchNowNs() - start);
+
+  fd = open(SNAPSHOT_PATH, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+  start = BenchNowNs();
+  for (int i = 0; i < REPETITIONS; i++) {
+    lseek(fd, 0, SEEK_SET);
+    pq_snapshot_fd(pq, fd);
+  }
+  _report("snapshot fd", bytes, BenchNowNs() - start);
+
+  start = BenchNowNs();
+  for (int i = 0; i < REPETITIONS; i++) {
+    lseek(fd, 0, SEEK_SET);
+    pq_restore_fd(restored_pool, entries, fd);
+  }
+  _report("restore fd", bytes, BenchNowNs() - start);
+
+  close(fd);
+  unlink(SNAPSHOT_PATH);
+
+  free(buffer);
+  free(restored_pool);
+  free(pool);
+
+  return 0;
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,242 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Benchmark of the worst-case time of each queue operation
+ **
+ ** Times every single insert and extract (in TSC cycles on x86, nanoseconds elsewhere) with
+ ** input generators that push each operation to its worst case, next to a random baseline:
+ ** - descending: in a min queue every new node is the most urgent and climbs to the root.
+ ** - ascending: the node moved to the root by every extract is the least urgent and sinks to
+ **   the bottom.
+ ** - ties: equal priorities, so insertion order alone decides and the moved node still sinks.
+ ** Each scenario runs several times and every operation keeps its fastest run: the same
+ ** operation on the same state costs the same, so the rest is noise from interrupts or
+ ** preemption. The maximum of each row is the cycle budget to plan for. pq_create is timed on a large
+ ** untouched pool, to show that it is O(1). The pool is touched beforehand, so page faults do
+ ** not count as queue time.
+ **
+ ** Usage: bench_pq_wcet.elf [entries] (default and maximum 65536, the distinct priorities)
+ **
+ ** \addtogroup bench module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "bench.h"
+#include "priority_queue.h"
+
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define MAX_ENTRIES       (UINT16_MAX + 1U)
+#define CREATE_CAPACITY   (16U * 1024U * 1024U)
+#define CREATE_REPEATS    1000
+#define RUNS              5 // Per operation, the fastest run drops interrupts and preemption
+
+/* === Private data type declarations ========================================================== */
+
+typedef uint16_t (*generator_t)(size_t i, size_t entries, uint32_t* seed);
+
+typedef struct {
+
+  const char* name;
+  generator_t generator;
+
+} scenario_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static uint16_t _descending(size_t i, size_t entries, uint32_t* seed) {
+
+  (void)seed;
+  return (uint16_t)(entries - 1 - i);
+
+}
+
+static uint16_t _ascending(size_t i, size_t entries, uint32_t* seed) {
+
+  (void)entries;
+  (void)seed;
+  return (uint16_t)i;
+
+}
+
+static uint16_t _ties(size_t i, size_t entries, uint32_t* seed) {
+
+  (void)i;
+  (void)entries;
+  (void)seed;
+  return 1;
+
+}
+
+static uint16_t _random(size_t i, size_t entries, uint32_t* seed) {
+
+  (void)i;
+  (void)entries;
+  return (uint16_t)BenchRandom(seed);
+
+}
+
+static int _compare_cycles(const void* a, const void* b) {
+
+  uint64_t x = *(const uint64_t*)a;
+  uint64_t y = *(const uint64_t*)b;
+  return (x > y) - (x < y);
+
+}
+
+static void _report(const char* operation, const char* scenario, uint64_t* samples, size_t count) {
+
+  uint64_t total = 0;
+
+  for (size_t i = 0; i < count; i++) {
+    total += samples[i];
+  }
+
+  qsort(samples, count, sizeof(uint64_t), _compare_cycles);
+
+  printf("%-10s %-12s %10.1f %10llu %10llu %10llu\n", operation, scenario,
+         (double)total / (double)count, (unsigned long long)samples[count * 99 / 100],
+         (unsigned long long)samples[count * 999 / 1000], (unsigned long long)samples[count - 1]);
+
+}
+
+static void _keep_fastest(uint64_t* samples, size_t i, uint64_t elapsed) {
+
+  samples[i] = (elapsed < samples[i]) ? elapsed : samples[i];
+
+}
+
+static void _run(const scenario_t* scenario, void* pool, size_t entries, uint64_t* inserts,
+                 uint64_t* extracts) {
+
+  for (size_t i = 0; i < entries; i++) {
+    inserts[i] = UINT64_MAX;
+    extracts[i] = UINT64_MAX;
+  }
+
+  for (int run = 0; run < RUNS; run++) {
+
+    priority_queue_t* pq = pq_create(pool, entries, PQ_MIN_PRIORITY_QUEUE);
+    uint32_t seed = 1;
+
+    for (size_t i = 0; i < entries; i++) {
+
+      uint16_t priority = scenario->generator(i, entries, &seed);
+      uint64_t start = BenchCycles();
+      pq_insert(pq, (void*)(pq_id_t)(i + 1), priority);
+      _keep_fastest(inserts, i, BenchCycles() - start);
+
+    }
+
+    for (size_t i = 0; i < entries; i++) {
+
+      uint64_t start = BenchCycles();
+      pq_extract(pq);
+      _keep_fastest(extracts, i, BenchCycles() - start);
+
+    }
+
+  }
+
+  _report("insert", scenario->name, inserts, entries);
+  _report("extract", scenario->name, extracts, entries);
+
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char** argv) {
+
+  const scenario_t scenarios[] = {
+    { "descendente", _descending },
+    { "ascendente", _ascending },
+    { "empates", _ties },
+    { "aleatorio", _random },
+  };
+  size_t entries = BenchArgCount(argc, argv, MAX_ENTRIES);
+  void* pool = NULL;
+  void* large_pool = malloc(PQ_MEMORY_SIZE(CREATE_CAPACITY));
+  uint64_t* samples = NULL;
+  uint64_t* extracts = NULL;
+  unsigned depth = 0;
+
+  entries = (entries > MAX_ENTRIES) ? MAX_ENTRIES : entries;
+  entries = (entries < 1) ? 1 : entries;
+  pool = malloc(PQ_MEMORY_SIZE(entries));
+  samples = malloc(((entries > CREATE_REPEATS) ? entries : CREATE_REPEATS) * sizeof(uint64_t));
+  extracts = malloc(entries * sizeof(uint64_t));
+
+  if (NULL == pool || NULL == large_pool || NULL == samples || NULL == extracts) {
+
+    fprintf(stderr, "Sin memoria para %zu elementos\n", entries);
+    return EXIT_FAILURE;
+
+  }
+
+  while ((entries >> (depth + 1)) > 0) {
+    depth++;
+  }
+
+  memset(pool, 0, PQ_MEMORY_SIZE(entries));
+
+  printf("%zu elementos, como mucho %u intercambios por operacion\n", entries, depth);
+  printf("%-10s %-12s %10s %10s %10s %10s\n", "operacion", "entrada", "media", "p99", "p99.9",
+         "max");
+
+  for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+
+    _run(&scenarios[i], pool, entries, samples, extracts);
+
+  }
+
+  for (size_t i = 0; i < CREATE_REPEATS; i++) {
+
+    uint64_t start = BenchCycles();
+    pq_create(large_pool, CREATE_CAPACITY, PQ_MIN_PRIORITY_QUEUE);
+    samples[i] = BenchCycles() - start;
+
+  }
+
+  _report("create", "16M huecos", samples, CREATE_REPEATS);
+
+  free(extracts);
+  free(samples);
+  free(large_pool);
+  free(pool);
+
+  return 0;
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
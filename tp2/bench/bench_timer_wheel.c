@@ -0,0 +1,180 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Benchmark of the timer wheel against a plain priority queue
+ **
+ ** Arms timers with random deadlines in [1, 65535] ticks ahead and lets them all expire,
+ ** reporting ns per timer for arming and for expiring. The same workload runs on a
+ ** priority_queue_t keyed by the 16-bit deadline, which is what the wheel replaces. A third
+ ** pass cancels every timer before it fires, which the heap cannot do without a search.
+ **
+ ** Usage: bench_timer_wheel.elf [timers] (default 1M)
+ **
+ ** \addtogroup bench module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "bench.h"
+#include "priority_queue.h"
+#include "timer_wheel.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define DEFAULT_TIMERS    (1024U * 1024U)
+#define MAX_DELAY         UINT16_MAX
+#define OVERFLOW_CAPACITY 16
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static size_t fired = 0;
+
+static uint8_t overflow_pool[PQ_MEMORY_SIZE(OVERFLOW_CAPACITY)];
+
+/* === Private function implementation ========================================================= */
+
+static void _on_expire(void* ctx) {
+
+  (void)ctx;
+  fired++;
+
+}
+
+static void _report(const char* name, size_t timers, uint64_t elapsed_ns) {
+
+  printf("%-22s %10.3f ms %8.2f ns/timer\n", name, (double)elapsed_ns / 1e6,
+         (double)elapsed_ns / (double)timers);
+
+}
+
+static void _bench_wheel(tw_timer_t* timers, const uint16_t* delays, size_t count) {
+
+  timer_wheel_t tw;
+  uint64_t start = 0;
+
+  tw_init(&tw, overflow_pool, OVERFLOW_CAPACITY, 0);
+  fired = 0;
+
+  start = BenchNowNs();
+  for (size_t i = 0; i < count; i++) {
+    tw_arm(&tw, &timers[i], delays[i]);
+  }
+  _report("wheel arm", count, BenchNowNs() - start);
+
+  start = BenchNowNs();
+  tw_advance(&tw, MAX_DELAY);
+  _report("wheel expire", count, BenchNowNs() - start);
+
+  if (fired != count) {
+    fprintf(stderr, "Vencieron %zu de %zu temporizadores\n", fired, count);
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    tw_arm(&tw, &timers[i], tw.now + delays[i]);
+  }
+
+  start = BenchNowNs();
+  for (size_t i = 0; i < count; i++) {
+    tw_cancel(&tw, &timers[i]);
+  }
+  _report("wheel cancel", count, BenchNowNs() - start);
+
+}
+
+static void _bench_heap(tw_timer_t* timers, const uint16_t* delays, size_t count) {
+
+  void* pool = malloc(PQ_MEMORY_SIZE(count));
+  priority_queue_t* pq = pq_create(pool, count, PQ_MIN_PRIORITY_QUEUE);
+  uint64_t start = 0;
+
+  if (NULL == pq) {
+
+    fprintf(stderr, "Sin memoria para %zu temporizadores\n", count);
+    free(pool);
+    return;
+
+  }
+
+  fired = 0;
+
+  start = BenchNowNs();
+  for (size_t i = 0; i < count; i++) {
+    pq_insert(pq, &timers[i], delays[i]);
+  }
+  _report("heap arm", count, BenchNowNs() - start);
+
+  start = BenchNowNs();
+  while (!pq_is_empty(pq)) {
+    tw_timer_t* timer = (tw_timer_t*)pq_extract(pq);
+    timer->callback(timer->ctx);
+  }
+  _report("heap expire", count, BenchNowNs() - start);
+
+  free(pool);
+
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char** argv) {
+
+  size_t count = BenchArgCount(argc, argv, DEFAULT_TIMERS);
+  tw_timer_t* timers = malloc(count * sizeof(tw_timer_t));
+  uint16_t* delays = calloc(count, sizeof(uint16_t));
+  uint32_t seed = 1;
+
+  if (NULL == timers || NULL == delays) {
+
+    fprintf(stderr, "Sin memoria para %zu temporizadores\n", count);
+    return EXIT_FAILURE;
+
+  }
+
+  for (size_t i = 0; i < count; i++) {
+
+    tw_timer_init(&timers[i], _on_expire, NULL);
+    delays[i] = (uint16_t)(1U + BenchRandom(&seed) % MAX_DELAY);
+
+  }
+
+  printf("%zu temporizadores, plazos en [1, %u] ticks\n", count, MAX_DELAY);
+
+  _bench_wheel(timers, delays, count);
+  _bench_heap(timers, delays, count);
+
+  free(delays);
+  free(timers);
+
+  return 0;
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,96 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef __EXTERNAL_SORT_H__
+#define __EXTERNAL_SORT_H__
+
+/** \brief Header file for external sort module
+ **
+ ** Sorts a file of newline terminated records (lines, compared byte by byte as with
+ ** LC_ALL=C sort) that does not need to fit in memory, in two phases:
+ ** - Run generation: the input is read in chunks of a quarter of the memory limit, with large
+ **   block aligned reads into two aligned buffers, so the next chunk is read by a helper
+ **   thread while the current one is sorted and written to temporary run files.
+ ** - Merge: every run is mapped read only and a loser tree merges all of them in one pass,
+ **   with ceil(log_2(runs)) comparisons per output record.
+ **
+ ** The memory limit covers the two input buffers and the record index (16 bytes per record),
+ ** which takes the other half, and must be at least 8 * ES_BLOCK_SIZE. A chunk with more
+ ** records than the index holds is written as several runs. A record must fit in a quarter
+ ** of the limit minus one block. A last line without newline gets one in the output, as
+ ** sort(1) does.
+ **
+ ** \addtogroup external_sort module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/********************** typedef **********************************************/
+
+typedef struct {
+
+  size_t memory_limit;        // Bytes for the two input buffers and the record index
+  const char* temp_dir;       // Where the runs go
+
+} es_config_t;
+
+typedef struct {
+
+  size_t records;
+  size_t bytes;               // Of the input
+  size_t runs;
+  size_t merge_comparisons;
+  uint64_t run_ns;            // Run generation time
+  uint64_t merge_ns;          // Merge time
+
+} es_stats_t;
+
+/********************** macros ***********************************************/
+#define ES_DEFAULT_MEMORY         (64U * 1024U * 1024U)
+#define ES_DEFAULT_TEMP_DIR       "/tmp"
+#define ES_BLOCK_SIZE             4096U   // Alignment and granularity of the reads
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+// config may be NULL for the defaults; stats may be NULL
+bool es_sort_file (const char* input, const char* output, const es_config_t* config,
+                   es_stats_t* stats); // O(n log_2(n)) comparisons, two passes over the data
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EXTERNAL_SORT_H__ */
+
+/********************** end of file ******************************************/
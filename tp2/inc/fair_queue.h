@@ -0,0 +1,102 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef __FAIR_QUEUE_H__
+#define __FAIR_QUEUE_H__
+
+/** \brief Header file for weighted fair queue module
+ **
+ ** Front end over one priority_queue_t per class (tenant) that shares the dequeues among the
+ ** classes in proportion to their weights, using deficit round robin: in each round a class
+ ** may hand out up to weight elements, always its most urgent ones.
+ **
+ ** Only classes with pending elements are kept, in a linked list in round order, so both
+ ** insert and extract pick their class in O(1) no matter how many classes are idle. The list
+ ** is kept up to date by fq_insert and fq_extract: once attached, a class queue must not be
+ ** modified directly.
+ **
+ ** \addtogroup fair_queue module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+#include "priority_queue.h"
+
+/********************** typedef **********************************************/
+
+typedef struct fq_class_s {
+
+  priority_queue_t* pq;       // NULL while not attached
+  uint16_t weight;            // Elements per round
+  uint16_t deficit;           // Elements left in the current turn
+  bool active;                // In the round list
+  struct fq_class_s* next;    // Next class in the round list
+
+} fq_class_t;
+
+typedef struct {
+
+  fq_class_t* classes;
+  size_t class_count;
+  fq_class_t* head;           // Class being served
+  fq_class_t* tail;
+  size_t size;
+
+} fair_queue_t;
+
+/********************** macros ***********************************************/
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+// classes is an array of class_count entries owned by the caller
+bool fq_init (fair_queue_t* fq, fq_class_t* classes, size_t class_count); // O(classes)
+
+// Takes over an existing queue, which may already hold elements
+bool fq_attach (fair_queue_t* fq, size_t class_id, priority_queue_t* pq, uint16_t weight); // O(1)
+
+bool fq_insert (fair_queue_t* fq, size_t class_id, void* data, uint16_t priority); // O(log_2(n))
+
+// Element that fq_extract would return
+void* fq_peek (fair_queue_t* fq); // O(1)
+
+// class_id may be NULL; otherwise it receives the class of the element
+void* fq_extract (fair_queue_t* fq, size_t* class_id); // O(log_2(n))
+
+bool fq_is_empty (fair_queue_t* fq);
+
+size_t fq_size (fair_queue_t* fq);
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FAIR_QUEUE_H__ */
+
+/********************** end of file ******************************************/
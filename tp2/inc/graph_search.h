@@ -0,0 +1,164 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef __GRAPH_SEARCH_H__
+#define __GRAPH_SEARCH_H__
+
+/** \brief Header file for graph search module
+ **
+ ** Shortest paths on directed graphs with non negative integer weights, stored in
+ ** compressed sparse row (CSR) form: the edges leaving vertex v are targets[i] and
+ ** weights[i] for i in [offsets[v], offsets[v + 1]).
+ **
+ ** Graphs are saved to and opened from a binary file (graph_file_header_t followed by the
+ ** three arrays in native byte order). graph_open maps the file read only, so loading a
+ ** graph with millions of vertices costs one validation pass and no copy.
+ **
+ ** Dijkstra and A* run on one of two queues:
+ ** - GS_INDEXED_HEAP: binary heap with decrease-key, at most one entry per vertex.
+ ** - GS_RADIX_HEAP: monotone radix heap with lazy duplicates; A* on it needs a consistent
+ **   heuristic (h(u) <= w(u, v) + h(v)), which keeps the keys monotone.
+ **
+ ** A graph_search_t holds the per vertex state of one search at a time. Distances are
+ ** tagged with a query number, so starting a new query costs nothing per vertex: a point to
+ ** point query on a big graph only touches what it explores.
+ **
+ ** \addtogroup graph_search module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+#include "indexed_pq.h"
+#include "radix_heap.h"
+
+/********************** typedef **********************************************/
+
+typedef struct {
+
+  uint32_t vertex_count;
+  uint32_t edge_count;
+  const uint32_t* offsets;    // vertex_count + 1 entries
+  const uint32_t* targets;    // edge_count entries
+  const uint32_t* weights;    // edge_count entries
+  void* mapping;              // File mapping, only for graphs from graph_open
+  size_t mapping_size;
+
+} graph_t;
+
+typedef struct {
+
+  uint32_t magic;
+  uint32_t version;
+  uint32_t vertex_count;
+  uint32_t edge_count;
+
+} graph_file_header_t;
+
+typedef enum {
+
+  GS_INDEXED_HEAP = 0,
+  GS_RADIX_HEAP,
+
+} gs_backend_t;
+
+// Lower bound of the distance from vertex to target
+typedef uint64_t (*gs_heuristic_t) (uint32_t vertex, uint32_t target, void* ctx);
+
+typedef struct {
+
+  size_t pushes;              // Entries added to the queue
+  size_t decreases;           // Keys lowered in place (indexed heap only)
+  size_t pops;                // Entries taken from the queue, stale ones included
+  size_t settled;             // Vertices whose distance became final
+
+} gs_stats_t;
+
+typedef struct {
+
+  const graph_t* graph;
+  gs_backend_t backend;
+  uint64_t* distance;
+  uint32_t* parent;
+  uint32_t* stamp;            // Query that last wrote distance and parent
+  uint32_t query;
+  indexed_pq_t* ipq;
+  radix_heap_t* rh;
+  gs_stats_t stats;           // Of the last query
+
+} graph_search_t;
+
+/********************** macros ***********************************************/
+#define GRAPH_FILE_MAGIC          0x31525343U // "CSR1"
+#define GRAPH_FILE_VERSION        1U
+
+#define GS_NO_VERTEX              UINT32_MAX
+#define GS_UNREACHABLE            UINT64_MAX
+
+#define GRAPH_FILE_SIZE(vertices, edges) (sizeof(graph_file_header_t) + \
+                                          ((vertices) + 1U + 2U * (edges)) * sizeof(uint32_t))
+
+#define GS_MEMORY_SIZE(backend, vertices, edges) \
+  ((vertices) * (sizeof(uint64_t) + 2U * sizeof(uint32_t)) + \
+   ((GS_RADIX_HEAP == (backend)) ? RADIX_HEAP_MEMORY_SIZE((edges) + 1U) : IPQ_MEMORY_SIZE(vertices)))
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+// Points the graph at arrays owned by the caller, after checking them
+bool graph_init (graph_t* graph, uint32_t vertex_count, uint32_t edge_count, const uint32_t* offsets,
+                 const uint32_t* targets, const uint32_t* weights); // O(V + E)
+
+bool graph_save (const graph_t* graph, const char* path); // O(V + E)
+
+bool graph_open (graph_t* graph, const char* path); // O(V + E)
+
+void graph_close (graph_t* graph);
+
+// memory_pool must hold GS_MEMORY_SIZE(backend, vertices, edges) bytes, 8-byte aligned
+bool gs_init (graph_search_t* gs, const graph_t* graph, void* memory_pool, gs_backend_t backend); // O(V)
+
+// Distance from source to target, GS_UNREACHABLE if none; GS_NO_VERTEX as target explores all
+uint64_t gs_dijkstra (graph_search_t* gs, uint32_t source, uint32_t target); // O((V + E) log_2(V))
+
+uint64_t gs_astar (graph_search_t* gs, uint32_t source, uint32_t target,
+                   gs_heuristic_t heuristic, void* ctx); // O((V + E) log_2(V))
+
+// Distance found by the last query; final for the vertices it settled
+uint64_t gs_distance (const graph_search_t* gs, uint32_t vertex); // O(1)
+
+// Writes the path source..vertex of the last query; returns its vertex count, 0 if none fits
+size_t gs_path (const graph_search_t* gs, uint32_t vertex, uint32_t* path, size_t capacity); // O(path)
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GRAPH_SEARCH_H__ */
+
+/********************** end of file ******************************************/
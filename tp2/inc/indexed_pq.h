@@ -0,0 +1,94 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef __INDEXED_PQ_H__
+#define __INDEXED_PQ_H__
+
+/** \brief Header file for indexed priority queue module
+ **
+ ** Min binary heap over the integers [0, capacity) with a 64-bit key each. A position table
+ ** maps every index to its slot in the heap, so the key of a queued index can be lowered in
+ ** place (decrease-key) instead of inserting a duplicate. Graph searches use the vertex
+ ** number as index and the tentative distance as key.
+ **
+ ** Everything lives in the caller pool (see IPQ_MEMORY_SIZE). Creating the queue is O(n) to
+ ** mark every index as absent; after that ipq_clear only costs the elements left in it, so
+ ** one queue can serve many searches on a big graph.
+ **
+ ** \addtogroup indexed_pq module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/********************** typedef **********************************************/
+
+typedef struct {
+
+  uint64_t* keys;             // By index
+  uint32_t* heap;             // Indices in heap order
+  uint32_t* position;         // Heap slot of each index, IPQ_ABSENT if not queued
+  uint32_t size;
+  uint32_t capacity;
+
+} indexed_pq_t;
+
+/********************** macros ***********************************************/
+#define IPQ_ABSENT                UINT32_MAX
+
+#define IPQ_MEMORY_SIZE(capacity) (sizeof(indexed_pq_t) + \
+                                   (capacity) * (sizeof(uint64_t) + 2 * sizeof(uint32_t)))
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+indexed_pq_t* ipq_create (void* memory_pool, uint32_t capacity); // O(n)
+
+// Inserts the index, or lowers its key if already queued; false if the key is not lower
+bool ipq_push_or_decrease (indexed_pq_t* ipq, uint32_t index, uint64_t key); // O(log_2(n))
+
+bool ipq_pop (indexed_pq_t* ipq, uint32_t* index, uint64_t* key); // O(log_2(n))
+
+bool ipq_contains (const indexed_pq_t* ipq, uint32_t index); // O(1)
+
+bool ipq_is_empty (const indexed_pq_t* ipq);
+
+// Empties the queue, only touching the indices still queued
+void ipq_clear (indexed_pq_t* ipq); // O(n)
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __INDEXED_PQ_H__ */
+
+/********************** end of file ******************************************/
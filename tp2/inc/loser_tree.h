@@ -0,0 +1,100 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef __LOSER_TREE_H__
+#define __LOSER_TREE_H__
+
+/** \brief Header file for loser tree module
+ **
+ ** Tournament tree for k-way merging (Knuth, TAOCP vol. 3, 5.4.1). Each internal node keeps
+ ** the loser of the match played there and the overall winner sits on top. After the
+ ** winner source advances to its next record, only the matches on its path to the root are
+ ** replayed: exactly ceil(log_2(k)) comparisons per output record, against about 2 log_2(k)
+ ** for a binary heap of run heads, which compares both children on the way down.
+ **
+ ** The tree only handles source numbers; the caller keeps the current record of every
+ ** source and compares them in the callback. Equal records come out by source number, so
+ ** merging runs given in input order is stable.
+ **
+ ** \addtogroup loser_tree module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/********************** typedef **********************************************/
+
+// Negative, zero or positive as the current record of source a goes before, with or after b's
+typedef int (*lt_compare_t) (uint32_t a, uint32_t b, void* ctx);
+
+typedef struct {
+
+  uint32_t* losers;           // losers[0] holds the winner, losers[1..k-1] the internal nodes
+  uint8_t* exhausted;         // Per source
+  uint32_t k;
+  lt_compare_t compare;
+  void* ctx;
+  size_t comparisons;
+
+} loser_tree_t;
+
+/********************** macros ***********************************************/
+#define LT_NO_SOURCE              UINT32_MAX
+
+#define LT_MEMORY_SIZE(k)         (sizeof(loser_tree_t) + (k) * (sizeof(uint32_t) + sizeof(uint8_t)))
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+loser_tree_t* lt_create (void* memory_pool, uint32_t k, lt_compare_t compare, void* ctx); // O(1)
+
+// Plays the whole tournament once every source holds its first record (or is exhausted)
+void lt_build (loser_tree_t* lt); // O(k)
+
+// Source of the next record, LT_NO_SOURCE once every source is exhausted
+uint32_t lt_winner (const loser_tree_t* lt); // O(1)
+
+// The winner moved to its next record: replay its path
+void lt_replay (loser_tree_t* lt); // O(log_2(k))
+
+// The winner has no more records
+void lt_retire (loser_tree_t* lt); // O(log_2(k))
+
+void lt_mark_exhausted (loser_tree_t* lt, uint32_t source); // Before lt_build only
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LOSER_TREE_H__ */
+
+/********************** end of file ******************************************/
@@ -0,0 +1,101 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef __PAIRING_HEAP_H__
+#define __PAIRING_HEAP_H__
+
+/** \brief Header file for pairing heap module
+ **
+ ** Meldable priority queue backend: two heaps are merged in O(1), against the
+ ** O(min(m log_2(n + m), n + m)) of pq_merge on the array based queue.
+ **
+ ** The heap is intrusive: the caller owns the ph_node_t of every element (usually embedded in
+ ** its own structure), so melding never copies nodes or depends on a pool. A node can only be
+ ** in one heap at a time and must stay alive until it is extracted.
+ **
+ ** Ties are broken the same way as priority_queue_t, by insertion order. The insertion index
+ ** comes from an atomic sequence shared by every pairing heap (heaps of different threads may
+ ** insert at the same time), so the order stays consistent after any number of melds: equal
+ ** priorities always leave in the order they were inserted, whichever heap they came from.
+ ** This differs from pq_merge, which ranks every element of src after those of dst; ranking
+ ** them that way here would mean renumbering src and losing the O(1) meld.
+ **
+ ** \addtogroup pairing_heap module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+#include "priority_queue.h"
+
+/********************** typedef **********************************************/
+
+typedef struct ph_node_s {
+
+  pq_node_t item;
+  struct ph_node_s* child;   // Leftmost child
+  struct ph_node_s* sibling; // Next sibling to the right
+
+} ph_node_t;
+
+typedef struct {
+
+  ph_node_t* root;
+  size_t size;
+  pq_type_t type;
+
+} pairing_heap_t;
+
+/********************** macros ***********************************************/
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+bool ph_init (pairing_heap_t* heap, pq_type_t type); // O(1)
+
+bool ph_insert (pairing_heap_t* heap, ph_node_t* node, void* data, uint16_t priority); // O(1)
+
+ph_node_t* ph_peek (pairing_heap_t* heap); // O(1)
+
+// Unlinks the root and returns it, so the caller can reuse the node
+ph_node_t* ph_extract (pairing_heap_t* heap); // O(log_2(n)) amortized
+
+// Moves every element of src into dst, leaving src empty
+bool ph_merge (pairing_heap_t* dst, pairing_heap_t* src); // O(1)
+
+bool ph_is_empty (pairing_heap_t* heap);
+
+size_t ph_size (pairing_heap_t* heap);
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PAIRING_HEAP_H__ */
+
+/********************** end of file ******************************************/
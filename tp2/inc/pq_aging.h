@@ -0,0 +1,93 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef __PQ_AGING_H__
+#define __PQ_AGING_H__
+
+/** \brief Header file for priority queue aging module
+ **
+ ** Queue whose elements gain rate priority units per epoch while they wait, so low priority
+ ** elements cannot starve under sustained load.
+ **
+ ** The effective priority of an element inserted at epoch t with priority p is, at epoch
+ ** now, p improved by rate * (now - t). Comparing two elements at any epoch gives the same
+ ** result as comparing p + rate * t (min queue), which does not depend on now: that is the
+ ** key stored in the heap, so pq_aging_tick costs O(1) and nothing is ever re-inserted.
+ **
+ ** Keys grow with the epoch, so when a new key does not fit in 16 bits every stored key is
+ ** lowered by the same amount (O(n), once every many epochs). If the queue holds elements
+ ** whose keys span more than 16 bits even then, the newest keys saturate: those elements
+ ** wait behind all the older ones, which keeps the queue starvation free.
+ **
+ ** \addtogroup pq_aging module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+#include "priority_queue.h"
+
+/********************** typedef **********************************************/
+
+typedef struct {
+
+  priority_queue_t* pq;       // Min queue on aged keys
+  pq_type_t type;             // Meaning of the priorities given by the caller
+  uint16_t rate;              // Priority units gained per epoch
+  uint64_t epoch;
+  uint64_t shift;             // Sum of the amounts every key has been lowered
+
+} pq_aging_t;
+
+/********************** macros ***********************************************/
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+// memory_pool must hold PQ_MEMORY_SIZE(capacity) bytes; rate 0 disables aging
+bool pq_aging_init (pq_aging_t* aq, void* memory_pool, size_t capacity,
+                    pq_type_t type, uint16_t rate); // O(1)
+
+bool pq_aging_insert (pq_aging_t* aq, void* data, uint16_t priority); // O(log_2(n)), O(n) when renormalizing
+
+void* pq_aging_peek (pq_aging_t* aq); // O(1)
+
+void* pq_aging_extract (pq_aging_t* aq); // O(log_2(n))
+
+// Starts a new epoch: every waiting element ages by rate
+void pq_aging_tick (pq_aging_t* aq); // O(1)
+
+size_t pq_aging_size (pq_aging_t* aq);
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PQ_AGING_H__ */
+
+/********************** end of file ******************************************/
@@ -0,0 +1,85 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef __PQ_PARALLEL_H__
+#define __PQ_PARALLEL_H__
+
+/** \brief Header file for parallel bulk operations on priority queues
+ **
+ ** Multithreaded versions of the bulk operations of priority_queue_t, for queues of millions
+ ** of nodes. Each one leaves the node array bit for bit as its sequential counterpart does
+ ** (same positions, same insertion indices), whatever the thread count:
+ ** - Bottom-up build: sift-downs of disjoint subtrees commute, so the subtrees rooted at one
+ **   level are heapified by different threads, bottom-up inside each, and the few levels above
+ **   are finished by the caller in Floyd order.
+ ** - Remove if: every thread compacts its own slice in place, the slices are moved together in
+ **   order and the heap is rebuilt as above.
+ ** - Sorted export: every thread sorts its slice, and the sorted runs are merged pairwise,
+ **   each merge split between threads by co-ranking the output.
+ **
+ ** threads == 0 uses every online CPU. The count is capped at PQ_PARALLEL_MAX_THREADS and at one
+ ** thread per PQ_PARALLEL_GRAIN nodes, so small queues run on the calling thread alone. The
+ ** calling thread does one share of the work; if a thread cannot be created its share runs
+ ** inline. Predicates are called concurrently and must be thread safe.
+ **
+ ** \addtogroup pq_parallel module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+#include "priority_queue.h"
+
+/********************** typedef **********************************************/
+
+/********************** macros ***********************************************/
+#define PQ_PARALLEL_MAX_THREADS   64
+#define PQ_PARALLEL_GRAIN         4096 // Minimum nodes per thread
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+// Same result as pq_insert_bulk
+bool pq_parallel_insert_bulk (priority_queue_t* pq, void* const* data, const uint16_t* priorities,
+                              size_t count, size_t threads); // O((n + m) / t + t log_2(n))
+
+// Same result as pq_remove_if
+size_t pq_parallel_remove_if (priority_queue_t* pq, pq_predicate_t predicate, void* ctx,
+                              size_t threads); // O(n / t + t log_2(n))
+
+// Same result as pq_export_sorted; scratch holds pq_size nodes too
+size_t pq_parallel_export_sorted (const priority_queue_t* pq, pq_node_t* out, pq_node_t* scratch,
+                                  size_t threads); // O(n log_2(n) / t + n log_2(t))
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PQ_PARALLEL_H__ */
+
+/********************** end of file ******************************************/
@@ -0,0 +1,129 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef __PQ_PERSIST_H__
+#define __PQ_PERSIST_H__
+
+/** \brief Header file for persistent priority queue module
+ **
+ ** A priority queue whose memory pool is a memory-mapped file, so the heap array, size and
+ ** next insertion index survive a restart. Reopening checks the file header, the size,
+ ** capacity and type of the mapped queue and the journal state in O(1), and fixes up the
+ ** nodes pointer: no re-heapify (pq_persist_verify checks the heap order in O(n)).
+ **
+ ** Payloads are stored as inline ids (pq_node_t.id). Id 0 is reserved, the same way NULL data
+ ** is rejected by pq_insert.
+ **
+ ** Every update is journaled in the file header (state, target size and the node in flight)
+ ** and moves nodes with a hole instead of swaps, so at any point the array holds every node at
+ ** least once. After a crash, reopening the file finishes the interrupted operation walking a
+ ** single root-to-leaf path, O(log_2(n)). Recovery assumes each node store either happened or
+ ** not (process crash); a node half written by a power cut is not detected.
+ **
+ ** An open file is used through a pq_persist_t handle, which keeps the header and the queue of
+ ** the mapping. The queue (pq_persist_t.pq) must only be modified with pq_persist_insert and
+ ** pq_persist_extract; read-only functions of priority_queue.h can be used on it.
+ **
+ ** \addtogroup pq_persist module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+#include "priority_queue.h"
+
+/********************** typedef **********************************************/
+
+typedef enum {
+
+  PQ_PERSIST_IDLE = 0,
+
+  PQ_PERSIST_INSERTING,
+  PQ_PERSIST_EXTRACTING,
+
+} pq_persist_state_t;
+
+// File header, placed right before the priority_queue_t of the mapping
+typedef struct {
+
+  uint32_t magic;
+  uint32_t version;
+  uint32_t queue_size;     // sizeof(priority_queue_t) of the writer
+  uint32_t node_size;      // sizeof(pq_node_t) of the writer
+  size_t capacity;
+  uint32_t type;           // pq_type_t
+  uint32_t state;          // pq_persist_state_t
+  size_t target_size;      // Queue size once the operation in flight is committed
+  pq_node_t pending;       // Node in flight (inserted node or last node moved by an extract)
+
+} pq_persist_header_t;
+
+// Handle of an open file, provided by the caller; pq_persist_open fills it only on success
+typedef struct {
+
+  pq_persist_header_t* header;     // Start of the mapping, NULL while closed
+  priority_queue_t* pq;            // Queue of the mapping, right after the header
+
+} pq_persist_t;
+
+/********************** macros ***********************************************/
+#define PQ_PERSIST_MAGIC     0x50515031U // "PQP1"
+#define PQ_PERSIST_VERSION   1U
+#define PQ_PERSIST_NO_ID     0U
+
+#define PQ_PERSIST_FILE_SIZE(capacity) (sizeof(pq_persist_header_t) + PQ_MEMORY_SIZE(capacity))
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+// Creates the file if needed (under path.tmp, renamed once its header is complete); an empty
+// file or one with the right length and no magic is initialized as new. False if an existing
+// file does not match capacity and type
+bool pq_persist_open (pq_persist_t* persist, const char* path, size_t capacity, pq_type_t type); // O(log_2(n))
+
+bool pq_persist_insert (pq_persist_t* persist, pq_id_t id, uint16_t priority); // O(log_2(n))
+
+bool pq_persist_peek (const pq_persist_t* persist, pq_id_t* id); // O(1)
+
+bool pq_persist_extract (pq_persist_t* persist, pq_id_t* id); // O(log_2(n))
+
+// Full consistency check of the file (header and heap order)
+bool pq_persist_verify (const pq_persist_t* persist); // O(n)
+
+// Flushes the mapping to the file
+bool pq_persist_sync (const pq_persist_t* persist);
+
+void pq_persist_close (pq_persist_t* persist);
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PQ_PERSIST_H__ */
+
+/********************** end of file ******************************************/
@@ -0,0 +1,100 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef __PQ_SNAPSHOT_H__
+#define __PQ_SNAPSHOT_H__
+
+/** \brief Header file for priority queue snapshot module
+ **
+ ** Serializes a queue as a versioned header followed by the raw heap array (priority,
+ ** insertion index and payload of every node), without extracting anything. Restoring copies
+ ** the array back as is: the heap order is kept, so there is no re-heapify.
+ **
+ ** The node array is written in the native layout of pq_node_t, so a snapshot can only be
+ ** restored by a build with the same node size and byte order (checked by the header).
+ ** Payloads are meant to be ids (pq_node_t.id); raw pointers are copied but only make sense
+ ** inside the same process.
+ **
+ ** The file descriptor variants move the data straight between the pool and the kernel, with
+ ** no intermediate buffer: one writev for header and nodes, and two reads to restore (the
+ ** header first, so nothing past the snapshot is consumed from the descriptor).
+ **
+ ** \addtogroup pq_snapshot module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+#include "priority_queue.h"
+
+/********************** typedef **********************************************/
+
+typedef struct {
+
+  uint32_t magic;
+  uint16_t version;
+  uint16_t node_size;              // sizeof(pq_node_t) of the writer
+  uint32_t type;                   // pq_type_t
+  uint32_t byte_order;             // PQ_SNAPSHOT_BYTE_ORDER as seen by the writer
+  uint64_t size;
+  uint64_t next_insertion_index;
+  uint64_t tombstones;
+
+} pq_snapshot_header_t;
+
+/********************** macros ***********************************************/
+#define PQ_SNAPSHOT_MAGIC       0x50515331U // "PQS1"
+#define PQ_SNAPSHOT_VERSION     2U
+#define PQ_SNAPSHOT_BYTE_ORDER  0x01020304U
+
+#define PQ_SNAPSHOT_SIZE(size) (sizeof(pq_snapshot_header_t) + (size) * sizeof(pq_node_t))
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+size_t pq_snapshot_size (const priority_queue_t* pq); // O(1)
+
+// Returns the number of bytes written, 0 if the buffer is too small
+size_t pq_snapshot (const priority_queue_t* pq, void* buffer, size_t buffer_size); // O(n)
+
+bool pq_snapshot_fd (const priority_queue_t* pq, int fd); // O(n)
+
+// Builds the queue in memory_pool (see PQ_MEMORY_SIZE) from a snapshot; NULL if the header is
+// invalid, the nodes break the heap order or their NULL payloads do not match the tombstones
+priority_queue_t* pq_restore (void* memory_pool, size_t capacity,
+                              const void* buffer, size_t length); // O(n)
+
+priority_queue_t* pq_restore_fd (void* memory_pool, size_t capacity, int fd); // O(n)
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PQ_SNAPSHOT_H__ */
+
+/********************** end of file ******************************************/
@@ -0,0 +1,141 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef __PQ_TRACE_H__
+#define __PQ_TRACE_H__
+
+/** \brief Header file for priority queue trace module
+ **
+ ** Records the calls made to every priority_queue_t of the process, so real traffic can be
+ ** replayed later against other backends or layouts (see tools/pq_replay.c). Recording is
+ ** opt-in: the hooks inside the queue only exist when built with -DPQ_TRACE, and they only
+ ** record between pq_trace_start and pq_trace_stop.
+ **
+ ** Each call becomes one 8 byte record in a ring supplied by the caller: once the ring is full
+ ** the oldest records are overwritten (and counted as dropped). Appending is one atomic
+ ** increment, so queues used from several threads can be traced. Queues get small ids in the
+ ** order they are first seen; a queue that already existed when recording started is given a
+ ** CREATE record then, but its previous contents are not known.
+ **
+ ** A saved trace is a header followed by the records in call order, in native byte order.
+ **
+ ** \addtogroup pq_trace module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+#include "priority_queue.h"
+
+/********************** typedef **********************************************/
+
+typedef enum {
+
+  PQ_TRACE_CREATE = 1,   // value: pq_type_t, size: capacity
+  PQ_TRACE_INSERT,       // value: priority (bulk inserts give one record per element)
+  PQ_TRACE_PEEK,         // value: priority of the root, 0 when empty
+  PQ_TRACE_EXTRACT,      // value: priority of the extracted node
+  PQ_TRACE_REMOVE,       // remove_if and remove_if_lazy; value: nodes removed (saturated)
+  PQ_TRACE_MERGE,        // value: id of the source queue, now empty
+
+} pq_trace_op_t;
+
+typedef struct {
+
+  uint8_t op;            // pq_trace_op_t
+  uint8_t queue;         // Queue id
+  uint16_t value;
+  uint32_t size;         // Live nodes after the call (capacity for CREATE)
+
+} pq_trace_record_t;
+
+typedef struct {
+
+  uint32_t magic;
+  uint16_t version;
+  uint16_t record_size;
+  uint64_t records;
+  uint64_t dropped;      // Oldest records overwritten by the ring
+
+} pq_trace_header_t;
+
+// A saved trace, mapped read only
+typedef struct {
+
+  const pq_trace_record_t* records;
+  size_t count;
+  uint64_t dropped;
+  void* mapping;
+  size_t mapping_size;
+
+} pq_trace_file_t;
+
+/********************** macros ***********************************************/
+#define PQ_TRACE_MAGIC          0x31545150U // "PQT1"
+#define PQ_TRACE_VERSION        1U
+#define PQ_TRACE_MAX_QUEUES     255         // Calls on further queues are dropped
+
+#ifdef PQ_TRACE
+#define PQ_TRACE_RECORD(pq, op, value) pq_trace_record ((pq), (op), (value))
+#else
+#define PQ_TRACE_RECORD(pq, op, value)
+#endif
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+// Starts recording into ring, forgetting any previous trace and queue ids
+bool pq_trace_start (pq_trace_record_t* ring, size_t capacity); // O(1)
+
+void pq_trace_stop (void); // O(1)
+
+// Records kept in the ring, at most its capacity
+size_t pq_trace_count (void); // O(1)
+
+uint64_t pq_trace_dropped (void); // O(1)
+
+// Writes the kept records in call order; stop recording first
+bool pq_trace_save (const char* path); // O(n)
+
+// Id of the queue in the trace, registering it if new; PQ_TRACE_MAX_QUEUES if there is no room
+uint8_t pq_trace_queue_id (const priority_queue_t* pq); // O(queues)
+
+// Hook called by the queue (see PQ_TRACE_RECORD)
+void pq_trace_record (const priority_queue_t* pq, pq_trace_op_t op, uint16_t value); // O(queues)
+
+bool pq_trace_open (pq_trace_file_t* trace, const char* path); // O(1)
+
+void pq_trace_close (pq_trace_file_t* trace); // O(1)
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PQ_TRACE_H__ */
+
+/********************** end of file ******************************************/
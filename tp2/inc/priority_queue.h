@@ -28,6 +28,16 @@ SPDX-License-Identifier: MIT
  ** The implementation is based on the book "Introduction to Algorithms", 3rd Edition,
  ** by Cormen, Leiserson, Rivest, and Stein, specifically from Chapter 6, Section 5.
  **
+ ** Bounded time: nothing is recursive and make stack checks at build time, from gcc's call
+ ** graph, that every frame fits in STACK_FRAME_LIMIT and that the whole call chain of every
+ ** public function fits in STACK_TOTAL_LIMIT (896 bytes). The qsort of pq_export_sorted and the
+ ** predicates passed to pq_remove_if and pq_remove_if_lazy are outside that bound: the caller
+ ** adds their stack to it. pq_create is O(1), since the slots past size are never read and are not
+ ** cleared. pq_insert and pq_extract do at most floor(log_2(n)) swaps, except when an insert
+ ** into a full queue compacts the tombstones or an extract drops tombstones that reach the
+ ** root: hard real-time callers should not use pq_remove_if_lazy. bench_pq_wcet measures the
+ ** worst case on adversarial inputs.
+ **
  ** \addtogroup priority_queue module
  ** \author Roberto Castro Beltran <
  ** @{ */
@@ -53,12 +63,21 @@ typedef enum {
 
 } pq_type_t;
 
+// Inline payload identifier, used where a raw pointer would not survive the process
+typedef uintptr_t pq_id_t;
+
 // Structure for priority queue elements
 typedef struct {
 
   uint16_t priority;
   size_t insertion_index;
-  void* data;
+
+  union {
+
+    void* data;
+    pq_id_t id;
+
+  };
 
 } pq_node_t;
 
@@ -71,12 +90,32 @@ typedef struct {
   size_t capacity;
   pq_type_t type;
   size_t next_insertion_index;
+  size_t tombstones; // Nodes removed lazily (NULL data), still inside the heap
 
 } priority_queue_t;
 
+// Selects nodes for removal; ctx is passed through untouched
+typedef bool (*pq_predicate_t) (const pq_node_t* node, void* ctx);
+
+// Iterator over the queue in extraction order, without modifying the queue
+typedef struct {
+
+  const priority_queue_t* pq;
+  size_t* frontier; // Heap of node indices, supplied by the caller
+  size_t frontier_size;
+  size_t frontier_capacity;
+  bool truncated; // pq_iter_next stopped because the frontier was full, not at the end
+
+} pq_iter_t;
+
 /********************** macros ***********************************************/
 #define PQ_MEMORY_SIZE(capacity) (sizeof(priority_queue_t) + capacity * sizeof(pq_node_t))
 
+// Frontier entries needed by an iterator to walk the first k elements of a queue without
+// tombstones; each tombstone walked through takes one more entry, like a returned element
+#define PQ_ITER_FRONTIER_SIZE(k) ((k) + 1)
+#define PQ_ITER_FRONTIER_SIZE_TOMBSTONES(k, tombstones) ((k) + (tombstones) + 1)
+
 /********************** external data declaration ****************************/
 
 
@@ -96,6 +135,32 @@ size_t pq_size (priority_queue_t* pq);
 
 void pq_print_priority_queue (priority_queue_t* pq);
 
+// Removes every node matching the predicate and rebuilds the heap bottom-up; returns the count
+size_t pq_remove_if (priority_queue_t* pq, pq_predicate_t predicate, void* ctx); // O(n)
+
+// Only marks the matching nodes as tombstones; they are dropped when they reach the root
+size_t pq_remove_if_lazy (priority_queue_t* pq, pq_predicate_t predicate, void* ctx); // O(n)
+
+// Moves every element of src into dst; src elements rank after dst ones of equal priority
+bool pq_merge (priority_queue_t* dst, priority_queue_t* src); // O(min(m log_2(n + m), n + m))
+
+// Appends count elements with consecutive insertion indices and rebuilds bottom-up; all or none
+bool pq_insert_bulk (priority_queue_t* pq, void* const* data, const uint16_t* priorities,
+                     size_t count); // O(n + m)
+
+// Copies the live nodes to out (pq_size entries) in extraction order; returns the count
+size_t pq_export_sorted (const priority_queue_t* pq, pq_node_t* out); // O(n log_2(n))
+
+// Walking the first k elements costs O(k log_2(k)), whatever the size of the queue
+bool pq_iter_sorted (pq_iter_t* iter, const priority_queue_t* pq,
+                     size_t* frontier, size_t frontier_capacity); // O(1)
+
+// Next node in extraction order; NULL at the end or when the frontier is full (iter->truncated)
+const pq_node_t* pq_iter_next (pq_iter_t* iter); // O(log_2(k))
+
+// True when node a must leave the queue before node b (priority, then insertion order)
+bool pq_node_precedes (const priority_queue_t* pq, const pq_node_t* a, const pq_node_t* b); // O(1)
+
 /********************** End of CPP guard *************************************/
 #ifdef __cplusplus
 }
@@ -0,0 +1,105 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef __RADIX_HEAP_H__
+#define __RADIX_HEAP_H__
+
+/** \brief Header file for radix heap module
+ **
+ ** Monotone priority queue for integer keys (Ahuja, Mehlhorn, Orlin and Tarjan, 1990): every
+ ** key pushed must be at least the last key popped, which is what Dijkstra and A* with a
+ ** consistent heuristic do. Elements are kept in 65 buckets by the highest bit in which
+ ** their key differs from the last popped key; popping only compares keys when bucket 0 is
+ ** empty, and then redistributes one bucket into lower ones. Each element moves down at
+ ** most 64 times, so pop is O(1) amortized plus the bucket scan.
+ **
+ ** There is no decrease-key: searches push a new entry and skip the stale ones on pop.
+ ** Entries are list nodes taken from the caller pool (see RADIX_HEAP_MEMORY_SIZE), so the
+ ** capacity bounds the number of entries queued at once, duplicates included.
+ **
+ ** \addtogroup radix_heap module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/********************** macros ***********************************************/
+#define RH_BUCKETS                65
+#define RH_NO_ENTRY               UINT32_MAX
+
+/********************** typedef **********************************************/
+
+typedef struct {
+
+  uint64_t key;
+  uint32_t value;
+  uint32_t next;              // Next entry of the bucket or of the free list
+
+} rh_entry_t;
+
+typedef struct {
+
+  rh_entry_t* entries;
+  uint32_t buckets[RH_BUCKETS]; // Head entry of each bucket
+  uint32_t free;                // Head of the free list
+  uint32_t capacity;
+  size_t size;
+  uint64_t last;                // Last popped key, lower bound of every queued key
+
+} radix_heap_t;
+
+#define RADIX_HEAP_MEMORY_SIZE(capacity) (sizeof(radix_heap_t) + (capacity) * sizeof(rh_entry_t))
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+radix_heap_t* rh_create (void* memory_pool, uint32_t capacity); // O(n)
+
+// Fails if full or if key is below the last popped key
+bool rh_push (radix_heap_t* rh, uint64_t key, uint32_t value); // O(1)
+
+bool rh_pop (radix_heap_t* rh, uint64_t* key, uint32_t* value); // O(log_2(C)) amortized
+
+bool rh_is_empty (const radix_heap_t* rh);
+
+size_t rh_size (const radix_heap_t* rh);
+
+// Empties the heap and allows keys from 0 again, only touching the entries still queued
+void rh_clear (radix_heap_t* rh); // O(n)
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RADIX_HEAP_H__ */
+
+/********************** end of file ******************************************/
@@ -0,0 +1,134 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef __SCHEDULER_H__
+#define __SCHEDULER_H__
+
+/** \brief Header file for cooperative scheduler module
+ **
+ ** Run-to-completion scheduler for periodic and one-shot jobs. Tasks waiting for their
+ ** release time sit in a queue keyed by release time; released tasks move to a ready queue
+ ** keyed by absolute deadline (earliest deadline first) or by a fixed priority, and
+ ** sched_run_once dispatches its root.
+ **
+ ** Times are ticks of the caller clock. The 16-bit queue keys are offsets from a base time
+ ** that is moved forward as the clock advances (every key is shifted by the same amount, so
+ ** the heaps stay valid). Periods and relative deadlines are limited to SCHED_MAX_INTERVAL
+ ** so that keys always fit; an overloaded system that falls further behind than that sees
+ ** the later keys saturate. Saturated keys are never shifted: the rebase that finds one
+ ** computes every key again from the task times (O(n)), so those jobs still run in release
+ ** order and never hold back earlier ones.
+ **
+ ** Tasks are owned by the caller and must stay alive while added.
+ **
+ ** \addtogroup scheduler module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+#include "priority_queue.h"
+
+/********************** macros ***********************************************/
+#define SCHED_MAX_INTERVAL    (UINT16_MAX / 4U)   // Longest period or relative deadline
+#define SCHED_ONE_SHOT        0U                  // Period of a task that runs once
+
+/********************** typedef **********************************************/
+
+typedef uint64_t (*sched_clock_t) (void* ctx);
+
+typedef void (*sched_job_t) (void* ctx);
+
+typedef enum {
+
+  SCHED_EDF = 0,              // Earliest absolute deadline first
+  SCHED_FIXED_PRIORITY,       // Lowest priority value first, FIFO among equals
+
+} sched_policy_t;
+
+typedef struct {
+
+  sched_job_t job;
+  void* ctx;
+  uint16_t priority;          // Only used by SCHED_FIXED_PRIORITY
+  uint32_t period;            // Ticks, SCHED_ONE_SHOT to run once
+  uint32_t relative_deadline; // Ticks after each release
+
+  uint64_t release;           // Of the current job
+  uint64_t deadline;          // Of the current job
+
+  size_t activations;
+  size_t misses;              // Jobs finished after their deadline
+  uint64_t total_jitter;      // Sum over activations of start - release
+  uint64_t max_jitter;
+
+} sched_task_t;
+
+typedef struct {
+
+  priority_queue_t* releases; // Tasks waiting for their release time
+  priority_queue_t* ready;    // Released tasks, by deadline or priority
+  sched_policy_t policy;
+
+  sched_clock_t clock;
+  void* clock_ctx;
+  uint64_t base;              // Time of queue key 0
+
+  size_t dispatched;
+  size_t misses;
+
+} scheduler_t;
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+// Each pool must hold PQ_MEMORY_SIZE(capacity) bytes, capacity being the number of tasks
+bool sched_init (scheduler_t* sched, void* releases_pool, void* ready_pool, size_t capacity,
+                 sched_policy_t policy, sched_clock_t clock, void* clock_ctx); // O(1)
+
+bool sched_task_init (sched_task_t* task, sched_job_t job, void* ctx, uint32_t period,
+                      uint32_t relative_deadline, uint16_t priority);
+
+// First release at the given absolute time, at most SCHED_MAX_INTERVAL ticks from now
+bool sched_add (scheduler_t* sched, sched_task_t* task, uint64_t release); // O(log_2(n))
+
+// Releases due tasks and runs the most urgent one; false if none was ready
+bool sched_run_once (scheduler_t* sched); // O(r log_2(n)), r released tasks
+
+// Earliest pending release, so an idle caller knows how long it may sleep
+bool sched_next_release (const scheduler_t* sched, uint64_t* release); // O(1)
+
+size_t sched_pending (const scheduler_t* sched); // O(1)
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SCHEDULER_H__ */
+
+/********************** end of file ******************************************/
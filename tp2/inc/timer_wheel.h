@@ -0,0 +1,131 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef __TIMER_WHEEL_H__
+#define __TIMER_WHEEL_H__
+
+/** \brief Header file for timer wheel module
+ **
+ ** Hierarchical timing wheel (Varghese and Lauck, 1987): TW_LEVELS wheels of TW_SLOTS slots,
+ ** each level TW_SLOTS times coarser than the previous one. A timer goes to the finest level
+ ** whose slot will be reached before its deadline, and is moved down (cascaded) when time
+ ** gets there. Arm, cancel and expire are O(1) for deadlines within TW_SPAN ticks.
+ **
+ ** Farther deadlines overflow into a priority_queue_t keyed by their epoch (deadline divided
+ ** by TW_SPAN), relative to a base epoch. A whole epoch is cascaded into the wheel when it
+ ** starts, so the 16-bit key only needs epoch resolution. Shifting every key costs O(n), so
+ ** the base is only moved forward once it lags TW_RENORMALIZE_EPOCHS behind: keys go up to
+ ** TW_MAX_EPOCHS from a base that may be TW_RENORMALIZE_EPOCHS - 1 epochs old, and the reach
+ ** guaranteed at any time is TW_REACH_EPOCHS epochs ahead of the current one.
+ **
+ ** Timers are intrusive: the caller owns every tw_timer_t and keeps it alive while armed.
+ ** Cancelling (or re-arming) an overflow timer turns its heap entry into a tombstone, which
+ ** no longer points to the timer, so it can be freed right after tw_cancel returns. Finding
+ ** the entry is O(n) in the overflow size; the slot is reclaimed by the next insert that
+ ** finds the heap full.
+ ** Callbacks run from tw_advance and may arm or cancel any timer, including their own.
+ **
+ ** \addtogroup timer_wheel module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** CPP guard ********************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************** inclusions *******************************************/
+#include "priority_queue.h"
+
+/********************** macros ***********************************************/
+#define TW_LEVELS              4
+#define TW_SLOT_BITS           6
+#define TW_SLOTS               (1U << TW_SLOT_BITS)
+#define TW_SPAN_BITS           (TW_LEVELS * TW_SLOT_BITS)
+#define TW_SPAN                (1ULL << TW_SPAN_BITS)   // Ticks covered by the wheel
+#define TW_MAX_EPOCHS          UINT16_MAX               // Largest overflow key, in TW_SPAN units
+#define TW_RENORMALIZE_EPOCHS  (1U << 15)               // Base lag that shifts the overflow keys
+// Overflow reach guaranteed at any time, in TW_SPAN units past the current epoch
+#define TW_REACH_EPOCHS        (TW_MAX_EPOCHS - TW_RENORMALIZE_EPOCHS + 1)
+
+/********************** typedef **********************************************/
+
+typedef void (*tw_callback_t) (void* ctx);
+
+typedef enum {
+
+  TW_TIMER_IDLE = 0,
+
+  TW_TIMER_IN_WHEEL,
+  TW_TIMER_IN_OVERFLOW,
+
+} tw_timer_state_t;
+
+typedef struct tw_timer_s {
+
+  struct tw_timer_s* next;
+  struct tw_timer_s* prev;
+  struct tw_timer_s** slot;   // Head of the slot list while in the wheel
+  uint64_t deadline;          // Absolute tick
+  tw_timer_state_t state;
+  tw_callback_t callback;
+  void* ctx;
+
+} tw_timer_t;
+
+typedef struct {
+
+  uint64_t now;
+  size_t in_wheel;
+  tw_timer_t* slots[TW_LEVELS][TW_SLOTS];
+  priority_queue_t* overflow;
+  uint64_t overflow_base;     // Epoch of overflow key 0
+
+} timer_wheel_t;
+
+/********************** external data declaration ****************************/
+
+
+/********************** external functions declaration ***********************/
+
+// overflow_pool must hold PQ_MEMORY_SIZE(overflow_capacity) bytes
+bool tw_init (timer_wheel_t* tw, void* overflow_pool, size_t overflow_capacity, uint64_t now); // O(1)
+
+void tw_timer_init (tw_timer_t* timer, tw_callback_t callback, void* ctx);
+
+// Re-arms the timer if already armed; a deadline not after now fires on the next tick
+bool tw_arm (timer_wheel_t* tw, tw_timer_t* timer, uint64_t deadline); // O(1), O(log_2(n)) overflow
+
+bool tw_cancel (timer_wheel_t* tw, tw_timer_t* timer); // O(1), O(n) overflow
+
+// Moves time up to now tick by tick, running the callbacks of expired timers; returns how many ran
+size_t tw_advance (timer_wheel_t* tw, uint64_t now); // O(ticks + expired)
+
+bool tw_is_armed (const tw_timer_t* timer);
+
+/********************** End of CPP guard *************************************/
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TIMER_WHEEL_H__ */
+
+/********************** end of file ******************************************/
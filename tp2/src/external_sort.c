@@ -0,0 +1,594 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Implementation file for external sort module
+ **
+ ** Run generation keeps one read in flight: while chunk i is sorted and written, a helper
+ ** thread reads chunk i + 1 into the other buffer. The partial record at the end of a chunk
+ ** is copied to the start of the next buffer before its read begins, and the read carries
+ ** on from there in multiples of ES_BLOCK_SIZE, so file offsets stay block aligned. A chunk
+ ** is full when less than one block is left.
+ **
+ ** \addtogroup external_sort module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** inclusions *******************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "external_sort.h"
+#include "loser_tree.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/********************** macros and definitions *******************************/
+#define BUFFERS                   2
+#define OUTPUT_BUFFER_SIZE        (1024U * 1024U)
+#define RUN_NAME                  "/es_run_XXXXXX"
+#define LIMIT_PARTS               4U // Two input buffers; the index takes the other two parts
+#define MIN_CHUNK_SIZE            (2U * ES_BLOCK_SIZE) // Room for a carried record and a block read
+
+/********************** internal data declaration ****************************/
+
+typedef struct {
+
+  const char* data;
+  size_t length;              // Without the newline
+
+} record_t;
+
+// One chunk read, possibly in flight on the helper thread
+typedef struct {
+
+  int fd;
+  char* buffer;
+  size_t capacity;
+  size_t length;              // Bytes in buffer, the carried ones included
+  size_t carried;             // Bytes copied from the previous chunk
+  bool eof;
+  bool failed;
+  bool threaded;
+  pthread_t thread;
+
+} read_job_t;
+
+typedef struct {
+
+  char** paths;
+  size_t count;
+  size_t capacity;
+
+} run_list_t;
+
+typedef struct {
+
+  const char* position;
+  const char* end;
+  const char* record;
+  size_t length;
+  void* map;
+  size_t map_size;
+
+} run_cursor_t;
+
+/********************** internal functions declaration ***********************/
+
+static uint64_t _now_ns (void);
+
+static int _compare_bytes (const char* a, size_t a_length, const char* b, size_t b_length);
+
+static int _compare_records (const void* a, const void* b);
+
+static void* _read_chunk (void* arg);
+
+static void _start_read (read_job_t* job);
+
+static void _finish_read (read_job_t* job);
+
+static bool _add_run (run_list_t* runs, const char* temp_dir, FILE** file);
+
+static bool _write_run (const char* data, size_t length, const char* temp_dir, run_list_t* runs,
+                        record_t* records, size_t records_capacity, es_stats_t* stats);
+
+static bool _generate_runs (int fd, size_t chunk_size, size_t records_capacity,
+                            const char* temp_dir, run_list_t* runs, es_stats_t* stats);
+
+static bool _advance (run_cursor_t* cursor);
+
+static int _compare_runs (uint32_t a, uint32_t b, void* ctx);
+
+static bool _merge_runs (const run_list_t* runs, FILE* output, es_stats_t* stats);
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static uint64_t _now_ns (void) {
+
+  struct timespec now;
+
+  clock_gettime (CLOCK_MONOTONIC, &now);
+
+  return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+
+}
+
+
+static int _compare_bytes (const char* a, size_t a_length, const char* b, size_t b_length) {
+
+  int order = memcmp (a, b, (a_length < b_length) ? a_length : b_length);
+
+  if (0 == order) {
+
+    order = (a_length > b_length) - (a_length < b_length);
+
+  }
+
+  return order;
+
+}
+
+
+static int _compare_records (const void* a, const void* b) {
+
+  const record_t* left = (const record_t*)a;
+  const record_t* right = (const record_t*)b;
+
+  return _compare_bytes (left->data, left->length, right->data, right->length);
+
+}
+
+
+static void* _read_chunk (void* arg) {
+
+  read_job_t* job = (read_job_t*)arg;
+  bool full = false;
+
+  while (!full && !job->eof && !job->failed) {
+
+    size_t request = (job->capacity - job->length) / ES_BLOCK_SIZE * ES_BLOCK_SIZE;
+    ssize_t done = (request > 0) ? read (job->fd, job->buffer + job->length, request) : 0;
+
+    if (0 == request) {
+
+      full = true;
+
+    } else if (done > 0) {
+
+      job->length += (size_t)done;
+
+    } else if (0 == done) {
+
+      job->eof = true;
+
+    } else if (EINTR != errno) {
+
+      job->failed = true;
+
+    }
+
+  }
+
+  return NULL;
+
+}
+
+
+static void _start_read (read_job_t* job) {
+
+  job->threaded = (0 == pthread_create (&job->thread, NULL, _read_chunk, job));
+
+  if (!job->threaded) {
+
+    _read_chunk (job); // No thread available: read in place, without overlap
+
+  }
+
+}
+
+
+static void _finish_read (read_job_t* job) {
+
+  if (job->threaded) {
+
+    pthread_join (job->thread, NULL);
+    job->threaded = false;
+
+  }
+
+}
+
+
+static bool _add_run (run_list_t* runs, const char* temp_dir, FILE** file) {
+
+  bool successful = false;
+  char* path = malloc (strlen (temp_dir) + sizeof(RUN_NAME));
+  int fd = -1;
+
+  if (runs->count == runs->capacity) {
+
+    size_t capacity = (0 == runs->capacity) ? 16U : 2U * runs->capacity;
+    char** paths = realloc (runs->paths, capacity * sizeof(char*));
+
+    if (NULL != paths) {
+
+      runs->paths = paths;
+      runs->capacity = capacity;
+
+    }
+
+  }
+
+  if (NULL != path && runs->count < runs->capacity) {
+
+    strcpy (path, temp_dir);
+    strcat (path, RUN_NAME);
+    fd = mkstemp (path);
+
+  }
+
+  if (fd >= 0) {
+
+    runs->paths[runs->count++] = path;
+    *file = fdopen (fd, "wb");
+    successful = (NULL != *file);
+
+    if (successful) {
+
+      setvbuf (*file, NULL, _IOFBF, OUTPUT_BUFFER_SIZE);
+
+    } else {
+
+      close (fd);
+
+    }
+
+  } else {
+
+    free (path);
+
+  }
+
+  return successful;
+
+}
+
+
+// Sorts the records of a chunk and writes them out, one run per records_capacity records
+static bool _write_run (const char* data, size_t length, const char* temp_dir, run_list_t* runs,
+                        record_t* records, size_t records_capacity, es_stats_t* stats) {
+
+  const char* position = data;
+  const char* end = data + length;
+  bool successful = true;
+
+  while (successful && position < end) {
+
+    size_t count = 0;
+    FILE* file = NULL;
+
+    while (position < end && count < records_capacity) {
+
+      const char* newline = memchr (position, '\n', (size_t)(end - position));
+
+      records[count].data = position;
+      records[count].length = (NULL != newline) ? (size_t)(newline - position) : (size_t)(end - position);
+      count++;
+
+      position = (NULL != newline) ? newline + 1 : end;
+
+    }
+
+    qsort (records, count, sizeof(record_t), _compare_records);
+
+    successful = _add_run (runs, temp_dir, &file);
+
+    for (size_t i = 0; successful && i < count; i++) {
+
+      fwrite (records[i].data, 1, records[i].length, file);
+      putc ('\n', file);
+
+    }
+
+    if (NULL != file) {
+
+      successful = !ferror (file) && (0 == fclose (file)) && successful;
+
+    }
+
+    stats->records += count;
+
+  }
+
+  return successful;
+
+}
+
+
+static bool _generate_runs (int fd, size_t chunk_size, size_t records_capacity,
+                            const char* temp_dir, run_list_t* runs, es_stats_t* stats) {
+
+  char* buffers[BUFFERS] = { NULL, NULL };
+  record_t* records = malloc (records_capacity * sizeof(record_t));
+  read_job_t job;
+  bool successful = (NULL != records &&
+                     0 == posix_memalign ((void**)&buffers[0], ES_BLOCK_SIZE, chunk_size) &&
+                     0 == posix_memalign ((void**)&buffers[1], ES_BLOCK_SIZE, chunk_size));
+  bool done = false;
+  unsigned current = 0;
+
+  memset (&job, 0, sizeof(job));
+  job.fd = fd;
+  job.capacity = chunk_size;
+
+  if (successful) {
+
+    job.buffer = buffers[current];
+    _start_read (&job);
+
+  }
+
+  while (successful && !done) {
+
+    char* data = buffers[current];
+    size_t length = 0;
+    size_t complete = 0;
+
+    _finish_read (&job);
+
+    successful = !job.failed;
+    length = job.length;
+    done = job.eof;
+    stats->bytes += length - job.carried;
+
+    // Only whole records are sorted now; the partial last one moves to the next chunk
+    complete = length;
+
+    while (!done && complete > 0 && '\n' != data[complete - 1U]) {
+
+      complete--;
+
+    }
+
+    successful = successful && (done || complete > 0); // Otherwise a record fills the chunk
+
+    if (successful && !done) {
+
+      current = (current + 1U) % BUFFERS;
+      job.buffer = buffers[current];
+      job.carried = length - complete;
+      job.length = job.carried;
+      memcpy (job.buffer, data + complete, job.carried);
+      _start_read (&job);
+
+    }
+
+    if (successful && complete > 0) {
+
+      successful = _write_run (data, complete, temp_dir, runs, records, records_capacity, stats);
+
+    }
+
+  }
+
+  _finish_read (&job); // In case the loop ended on an error with a read in flight
+
+  free (records);
+  free (buffers[1]);
+  free (buffers[0]);
+
+  return successful;
+
+}
+
+
+static bool _advance (run_cursor_t* cursor) {
+
+  bool advanced = (cursor->position < cursor->end);
+
+  if (advanced) {
+
+    // Runs are written by _write_run, so every record ends with a newline
+    const char* newline = memchr (cursor->position, '\n', (size_t)(cursor->end - cursor->position));
+
+    cursor->record = cursor->position;
+    cursor->length = (size_t)(newline - cursor->position);
+    cursor->position = newline + 1;
+
+  }
+
+  return advanced;
+
+}
+
+
+static int _compare_runs (uint32_t a, uint32_t b, void* ctx) {
+
+  const run_cursor_t* cursors = (const run_cursor_t*)ctx;
+
+  return _compare_bytes (cursors[a].record, cursors[a].length, cursors[b].record, cursors[b].length);
+
+}
+
+
+static bool _merge_runs (const run_list_t* runs, FILE* output, es_stats_t* stats) {
+
+  uint32_t k = (uint32_t)runs->count;
+  run_cursor_t* cursors = calloc (k, sizeof(run_cursor_t));
+  void* pool = malloc (LT_MEMORY_SIZE(k));
+  loser_tree_t* lt = lt_create (pool, k, _compare_runs, cursors);
+  bool successful = (0 == k) || (NULL != cursors && NULL != lt); // No runs: empty output
+
+  for (uint32_t i = 0; successful && i < k; i++) {
+
+    int fd = open (runs->paths[i], O_RDONLY);
+    struct stat info;
+
+    successful = (fd >= 0 && 0 == fstat (fd, &info) && info.st_size > 0);
+
+    if (successful) {
+
+      cursors[i].map_size = (size_t)info.st_size;
+      cursors[i].map = mmap (NULL, cursors[i].map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      successful = (MAP_FAILED != cursors[i].map);
+
+    }
+
+    if (successful) {
+
+      posix_madvise (cursors[i].map, cursors[i].map_size, POSIX_MADV_SEQUENTIAL);
+      cursors[i].position = (const char*)cursors[i].map;
+      cursors[i].end = cursors[i].position + cursors[i].map_size;
+      _advance (&cursors[i]);
+
+    } else if (NULL != cursors) {
+
+      cursors[i].map = NULL;
+
+    }
+
+    if (fd >= 0) {
+
+      close (fd); // The mapping keeps the file referenced
+
+    }
+
+  }
+
+  if (successful && k > 0) {
+
+    uint32_t winner = LT_NO_SOURCE;
+
+    lt_build (lt);
+
+    for (winner = lt_winner (lt); LT_NO_SOURCE != winner; winner = lt_winner (lt)) {
+
+      fwrite (cursors[winner].record, 1, cursors[winner].length + 1U, output); // With its newline
+
+      if (_advance (&cursors[winner])) {
+
+        lt_replay (lt);
+
+      } else {
+
+        lt_retire (lt);
+
+      }
+
+    }
+
+    stats->merge_comparisons = lt->comparisons;
+
+  }
+
+  for (uint32_t i = 0; NULL != cursors && i < k; i++) {
+
+    if (NULL != cursors[i].map) {
+
+      munmap (cursors[i].map, cursors[i].map_size);
+
+    }
+
+  }
+
+  free (pool);
+  free (cursors);
+
+  return successful;
+
+}
+
+/********************** external functions definition ************************/
+
+bool es_sort_file (const char* input, const char* output, const es_config_t* config,
+                   es_stats_t* stats) {
+
+  bool successful = false;
+  es_stats_t local_stats;
+  es_stats_t* result = (NULL != stats) ? stats : &local_stats;
+  size_t memory_limit = (NULL != config && config->memory_limit > 0) ? config->memory_limit : ES_DEFAULT_MEMORY;
+  const char* temp_dir = (NULL != config && NULL != config->temp_dir) ? config->temp_dir : ES_DEFAULT_TEMP_DIR;
+  size_t chunk_size = memory_limit / LIMIT_PARTS / ES_BLOCK_SIZE * ES_BLOCK_SIZE;
+  size_t records_capacity = (memory_limit - BUFFERS * chunk_size) / sizeof(record_t);
+  run_list_t runs = { NULL, 0, 0 };
+  int fd = (NULL != input && NULL != output && chunk_size >= MIN_CHUNK_SIZE) ? open (input, O_RDONLY) : -1;
+
+  memset (result, 0, sizeof(*result));
+
+  if (fd >= 0) {
+
+    FILE* file = NULL;
+    uint64_t start = _now_ns ();
+
+    posix_fadvise (fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    successful = _generate_runs (fd, chunk_size, records_capacity, temp_dir, &runs, result);
+    close (fd);
+
+    result->runs = runs.count;
+    result->run_ns = _now_ns () - start;
+    start = _now_ns ();
+
+    file = successful ? fopen (output, "wb") : NULL;
+
+    if (NULL != file) {
+
+      setvbuf (file, NULL, _IOFBF, OUTPUT_BUFFER_SIZE);
+      successful = _merge_runs (&runs, file, result);
+      successful = !ferror (file) && (0 == fclose (file)) && successful;
+
+    } else {
+
+      successful = false;
+
+    }
+
+    result->merge_ns = _now_ns () - start;
+
+  }
+
+  for (size_t i = 0; i < runs.count; i++) {
+
+    unlink (runs.paths[i]);
+    free (runs.paths[i]);
+
+  }
+
+  free (runs.paths);
+
+  return successful;
+
+}
+
+/********************** end of file ******************************************/
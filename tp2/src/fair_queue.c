@@ -0,0 +1,254 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Implementation file for weighted fair queue module
+ **
+ ** \addtogroup fair_queue module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** inclusions *******************************************/
+
+#include "fair_queue.h"
+
+/********************** macros and definitions *******************************/
+
+/********************** internal data declaration ****************************/
+
+/********************** internal functions declaration ***********************/
+
+static void _activate (fair_queue_t* fq, fq_class_t* cls);
+
+static void _end_turn (fair_queue_t* fq, bool keep);
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static void _activate (fair_queue_t* fq, fq_class_t* cls) {
+
+  cls->active = true;
+  cls->deficit = cls->weight;
+  cls->next = NULL;
+
+  if (NULL == fq->tail) {
+
+    fq->head = cls;
+
+  } else {
+
+    fq->tail->next = cls;
+
+  }
+
+  fq->tail = cls;
+
+}
+
+
+static void _end_turn (fair_queue_t* fq, bool keep) {
+
+  fq_class_t* cls = fq->head;
+
+  fq->head = cls->next;
+
+  if (NULL == fq->head) {
+
+    fq->tail = NULL;
+
+  }
+
+  if (keep) {
+
+    _activate (fq, cls); // Back to the end of the round with a new quantum
+
+  } else {
+
+    cls->active = false;
+    cls->next = NULL;
+
+  }
+
+}
+
+/********************** external functions definition ************************/
+
+bool fq_init (fair_queue_t* fq, fq_class_t* classes, size_t class_count) {
+
+  bool successful = false;
+
+  if (NULL != fq && NULL != classes && class_count > 0) {
+
+    for (size_t i = 0; i < class_count; i++) {
+
+      classes[i].pq = NULL;
+      classes[i].weight = 0;
+      classes[i].deficit = 0;
+      classes[i].active = false;
+      classes[i].next = NULL;
+
+    }
+
+    fq->classes = classes;
+    fq->class_count = class_count;
+    fq->head = NULL;
+    fq->tail = NULL;
+    fq->size = 0;
+
+    successful = true;
+
+  }
+
+  return successful;
+
+}
+
+
+bool fq_attach (fair_queue_t* fq, size_t class_id, priority_queue_t* pq, uint16_t weight) {
+
+  bool successful = false;
+
+  if (NULL != fq && class_id < fq->class_count && NULL != pq && weight > 0 &&
+      NULL == fq->classes[class_id].pq) {
+
+    fq_class_t* cls = &fq->classes[class_id];
+
+    cls->pq = pq;
+    cls->weight = weight;
+
+    if (!pq_is_empty (pq)) {
+
+      fq->size += pq_size (pq);
+      _activate (fq, cls);
+
+    }
+
+    successful = true;
+
+  }
+
+  return successful;
+
+}
+
+
+bool fq_insert (fair_queue_t* fq, size_t class_id, void* data, uint16_t priority) {
+
+  bool successful = false;
+
+  if (NULL != fq && class_id < fq->class_count && NULL != fq->classes[class_id].pq) {
+
+    fq_class_t* cls = &fq->classes[class_id];
+
+    successful = pq_insert (cls->pq, data, priority);
+
+    if (successful) {
+
+      fq->size++;
+
+      if (!cls->active) {
+
+        _activate (fq, cls);
+
+      }
+
+    }
+
+  }
+
+  return successful;
+
+}
+
+
+void* fq_peek (fair_queue_t* fq) {
+
+  void* data = NULL;
+
+  if (NULL != fq && NULL != fq->head) {
+
+    data = pq_peek (fq->head->pq);
+
+  }
+
+  return data;
+
+}
+
+
+void* fq_extract (fair_queue_t* fq, size_t* class_id) {
+
+  void* data = NULL;
+
+  if (NULL != fq && NULL != fq->head) {
+
+    fq_class_t* cls = fq->head;
+
+    data = pq_extract (cls->pq);
+    cls->deficit--;
+    fq->size--;
+
+    if (NULL != class_id) {
+
+      *class_id = (size_t)(cls - fq->classes);
+
+    }
+
+    if (pq_is_empty (cls->pq) || 0 == cls->deficit) {
+
+      _end_turn (fq, !pq_is_empty (cls->pq));
+
+    }
+
+  }
+
+  return data;
+
+}
+
+
+bool fq_is_empty (fair_queue_t* fq) {
+
+  return (NULL == fq || NULL == fq->head);
+
+}
+
+
+size_t fq_size (fair_queue_t* fq) {
+
+  size_t size = 0;
+
+  if (NULL != fq) {
+
+    size = fq->size;
+
+  }
+
+  return size;
+
+}
+
+/********************** end of file ******************************************/
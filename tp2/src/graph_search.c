@@ -0,0 +1,477 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Implementation file for graph search module
+ **
+ ** Both backends share one loop. The queue key of a vertex is its tentative distance plus
+ ** the heuristic (0 for Dijkstra). The radix heap may hold older entries of a vertex whose
+ ** distance was lowered since: an entry is stale when its key is above the current one.
+ **
+ ** \addtogroup graph_search module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** inclusions *******************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "graph_search.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/********************** macros and definitions *******************************/
+
+/********************** internal data declaration ****************************/
+
+/********************** internal functions declaration ***********************/
+
+static bool _is_valid (uint32_t vertex_count, uint32_t edge_count, const uint32_t* offsets,
+                       const uint32_t* targets);
+
+static uint64_t _no_heuristic (uint32_t vertex, uint32_t target, void* ctx);
+
+static bool _is_reached (const graph_search_t* gs, uint32_t vertex);
+
+static void _begin (graph_search_t* gs);
+
+static void _enqueue (graph_search_t* gs, uint32_t vertex, uint64_t key);
+
+static bool _dequeue (graph_search_t* gs, uint32_t* vertex, uint64_t* key);
+
+static uint64_t _search (graph_search_t* gs, uint32_t source, uint32_t target,
+                         gs_heuristic_t heuristic, void* ctx);
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static bool _is_valid (uint32_t vertex_count, uint32_t edge_count, const uint32_t* offsets,
+                       const uint32_t* targets) {
+
+  bool valid = (vertex_count > 0 && vertex_count < GS_NO_VERTEX &&
+                0 == offsets[0] && edge_count == offsets[vertex_count]);
+
+  for (uint32_t v = 0; valid && v < vertex_count; v++) {
+
+    valid = (offsets[v] <= offsets[v + 1]);
+
+  }
+
+  for (uint32_t e = 0; valid && e < edge_count; e++) {
+
+    valid = (targets[e] < vertex_count);
+
+  }
+
+  return valid;
+
+}
+
+
+static uint64_t _no_heuristic (uint32_t vertex, uint32_t target, void* ctx) {
+
+  (void)vertex;
+  (void)target;
+  (void)ctx;
+
+  return 0;
+
+}
+
+
+static bool _is_reached (const graph_search_t* gs, uint32_t vertex) {
+
+  return (gs->stamp[vertex] == gs->query);
+
+}
+
+
+static void _begin (graph_search_t* gs) {
+
+  gs->query++;
+
+  // Once every 2^32 queries the stamps wrap around and must be cleared for real
+  if (0 == gs->query) {
+
+    for (uint32_t v = 0; v < gs->graph->vertex_count; v++) {
+
+      gs->stamp[v] = 0;
+
+    }
+
+    gs->query = 1;
+
+  }
+
+  if (GS_RADIX_HEAP == gs->backend) {
+
+    rh_clear (gs->rh);
+
+  } else {
+
+    ipq_clear (gs->ipq);
+
+  }
+
+  gs->stats.pushes = 0;
+  gs->stats.decreases = 0;
+  gs->stats.pops = 0;
+  gs->stats.settled = 0;
+
+}
+
+
+static void _enqueue (graph_search_t* gs, uint32_t vertex, uint64_t key) {
+
+  if (GS_RADIX_HEAP == gs->backend) {
+
+    rh_push (gs->rh, key, vertex); // Sized for one entry per edge, it cannot be full
+    gs->stats.pushes++;
+
+  } else if (ipq_contains (gs->ipq, vertex)) {
+
+    ipq_push_or_decrease (gs->ipq, vertex, key);
+    gs->stats.decreases++;
+
+  } else {
+
+    ipq_push_or_decrease (gs->ipq, vertex, key);
+    gs->stats.pushes++;
+
+  }
+
+}
+
+
+static bool _dequeue (graph_search_t* gs, uint32_t* vertex, uint64_t* key) {
+
+  bool found = (GS_RADIX_HEAP == gs->backend) ? rh_pop (gs->rh, key, vertex)
+                                              : ipq_pop (gs->ipq, vertex, key);
+
+  if (found) {
+
+    gs->stats.pops++;
+
+  }
+
+  return found;
+
+}
+
+
+static uint64_t _search (graph_search_t* gs, uint32_t source, uint32_t target,
+                         gs_heuristic_t heuristic, void* ctx) {
+
+  const graph_t* graph = gs->graph;
+  uint64_t result = GS_UNREACHABLE;
+  uint32_t vertex = GS_NO_VERTEX;
+  uint64_t key = 0;
+  bool done = false;
+
+  _begin (gs);
+
+  gs->distance[source] = 0;
+  gs->parent[source] = GS_NO_VERTEX;
+  gs->stamp[source] = gs->query;
+  _enqueue (gs, source, heuristic (source, target, ctx));
+
+  while (!done && _dequeue (gs, &vertex, &key)) {
+
+    uint64_t distance = gs->distance[vertex];
+
+    if (key > distance + heuristic (vertex, target, ctx)) {
+
+      continue; // Stale duplicate, the vertex was queued again with a lower key
+
+    }
+
+    gs->stats.settled++;
+
+    if (vertex == target) {
+
+      result = distance;
+      done = true;
+
+    }
+
+    for (uint32_t e = graph->offsets[vertex]; !done && e < graph->offsets[vertex + 1]; e++) {
+
+      uint32_t next = graph->targets[e];
+      uint64_t candidate = distance + graph->weights[e];
+
+      if (!_is_reached (gs, next) || candidate < gs->distance[next]) {
+
+        gs->distance[next] = candidate;
+        gs->parent[next] = vertex;
+        gs->stamp[next] = gs->query;
+        _enqueue (gs, next, candidate + heuristic (next, target, ctx));
+
+      }
+
+    }
+
+  }
+
+  return result;
+
+}
+
+/********************** external functions definition ************************/
+
+bool graph_init (graph_t* graph, uint32_t vertex_count, uint32_t edge_count, const uint32_t* offsets,
+                 const uint32_t* targets, const uint32_t* weights) {
+
+  bool successful = false;
+
+  if (NULL != graph && NULL != offsets && NULL != targets && NULL != weights &&
+      _is_valid (vertex_count, edge_count, offsets, targets)) {
+
+    graph->vertex_count = vertex_count;
+    graph->edge_count = edge_count;
+    graph->offsets = offsets;
+    graph->targets = targets;
+    graph->weights = weights;
+    graph->mapping = NULL;
+    graph->mapping_size = 0;
+
+    successful = true;
+
+  }
+
+  return successful;
+
+}
+
+
+bool graph_save (const graph_t* graph, const char* path) {
+
+  bool successful = false;
+  FILE* file = (NULL != graph && NULL != path) ? fopen (path, "wb") : NULL;
+
+  if (NULL != file) {
+
+    graph_file_header_t header = { GRAPH_FILE_MAGIC, GRAPH_FILE_VERSION,
+                                   graph->vertex_count, graph->edge_count };
+
+    successful = (1 == fwrite (&header, sizeof(header), 1, file) &&
+                  graph->vertex_count + 1U == fwrite (graph->offsets, sizeof(uint32_t), graph->vertex_count + 1U, file) &&
+                  graph->edge_count == fwrite (graph->targets, sizeof(uint32_t), graph->edge_count, file) &&
+                  graph->edge_count == fwrite (graph->weights, sizeof(uint32_t), graph->edge_count, file));
+
+    successful = (0 == fclose (file)) && successful;
+
+  }
+
+  return successful;
+
+}
+
+
+bool graph_open (graph_t* graph, const char* path) {
+
+  bool successful = false;
+  int fd = (NULL != graph && NULL != path) ? open (path, O_RDONLY) : -1;
+  struct stat info;
+
+  if (fd >= 0 && 0 == fstat (fd, &info) && (size_t)info.st_size >= sizeof(graph_file_header_t)) {
+
+    size_t length = (size_t)info.st_size;
+    void* map = mmap (NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (MAP_FAILED != map) {
+
+      const graph_file_header_t* header = (const graph_file_header_t*)map;
+      const uint32_t* offsets = (const uint32_t*)(header + 1);
+      const uint32_t* targets = offsets + header->vertex_count + 1U;
+
+      successful = (GRAPH_FILE_MAGIC == header->magic && GRAPH_FILE_VERSION == header->version &&
+                    GRAPH_FILE_SIZE((size_t)header->vertex_count, (size_t)header->edge_count) == length &&
+                    graph_init (graph, header->vertex_count, header->edge_count,
+                                offsets, targets, targets + header->edge_count));
+
+      if (successful) {
+
+        graph->mapping = map;
+        graph->mapping_size = length;
+
+      } else {
+
+        munmap (map, length);
+
+      }
+
+    }
+
+  }
+
+  if (fd >= 0) {
+
+    close (fd); // The mapping keeps the file referenced
+
+  }
+
+  return successful;
+
+}
+
+
+void graph_close (graph_t* graph) {
+
+  if (NULL != graph && NULL != graph->mapping) {
+
+    munmap (graph->mapping, graph->mapping_size);
+    graph->mapping = NULL;
+    graph->mapping_size = 0;
+
+  }
+
+}
+
+
+bool gs_init (graph_search_t* gs, const graph_t* graph, void* memory_pool, gs_backend_t backend) {
+
+  bool successful = false;
+
+  if (NULL != gs && NULL != graph && NULL != memory_pool &&
+      (GS_INDEXED_HEAP == backend || GS_RADIX_HEAP == backend)) {
+
+    uint32_t vertices = graph->vertex_count;
+    void* queue_pool = NULL;
+
+    gs->graph = graph;
+    gs->backend = backend;
+    gs->distance = (uint64_t*)memory_pool;
+    gs->parent = (uint32_t*)(gs->distance + vertices);
+    gs->stamp = gs->parent + vertices;
+    gs->query = 0;
+    gs->ipq = NULL;
+    gs->rh = NULL;
+
+    for (uint32_t v = 0; v < vertices; v++) {
+
+      gs->stamp[v] = 0;
+
+    }
+
+    queue_pool = gs->stamp + vertices;
+
+    if (GS_RADIX_HEAP == backend) {
+
+      gs->rh = (graph->edge_count < RH_NO_ENTRY) ? rh_create (queue_pool, graph->edge_count + 1U) : NULL;
+      successful = (NULL != gs->rh);
+
+    } else {
+
+      gs->ipq = ipq_create (queue_pool, vertices);
+      successful = (NULL != gs->ipq);
+
+    }
+
+  }
+
+  return successful;
+
+}
+
+
+uint64_t gs_dijkstra (graph_search_t* gs, uint32_t source, uint32_t target) {
+
+  return gs_astar (gs, source, target, _no_heuristic, NULL);
+
+}
+
+
+uint64_t gs_astar (graph_search_t* gs, uint32_t source, uint32_t target,
+                   gs_heuristic_t heuristic, void* ctx) {
+
+  uint64_t distance = GS_UNREACHABLE;
+
+  if (NULL != gs && NULL != heuristic && source < gs->graph->vertex_count &&
+      (GS_NO_VERTEX == target || target < gs->graph->vertex_count)) {
+
+    distance = _search (gs, source, target, heuristic, ctx);
+
+  }
+
+  return distance;
+
+}
+
+
+uint64_t gs_distance (const graph_search_t* gs, uint32_t vertex) {
+
+  uint64_t distance = GS_UNREACHABLE;
+
+  if (NULL != gs && vertex < gs->graph->vertex_count && _is_reached (gs, vertex)) {
+
+    distance = gs->distance[vertex];
+
+  }
+
+  return distance;
+
+}
+
+
+size_t gs_path (const graph_search_t* gs, uint32_t vertex, uint32_t* path, size_t capacity) {
+
+  size_t length = 0;
+
+  if (NULL != path && GS_UNREACHABLE != gs_distance (gs, vertex)) {
+
+    // Count first, then fill backwards so the path comes out from the source
+    for (uint32_t v = vertex; GS_NO_VERTEX != v; v = gs->parent[v]) {
+
+      length++;
+
+    }
+
+    if (length <= capacity) {
+
+      size_t i = length;
+
+      for (uint32_t v = vertex; GS_NO_VERTEX != v; v = gs->parent[v]) {
+
+        path[--i] = v;
+
+      }
+
+    } else {
+
+      length = 0;
+
+    }
+
+  }
+
+  return length;
+
+}
+
+/********************** end of file ******************************************/
@@ -0,0 +1,240 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Implementation file for indexed priority queue module
+ **
+ ** Sifting moves a hole instead of swapping, and writes each moved index together with its
+ ** new position, so the position table is always consistent with the heap.
+ **
+ ** \addtogroup indexed_pq module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** inclusions *******************************************/
+
+#include "indexed_pq.h"
+
+/********************** macros and definitions *******************************/
+#define PARENT(i)                 (((i) - 1U) / 2U)
+#define LEFT_CHILD(i)             (2U * (i) + 1U)
+
+/********************** internal data declaration ****************************/
+
+/********************** internal functions declaration ***********************/
+
+static void _place (indexed_pq_t* ipq, uint32_t slot, uint32_t index);
+
+static void _sift_up (indexed_pq_t* ipq, uint32_t slot, uint32_t index);
+
+static void _sift_down (indexed_pq_t* ipq, uint32_t slot, uint32_t index);
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static void _place (indexed_pq_t* ipq, uint32_t slot, uint32_t index) {
+
+  ipq->heap[slot] = index;
+  ipq->position[index] = slot;
+
+}
+
+
+static void _sift_up (indexed_pq_t* ipq, uint32_t slot, uint32_t index) {
+
+  uint64_t key = ipq->keys[index];
+
+  while (slot > 0 && ipq->keys[ipq->heap[PARENT(slot)]] > key) {
+
+    _place (ipq, slot, ipq->heap[PARENT(slot)]);
+    slot = PARENT(slot);
+
+  }
+
+  _place (ipq, slot, index);
+
+}
+
+
+static void _sift_down (indexed_pq_t* ipq, uint32_t slot, uint32_t index) {
+
+  uint64_t key = ipq->keys[index];
+  bool settled = false;
+
+  while (!settled && LEFT_CHILD(slot) < ipq->size) {
+
+    uint32_t child = LEFT_CHILD(slot);
+
+    if (child + 1U < ipq->size && ipq->keys[ipq->heap[child + 1U]] < ipq->keys[ipq->heap[child]]) {
+
+      child++;
+
+    }
+
+    if (ipq->keys[ipq->heap[child]] < key) {
+
+      _place (ipq, slot, ipq->heap[child]);
+      slot = child;
+
+    } else {
+
+      settled = true;
+
+    }
+
+  }
+
+  _place (ipq, slot, index);
+
+}
+
+/********************** external functions definition ************************/
+
+indexed_pq_t* ipq_create (void* memory_pool, uint32_t capacity) {
+
+  indexed_pq_t* ipq = NULL;
+
+  if (NULL != memory_pool && capacity > 0 && capacity < IPQ_ABSENT) {
+
+    ipq = (indexed_pq_t*)memory_pool;
+
+    ipq->keys = (uint64_t*)((char*)memory_pool + sizeof(indexed_pq_t));
+    ipq->heap = (uint32_t*)(ipq->keys + capacity);
+    ipq->position = ipq->heap + capacity;
+    ipq->size = 0;
+    ipq->capacity = capacity;
+
+    for (uint32_t i = 0; i < capacity; i++) {
+
+      ipq->position[i] = IPQ_ABSENT;
+
+    }
+
+  }
+
+  return ipq;
+
+}
+
+
+bool ipq_push_or_decrease (indexed_pq_t* ipq, uint32_t index, uint64_t key) {
+
+  bool successful = false;
+
+  if (NULL != ipq && index < ipq->capacity) {
+
+    if (IPQ_ABSENT == ipq->position[index]) {
+
+      ipq->keys[index] = key;
+      _sift_up (ipq, ipq->size++, index);
+
+      successful = true;
+
+    } else if (key < ipq->keys[index]) {
+
+      ipq->keys[index] = key;
+      _sift_up (ipq, ipq->position[index], index);
+
+      successful = true;
+
+    }
+
+  }
+
+  return successful;
+
+}
+
+
+bool ipq_pop (indexed_pq_t* ipq, uint32_t* index, uint64_t* key) {
+
+  bool successful = false;
+
+  if (NULL != ipq && ipq->size > 0) {
+
+    uint32_t top = ipq->heap[0];
+
+    if (NULL != index) {
+
+      *index = top;
+
+    }
+
+    if (NULL != key) {
+
+      *key = ipq->keys[top];
+
+    }
+
+    ipq->position[top] = IPQ_ABSENT;
+    ipq->size--;
+
+    if (ipq->size > 0) {
+
+      _sift_down (ipq, 0, ipq->heap[ipq->size]);
+
+    }
+
+    successful = true;
+
+  }
+
+  return successful;
+
+}
+
+
+bool ipq_contains (const indexed_pq_t* ipq, uint32_t index) {
+
+  return (NULL != ipq && index < ipq->capacity && IPQ_ABSENT != ipq->position[index]);
+
+}
+
+
+bool ipq_is_empty (const indexed_pq_t* ipq) {
+
+  return (NULL == ipq || 0 == ipq->size);
+
+}
+
+
+void ipq_clear (indexed_pq_t* ipq) {
+
+  if (NULL != ipq) {
+
+    for (uint32_t i = 0; i < ipq->size; i++) {
+
+      ipq->position[ipq->heap[i]] = IPQ_ABSENT;
+
+    }
+
+    ipq->size = 0;
+
+  }
+
+}
+
+/********************** end of file ******************************************/
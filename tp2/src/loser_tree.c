@@ -0,0 +1,210 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Implementation file for loser tree module
+ **
+ ** Leaves are the positions k..2k-1 of an implicit complete binary tree (source s at k + s),
+ ** internal nodes the positions 1..k-1, so any k works, not only powers of two.
+ **
+ ** \addtogroup loser_tree module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** inclusions *******************************************/
+
+#include "loser_tree.h"
+
+/********************** macros and definitions *******************************/
+#define ROOT                      1U
+#define WINNER                    0U
+
+/********************** internal data declaration ****************************/
+
+/********************** internal functions declaration ***********************/
+
+static bool _beats (loser_tree_t* lt, uint32_t a, uint32_t b);
+
+static uint32_t _play (loser_tree_t* lt, uint32_t position);
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static bool _beats (loser_tree_t* lt, uint32_t a, uint32_t b) {
+
+  bool wins = false;
+
+  if (lt->exhausted[a] || lt->exhausted[b]) {
+
+    wins = !lt->exhausted[a] || (lt->exhausted[b] && a < b);
+
+  } else {
+
+    int order = lt->compare (a, b, lt->ctx);
+
+    lt->comparisons++;
+    wins = (order < 0) || (0 == order && a < b);
+
+  }
+
+  return wins;
+
+}
+
+
+static uint32_t _play (loser_tree_t* lt, uint32_t position) {
+
+  uint32_t winner = position - lt->k;
+
+  if (position < lt->k) {
+
+    uint32_t left = _play (lt, 2U * position);
+    uint32_t right = _play (lt, 2U * position + 1U);
+
+    if (_beats (lt, left, right)) {
+
+      winner = left;
+      lt->losers[position] = right;
+
+    } else {
+
+      winner = right;
+      lt->losers[position] = left;
+
+    }
+
+  }
+
+  return winner;
+
+}
+
+/********************** external functions definition ************************/
+
+loser_tree_t* lt_create (void* memory_pool, uint32_t k, lt_compare_t compare, void* ctx) {
+
+  loser_tree_t* lt = NULL;
+
+  if (NULL != memory_pool && NULL != compare && k > 0 && k < LT_NO_SOURCE / 2U) {
+
+    lt = (loser_tree_t*)memory_pool;
+
+    lt->losers = (uint32_t*)((char*)memory_pool + sizeof(loser_tree_t));
+    lt->exhausted = (uint8_t*)(lt->losers + k);
+    lt->k = k;
+    lt->compare = compare;
+    lt->ctx = ctx;
+    lt->comparisons = 0;
+
+    for (uint32_t source = 0; source < k; source++) {
+
+      lt->exhausted[source] = false;
+
+    }
+
+  }
+
+  return lt;
+
+}
+
+
+void lt_build (loser_tree_t* lt) {
+
+  if (NULL != lt) {
+
+    lt->losers[WINNER] = (lt->k > 1U) ? _play (lt, ROOT) : 0U;
+
+  }
+
+}
+
+
+uint32_t lt_winner (const loser_tree_t* lt) {
+
+  uint32_t winner = LT_NO_SOURCE;
+
+  if (NULL != lt && !lt->exhausted[lt->losers[WINNER]]) {
+
+    winner = lt->losers[WINNER];
+
+  }
+
+  return winner;
+
+}
+
+
+void lt_replay (loser_tree_t* lt) {
+
+  if (NULL != lt) {
+
+    uint32_t winner = lt->losers[WINNER];
+
+    for (uint32_t position = (lt->k + winner) / 2U; position >= ROOT; position /= 2U) {
+
+      // The stored loser challenges the one coming up; the better goes on
+      if (_beats (lt, lt->losers[position], winner)) {
+
+        uint32_t loser = winner;
+
+        winner = lt->losers[position];
+        lt->losers[position] = loser;
+
+      }
+
+    }
+
+    lt->losers[WINNER] = winner;
+
+  }
+
+}
+
+
+void lt_retire (loser_tree_t* lt) {
+
+  if (NULL != lt) {
+
+    lt->exhausted[lt->losers[WINNER]] = true;
+    lt_replay (lt);
+
+  }
+
+}
+
+
+void lt_mark_exhausted (loser_tree_t* lt, uint32_t source) {
+
+  if (NULL != lt && source < lt->k) {
+
+    lt->exhausted[source] = true;
+
+  }
+
+}
+
+/********************** end of file ******************************************/
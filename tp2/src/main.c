@@ -19,9 +19,14 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 SPDX-License-Identifier: MIT
 *************************************************************************************************/
 
-/** \brief Brief description of the file
+/** \brief Demo of the cooperative scheduler
  **
- ** Full file description
+ ** Registers thousands of synthetic periodic tasks with random periods, runs them under EDF
+ ** against the monotonic clock for a few seconds and reports the dispatch overhead per job,
+ ** the start jitter (start time minus release time) and the deadline misses.
+ **
+ ** Built with -DPQ_TRACE it also records every call to the scheduler queues into TRACE_PATH,
+ ** to be replayed with tools/pq_replay.c.
  **
  ** \addtogroup name Module denomination
  ** \brief Brief description of the module
@@ -29,10 +34,26 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions =============================================================== */
 
+#define _POSIX_C_SOURCE 200809L
+
 #include "main.h"
+#include "pq_trace.h"
+#include "scheduler.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
 
 /* === Macros definitions ====================================================================== */
 
+#define TASKS_NUMBER  4000
+#define TICK_NS       10000U                // Scheduler tick, so periods fit SCHED_MAX_INTERVAL
+#define MIN_PERIOD    1000U                 // Ticks
+#define MAX_PERIOD    10000U                // Ticks
+#define RUN_TIME      (3U * 100000U)        // Ticks
+#define TRACE_RECORDS (4U * 1024U * 1024U)  // Ring of the trace, the last calls are kept
+#define TRACE_PATH    "pq_trace.bin"
+
 /* === Private data type declarations ========================================================== */
 
 /* === Private variable declarations =========================================================== */
@@ -43,12 +64,131 @@ SPDX-License-Identifier: MIT
 
 /* === Private variable definitions ============================================================ */
 
+static volatile uint32_t work = 0;
+
 /* === Private function implementation ========================================================= */
 
+static uint64_t _now_ns(void) {
+
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+
+}
+
+static uint64_t _clock_ticks(void* ctx) {
+
+  (void)ctx;
+  return _now_ns() / TICK_NS;
+
+}
+
+static void _job(void* ctx) {
+
+  work += (uint32_t)(uintptr_t)ctx;
+
+}
+
 /* === Public function implementation ========================================================== */
 
 int main(void) {
 
+  void* releases_pool = malloc(PQ_MEMORY_SIZE(TASKS_NUMBER));
+  void* ready_pool = malloc(PQ_MEMORY_SIZE(TASKS_NUMBER));
+  sched_task_t* tasks = malloc(TASKS_NUMBER * sizeof(sched_task_t));
+  scheduler_t sched;
+  uint64_t start = 0;
+  uint64_t busy_ns = 0;
+  uint64_t total_jitter = 0;
+  uint64_t max_jitter = 0;
+  uint32_t seed = 1;
+
+#ifdef PQ_TRACE
+  pq_trace_record_t* trace = malloc(TRACE_RECORDS * sizeof(pq_trace_record_t));
+
+  if (NULL == trace || !pq_trace_start(trace, TRACE_RECORDS)) {
+
+    fprintf(stderr, "No se pudo iniciar la traza\n");
+    return EXIT_FAILURE;
+
+  }
+#endif
+
+  if (NULL == tasks || !sched_init(&sched, releases_pool, ready_pool, TASKS_NUMBER, SCHED_EDF,
+                                   _clock_ticks, NULL)) {
+
+    fprintf(stderr, "No se pudo crear el planificador\n");
+    return EXIT_FAILURE;
+
+  }
+
+  start = _clock_ticks(NULL);
+
+  for (size_t i = 0; i < TASKS_NUMBER; i++) {
+
+    seed = seed * 1103515245U + 12345U;
+    uint32_t period = MIN_PERIOD + (seed >> 8) % (MAX_PERIOD - MIN_PERIOD);
+
+    if (!sched_task_init(&tasks[i], _job, (void*)(uintptr_t)i, period, period, 0) ||
+        !sched_add(&sched, &tasks[i], start + period % MIN_PERIOD)) {
+
+      fprintf(stderr, "No se pudo agregar la tarea %zu\n", i);
+      return EXIT_FAILURE;
+
+    }
+
+  }
+
+  while (_clock_ticks(NULL) < start + RUN_TIME) {
+
+    uint64_t before = _now_ns();
+
+    if (sched_run_once(&sched)) {
+
+      busy_ns += _now_ns() - before;
+
+    }
+
+  }
+
+  for (size_t i = 0; i < TASKS_NUMBER; i++) {
+
+    total_jitter += tasks[i].total_jitter;
+
+    if (tasks[i].max_jitter > max_jitter) {
+
+      max_jitter = tasks[i].max_jitter;
+
+    }
+
+  }
+
+  printf("%d tareas, %zu despachos en %u s\n", TASKS_NUMBER, sched.dispatched,
+         (unsigned)((uint64_t)RUN_TIME * TICK_NS / 1000000000U));
+
+  if (sched.dispatched > 0) {
+
+    printf("costo por despacho: %.1f ns\n", (double)busy_ns / (double)sched.dispatched);
+    printf("fluctuacion de inicio: media %.1f us, maxima %llu us\n",
+           (double)total_jitter * TICK_NS / 1000.0 / (double)sched.dispatched,
+           (unsigned long long)(max_jitter * TICK_NS / 1000U));
+
+  }
+
+  printf("plazos incumplidos: %zu\n", sched.misses);
+
+#ifdef PQ_TRACE
+  pq_trace_stop();
+  printf("traza: %zu llamadas (%llu perdidas) en %s: %s\n", pq_trace_count(),
+         (unsigned long long)pq_trace_dropped(), TRACE_PATH,
+         pq_trace_save(TRACE_PATH) ? "guardada" : "error al guardar");
+  free(trace);
+#endif
+
+  free(tasks);
+  free(ready_pool);
+  free(releases_pool);
+
   return 0;
 
 }
@@ -0,0 +1,287 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Implementation file for pairing heap module
+ **
+ ** Two-pass pairing heap (Fredman, Sedgewick, Sleator and Tarjan, 1986). Both passes of the
+ ** extraction are iterative, so the stack use does not depend on the heap shape.
+ **
+ ** \addtogroup pairing_heap module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** inclusions *******************************************/
+
+#include "pairing_heap.h"
+#include <stdatomic.h>
+
+/********************** macros and definitions *******************************/
+#define NO_ELEMENTS_IN_HEAP       0
+
+/********************** internal data declaration ****************************/
+
+/********************** internal functions declaration ***********************/
+
+static bool _precedes (pq_type_t type, const ph_node_t* a, const ph_node_t* b);
+
+static ph_node_t* _meld (pq_type_t type, ph_node_t* a, ph_node_t* b);
+
+static ph_node_t* _merge_pairs (pq_type_t type, ph_node_t* first);
+
+/********************** internal data definition *****************************/
+
+// Shared by every heap, so insertion order is comparable after a meld. Atomic, since heaps
+// owned by different threads still draw from it
+static atomic_size_t _next_insertion_index = 0;
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static bool _precedes (pq_type_t type, const ph_node_t* a, const ph_node_t* b) {
+
+  bool precedes = false;
+
+  if (a->item.priority == b->item.priority) {
+
+    precedes = a->item.insertion_index < b->item.insertion_index;
+
+  } else if (PQ_MAX_PRIORITY_QUEUE == type) {
+
+    precedes = a->item.priority > b->item.priority;
+
+  } else { // MIN_PRIORITY_QUEUE
+
+    precedes = a->item.priority < b->item.priority;
+
+  }
+
+  return precedes;
+
+}
+
+
+// Links two roots: the one that loses becomes the leftmost child of the other
+static ph_node_t* _meld (pq_type_t type, ph_node_t* a, ph_node_t* b) {
+
+  ph_node_t* root = a;
+
+  if (NULL == a) {
+
+    root = b;
+
+  } else if (NULL != b) {
+
+    ph_node_t* other = b;
+
+    if (_precedes (type, b, a)) {
+
+      root = b;
+      other = a;
+
+    }
+
+    other->sibling = root->child;
+    root->child = other;
+
+  }
+
+  return root;
+
+}
+
+
+static ph_node_t* _merge_pairs (pq_type_t type, ph_node_t* first) {
+
+  ph_node_t* pairs = NULL; // Melded pairs, last pair first
+  ph_node_t* root = NULL;
+
+  // First pass: meld siblings in pairs from left to right
+  while (NULL != first) {
+
+    ph_node_t* a = first;
+    ph_node_t* b = a->sibling;
+    ph_node_t* pair = a;
+
+    first = (NULL != b) ? b->sibling : NULL;
+
+    a->sibling = NULL;
+
+    if (NULL != b) {
+
+      b->sibling = NULL;
+      pair = _meld (type, a, b);
+
+    }
+
+    pair->sibling = pairs;
+    pairs = pair;
+
+  }
+
+  // Second pass: meld the pairs from right to left
+  while (NULL != pairs) {
+
+    ph_node_t* next = pairs->sibling;
+
+    pairs->sibling = NULL;
+    root = _meld (type, root, pairs);
+    pairs = next;
+
+  }
+
+  return root;
+
+}
+
+/********************** external functions definition ************************/
+
+bool ph_init (pairing_heap_t* heap, pq_type_t type) {
+
+  bool successful = false;
+
+  if (NULL != heap) {
+
+    heap->root = NULL;
+    heap->size = NO_ELEMENTS_IN_HEAP;
+    heap->type = type;
+
+    successful = true;
+
+  }
+
+  return successful;
+
+}
+
+
+bool ph_insert (pairing_heap_t* heap, ph_node_t* node, void* data, uint16_t priority) {
+
+  bool successful = false;
+
+  if (NULL != heap && NULL != node && NULL != data) {
+
+    node->item.priority = priority;
+    node->item.insertion_index = atomic_fetch_add_explicit (&_next_insertion_index, 1, memory_order_relaxed);
+    node->item.data = data;
+    node->child = NULL;
+    node->sibling = NULL;
+
+    heap->root = _meld (heap->type, heap->root, node);
+    heap->size++;
+
+    successful = true;
+
+  }
+
+  return successful;
+
+}
+
+
+ph_node_t* ph_peek (pairing_heap_t* heap) {
+
+  ph_node_t* node = NULL;
+
+  if (NULL != heap) {
+
+    node = heap->root;
+
+  }
+
+  return node;
+
+}
+
+
+ph_node_t* ph_extract (pairing_heap_t* heap) {
+
+  ph_node_t* node = NULL;
+
+  if (NULL != heap && NULL != heap->root) {
+
+    node = heap->root;
+
+    heap->root = _merge_pairs (heap->type, node->child);
+    heap->size--;
+
+    node->child = NULL;
+
+  }
+
+  return node;
+
+}
+
+
+bool ph_merge (pairing_heap_t* dst, pairing_heap_t* src) {
+
+  bool successful = false;
+
+  if (NULL != dst && NULL != src && dst != src && dst->type == src->type) {
+
+    dst->root = _meld (dst->type, dst->root, src->root);
+    dst->size += src->size;
+
+    src->root = NULL;
+    src->size = NO_ELEMENTS_IN_HEAP;
+
+    successful = true;
+
+  }
+
+  return successful;
+
+}
+
+
+bool ph_is_empty (pairing_heap_t* heap) {
+
+  bool is_empty = true;
+
+  if (NULL != heap) {
+
+    is_empty = (NO_ELEMENTS_IN_HEAP == heap->size);
+
+  }
+
+  return is_empty;
+
+}
+
+
+size_t ph_size (pairing_heap_t* heap) {
+
+  size_t size = 0;
+
+  if (NULL != heap) {
+
+    size = heap->size;
+
+  }
+
+  return size;
+
+}
+
+/********************** end of file ******************************************/
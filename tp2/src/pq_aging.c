@@ -0,0 +1,202 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Implementation file for priority queue aging module
+ **
+ ** Stored key: urgency + rate * epoch - shift, where urgency is the priority for a min queue
+ ** and its complement for a max queue (smaller is always more urgent inside). Renormalizing
+ ** lowers every key and raises shift by the same delta, which is never more than the epoch
+ ** part of the keys (so new keys stay non negative) nor than the root key (so stored keys do).
+ **
+ ** \addtogroup pq_aging module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** inclusions *******************************************/
+
+#include "pq_aging.h"
+
+/********************** macros and definitions *******************************/
+
+/********************** internal data declaration ****************************/
+
+/********************** internal functions declaration ***********************/
+
+static uint64_t _age (const pq_aging_t* aq);
+
+static void _renormalize (pq_aging_t* aq);
+
+static uint16_t _key (pq_aging_t* aq, uint16_t priority);
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static uint64_t _age (const pq_aging_t* aq) {
+
+  return (uint64_t)aq->rate * aq->epoch - aq->shift;
+
+}
+
+
+static void _renormalize (pq_aging_t* aq) {
+
+  uint64_t delta = _age (aq);
+
+  if (!pq_is_empty (aq->pq) && aq->pq->nodes[0].priority < delta) {
+
+    delta = aq->pq->nodes[0].priority;
+
+  }
+
+  // Every key is at least the root key, so the heap order is kept
+  for (size_t i = 0; i < aq->pq->size; i++) {
+
+    aq->pq->nodes[i].priority -= (uint16_t)delta;
+
+  }
+
+  aq->shift += delta;
+
+}
+
+
+static uint16_t _key (pq_aging_t* aq, uint16_t priority) {
+
+  uint64_t urgency = (PQ_MIN_PRIORITY_QUEUE == aq->type) ? priority : UINT16_MAX - priority;
+  uint64_t key = urgency + _age (aq);
+
+  if (key > UINT16_MAX) {
+
+    _renormalize (aq);
+    key = urgency + _age (aq);
+
+  }
+
+  return (key < UINT16_MAX) ? (uint16_t)key : UINT16_MAX;
+
+}
+
+/********************** external functions definition ************************/
+
+bool pq_aging_init (pq_aging_t* aq, void* memory_pool, size_t capacity,
+                    pq_type_t type, uint16_t rate) {
+
+  bool successful = false;
+
+  if (NULL != aq && (PQ_MIN_PRIORITY_QUEUE == type || PQ_MAX_PRIORITY_QUEUE == type)) {
+
+    aq->pq = pq_create (memory_pool, capacity, PQ_MIN_PRIORITY_QUEUE);
+
+    if (NULL != aq->pq) {
+
+      aq->type = type;
+      aq->rate = rate;
+      aq->epoch = 0;
+      aq->shift = 0;
+
+      successful = true;
+
+    }
+
+  }
+
+  return successful;
+
+}
+
+
+bool pq_aging_insert (pq_aging_t* aq, void* data, uint16_t priority) {
+
+  bool successful = false;
+
+  if (NULL != aq && aq->pq->size < aq->pq->capacity) {
+
+    successful = pq_insert (aq->pq, data, _key (aq, priority));
+
+  }
+
+  return successful;
+
+}
+
+
+void* pq_aging_peek (pq_aging_t* aq) {
+
+  void* data = NULL;
+
+  if (NULL != aq) {
+
+    data = pq_peek (aq->pq);
+
+  }
+
+  return data;
+
+}
+
+
+void* pq_aging_extract (pq_aging_t* aq) {
+
+  void* data = NULL;
+
+  if (NULL != aq) {
+
+    data = pq_extract (aq->pq);
+
+  }
+
+  return data;
+
+}
+
+
+void pq_aging_tick (pq_aging_t* aq) {
+
+  if (NULL != aq) {
+
+    aq->epoch++;
+
+  }
+
+}
+
+
+size_t pq_aging_size (pq_aging_t* aq) {
+
+  size_t size = 0;
+
+  if (NULL != aq) {
+
+    size = pq_size (aq->pq);
+
+  }
+
+  return size;
+
+}
+
+/********************** end of file ******************************************/
@@ -0,0 +1,694 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Implementation file for parallel bulk operations on priority queues
+ **
+ ** \addtogroup pq_parallel module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** inclusions *******************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "pq_parallel.h"
+#include "pq_trace.h"
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+
+/********************** macros and definitions *******************************/
+#define ROOT_INDEX                0
+#define NO_ELEMENTS_IN_QUEUE      0
+#define SUBTREES_PER_THREAD       4 // Evens out the partial subtrees on the right edge
+
+typedef void* (*worker_t) (void* task);
+
+typedef struct {
+
+  priority_queue_t* pq;
+  size_t first_root;
+  size_t end_root;
+
+} build_task_t;
+
+typedef struct {
+
+  priority_queue_t* pq;
+  void* const* data;
+  const uint16_t* priorities;
+  size_t begin;
+  size_t end;
+
+} append_task_t;
+
+typedef struct {
+
+  priority_queue_t* pq;
+  pq_predicate_t predicate;
+  void* ctx;
+  size_t begin;
+  size_t end;
+  size_t kept;
+  size_t removed;
+
+} compact_task_t;
+
+typedef struct {
+
+  const priority_queue_t* pq;
+  pq_node_t* out;
+  size_t begin;
+  size_t end;
+  size_t offset;
+  size_t exported;
+
+} export_task_t;
+
+typedef struct {
+
+  size_t start;
+  size_t length;
+
+} run_t;
+
+typedef struct {
+
+  const priority_queue_t* pq;
+  const pq_node_t* src;
+  pq_node_t* dst;
+  run_t a;
+  run_t b;
+  size_t first;  // Output range of the task, relative to a.start
+  size_t end;
+
+} merge_task_t;
+
+/********************** internal data declaration ****************************/
+
+/********************** internal functions declaration ***********************/
+
+static size_t _threads (size_t requested, size_t nodes);
+
+static void _run (worker_t worker, void* tasks, size_t task_size, size_t count);
+
+static void _sift_down (priority_queue_t* pq, size_t index);
+
+static void _build_heap (priority_queue_t* pq, size_t threads);
+
+static size_t _compact (priority_queue_t* pq, pq_predicate_t predicate, void* ctx, size_t threads);
+
+static size_t _co_rank (const priority_queue_t* pq, const pq_node_t* a, size_t a_length,
+                        const pq_node_t* b, size_t b_length, size_t k);
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static size_t _threads (size_t requested, size_t nodes) {
+
+  size_t threads = requested;
+
+  if (0 == threads) {
+
+    long online = sysconf (_SC_NPROCESSORS_ONLN);
+    threads = (online > 0) ? (size_t)online : 1;
+
+  }
+
+  if (threads > PQ_PARALLEL_MAX_THREADS) {
+
+    threads = PQ_PARALLEL_MAX_THREADS;
+
+  }
+
+  if (threads > nodes / PQ_PARALLEL_GRAIN) {
+
+    threads = (nodes >= PQ_PARALLEL_GRAIN) ? nodes / PQ_PARALLEL_GRAIN : 1;
+
+  }
+
+  return threads;
+
+}
+
+
+// Runs every task, the first one on the calling thread, and waits for all of them
+static void _run (worker_t worker, void* tasks, size_t task_size, size_t count) {
+
+  pthread_t threads[PQ_PARALLEL_MAX_THREADS];
+  bool started[PQ_PARALLEL_MAX_THREADS];
+
+  for (size_t i = 1; i < count; i++) {
+
+    started[i] = (0 == pthread_create (&threads[i], NULL, worker, (char*)tasks + i * task_size));
+
+    if (!started[i]) {
+
+      worker ((char*)tasks + i * task_size);
+
+    }
+
+  }
+
+  if (count > 0) {
+
+    worker (tasks);
+
+  }
+
+  for (size_t i = 1; i < count; i++) {
+
+    if (started[i]) {
+
+      pthread_join (threads[i], NULL);
+
+    }
+
+  }
+
+}
+
+
+// Same comparisons and swaps as the sift-down of priority_queue.c
+static void _sift_down (priority_queue_t* pq, size_t index) {
+
+  bool sifting = true;
+
+  while (sifting) {
+
+    size_t best = index;
+    size_t left = 2 * index + 1;
+    size_t right = 2 * index + 2;
+
+    if (left < pq->size && pq_node_precedes (pq, &pq->nodes[left], &pq->nodes[best])) {
+
+      best = left;
+
+    }
+
+    if (right < pq->size && pq_node_precedes (pq, &pq->nodes[right], &pq->nodes[best])) {
+
+      best = right;
+
+    }
+
+    sifting = (best != index);
+
+    if (sifting) {
+
+      pq_node_t temp_node = pq->nodes[index];
+      pq->nodes[index] = pq->nodes[best];
+      pq->nodes[best] = temp_node;
+
+      index = best;
+
+    }
+
+  }
+
+}
+
+
+// Heapifies the subtrees rooted at [first_root, end_root), one level at a time from the bottom;
+// the descendants of a run of consecutive roots are consecutive on every level
+static void* _build_subtrees (void* arg) {
+
+  build_task_t* task = (build_task_t*)arg;
+  size_t internal = task->pq->size / 2; // Nodes with children
+  size_t depth = 0;
+
+  while (((task->first_root + 1) << (depth + 1)) - 1 < internal) {
+
+    depth++;
+
+  }
+
+  for (size_t d = depth + 1; d > 0; d--) {
+
+    size_t first = ((task->first_root + 1) << (d - 1)) - 1;
+    size_t end = ((task->end_root + 1) << (d - 1)) - 1;
+
+    if (end > internal) {
+
+      end = internal;
+
+    }
+
+    for (size_t i = end; i > first; i--) {
+
+      _sift_down (task->pq, i - 1);
+
+    }
+
+  }
+
+  return NULL;
+
+}
+
+
+static void _build_heap (priority_queue_t* pq, size_t threads) {
+
+  size_t internal = pq->size / 2;
+  size_t roots = 1;
+  size_t top = internal;
+
+  while (roots < SUBTREES_PER_THREAD * threads) {
+
+    roots *= 2;
+
+  }
+
+  // The roots of the split level start at index roots - 1
+  if (threads > 1 && roots - 1 < internal) {
+
+    build_task_t tasks[PQ_PARALLEL_MAX_THREADS];
+
+    for (size_t t = 0; t < threads; t++) {
+
+      tasks[t].pq = pq;
+      tasks[t].first_root = roots - 1 + t * roots / threads;
+      tasks[t].end_root = roots - 1 + (t + 1) * roots / threads;
+
+    }
+
+    _run (_build_subtrees, tasks, sizeof(build_task_t), threads);
+
+    top = roots - 1;
+
+  }
+
+  for (size_t i = top; i > ROOT_INDEX; i--) {
+
+    _sift_down (pq, i - 1);
+
+  }
+
+}
+
+
+static void* _append_range (void* arg) {
+
+  append_task_t* task = (append_task_t*)arg;
+  pq_node_t* nodes = &task->pq->nodes[task->pq->size];
+
+  for (size_t i = task->begin; i < task->end; i++) {
+
+    nodes[i].data = task->data[i];
+    nodes[i].priority = task->priorities[i];
+    nodes[i].insertion_index = task->pq->next_insertion_index + i;
+
+  }
+
+  return NULL;
+
+}
+
+
+// Keeps the live nodes not selected by the predicate at the front of the range, in order
+static void* _compact_range (void* arg) {
+
+  compact_task_t* task = (compact_task_t*)arg;
+  pq_node_t* nodes = task->pq->nodes;
+  size_t kept = task->begin;
+
+  for (size_t i = task->begin; i < task->end; i++) {
+
+    if (NULL == nodes[i].data) {
+
+      continue; // Tombstone
+
+    }
+
+    if (NULL != task->predicate && task->predicate (&nodes[i], task->ctx)) {
+
+      task->removed++;
+
+    } else {
+
+      nodes[kept++] = nodes[i];
+
+    }
+
+  }
+
+  task->kept = kept - task->begin;
+
+  return NULL;
+
+}
+
+
+static size_t _compact (priority_queue_t* pq, pq_predicate_t predicate, void* ctx, size_t threads) {
+
+  compact_task_t tasks[PQ_PARALLEL_MAX_THREADS];
+  size_t kept = 0;
+  size_t removed = 0;
+
+  for (size_t t = 0; t < threads; t++) {
+
+    tasks[t].pq = pq;
+    tasks[t].predicate = predicate;
+    tasks[t].ctx = ctx;
+    tasks[t].begin = t * pq->size / threads;
+    tasks[t].end = (t + 1) * pq->size / threads;
+    tasks[t].kept = 0;
+    tasks[t].removed = 0;
+
+  }
+
+  _run (_compact_range, tasks, sizeof(compact_task_t), threads);
+
+  // Every slice moves down, never past the start of the previous one
+  for (size_t t = 0; t < threads; t++) {
+
+    memmove (&pq->nodes[kept], &pq->nodes[tasks[t].begin], tasks[t].kept * sizeof(pq_node_t));
+
+    kept += tasks[t].kept;
+    removed += tasks[t].removed;
+
+  }
+
+  pq->size = kept;
+  pq->tombstones = NO_ELEMENTS_IN_QUEUE;
+
+  _build_heap (pq, threads);
+
+  return removed;
+
+}
+
+
+static void* _count_live (void* arg) {
+
+  export_task_t* task = (export_task_t*)arg;
+
+  for (size_t i = task->begin; i < task->end; i++) {
+
+    task->exported += (NULL != task->pq->nodes[i].data);
+
+  }
+
+  return NULL;
+
+}
+
+
+// Sorts the slice through a view of the queue, which does not have to be a heap
+static void* _export_range (void* arg) {
+
+  export_task_t* task = (export_task_t*)arg;
+  priority_queue_t view = *task->pq;
+
+  view.nodes = &task->pq->nodes[task->begin];
+  view.size = task->end - task->begin;
+
+  task->exported = pq_export_sorted (&view, &task->out[task->offset]);
+
+  return NULL;
+
+}
+
+
+// Number of nodes of a among the first k of the merge of a and b
+static size_t _co_rank (const priority_queue_t* pq, const pq_node_t* a, size_t a_length,
+                        const pq_node_t* b, size_t b_length, size_t k) {
+
+  size_t low = (k > b_length) ? k - b_length : 0;
+  size_t high = (k < a_length) ? k : a_length;
+
+  while (low < high) {
+
+    size_t i = low + (high - low) / 2;
+
+    if (pq_node_precedes (pq, &a[i], &b[k - i - 1])) {
+
+      low = i + 1;
+
+    } else {
+
+      high = i;
+
+    }
+
+  }
+
+  return low;
+
+}
+
+
+static void* _merge_range (void* arg) {
+
+  merge_task_t* task = (merge_task_t*)arg;
+  const pq_node_t* a = &task->src[task->a.start];
+  const pq_node_t* b = &task->src[task->b.start];
+  pq_node_t* out = &task->dst[task->a.start];
+  size_t i = _co_rank (task->pq, a, task->a.length, b, task->b.length, task->first);
+  size_t j = task->first - i;
+  size_t a_end = _co_rank (task->pq, a, task->a.length, b, task->b.length, task->end);
+  size_t b_end = task->end - a_end;
+
+  for (size_t k = task->first; k < task->end; k++) {
+
+    if (j >= b_end || (i < a_end && !pq_node_precedes (task->pq, &b[j], &a[i]))) {
+
+      out[k] = a[i++];
+
+    } else {
+
+      out[k] = b[j++];
+
+    }
+
+  }
+
+  return NULL;
+
+}
+
+/********************** external functions definition ************************/
+
+bool pq_parallel_insert_bulk (priority_queue_t* pq, void* const* data, const uint16_t* priorities,
+                              size_t count, size_t threads) {
+
+  bool successful = false;
+
+  // The live nodes plus the new ones must fit, once the tombstones are reclaimed
+  if (NULL != pq && NULL != data && NULL != priorities &&
+      count <= pq->capacity - (pq->size - pq->tombstones)) {
+
+    successful = true;
+
+    for (size_t i = 0; successful && i < count; i++) {
+
+      successful = (NULL != data[i]);
+
+    }
+
+    if (successful && pq->size + count > pq->capacity && pq->tombstones > NO_ELEMENTS_IN_QUEUE) {
+
+      _compact (pq, NULL, NULL, _threads (threads, pq->size));
+
+    }
+
+    if (successful && pq->size + count <= pq->capacity) {
+
+      append_task_t tasks[PQ_PARALLEL_MAX_THREADS];
+      size_t workers = _threads (threads, pq->size + count);
+
+      for (size_t t = 0; t < workers; t++) {
+
+        tasks[t].pq = pq;
+        tasks[t].data = data;
+        tasks[t].priorities = priorities;
+        tasks[t].begin = t * count / workers;
+        tasks[t].end = (t + 1) * count / workers;
+
+      }
+
+      _run (_append_range, tasks, sizeof(append_task_t), workers);
+
+      pq->size += count;
+      pq->next_insertion_index += count;
+
+      _build_heap (pq, workers);
+
+      for (size_t i = 0; i < count; i++) {
+
+        PQ_TRACE_RECORD (pq, PQ_TRACE_INSERT, priorities[i]);
+
+      }
+
+    } else {
+
+      successful = false;
+
+    }
+
+  }
+
+  return successful;
+
+}
+
+
+size_t pq_parallel_remove_if (priority_queue_t* pq, pq_predicate_t predicate, void* ctx,
+                              size_t threads) {
+
+  size_t removed = 0;
+
+  if (NULL != pq && NULL != predicate) {
+
+    removed = _compact (pq, predicate, ctx, _threads (threads, pq->size));
+
+    PQ_TRACE_RECORD (pq, PQ_TRACE_REMOVE, (removed > UINT16_MAX) ? UINT16_MAX : removed);
+
+  }
+
+  return removed;
+
+}
+
+
+size_t pq_parallel_export_sorted (const priority_queue_t* pq, pq_node_t* out, pq_node_t* scratch,
+                                  size_t threads) {
+
+  size_t exported = 0;
+
+  if (NULL != pq && NULL != out && NULL != scratch) {
+
+    size_t workers = _threads (threads, pq->size);
+    export_task_t tasks[PQ_PARALLEL_MAX_THREADS];
+    merge_task_t merges[PQ_PARALLEL_MAX_THREADS];
+    run_t runs[PQ_PARALLEL_MAX_THREADS];
+    size_t run_count = workers;
+    size_t rounds = 0;
+    pq_node_t* src = out;
+    pq_node_t* dst = scratch;
+
+    while (((size_t)1 << rounds) < workers) {
+
+      rounds++;
+
+    }
+
+    // Every round swaps the buffers: start on the side that makes the last one end in out
+    if (rounds % 2 != 0) {
+
+      src = scratch;
+      dst = out;
+
+    }
+
+    for (size_t t = 0; t < workers; t++) {
+
+      tasks[t].pq = pq;
+      tasks[t].out = src;
+      tasks[t].begin = t * pq->size / workers;
+      tasks[t].end = (t + 1) * pq->size / workers;
+      tasks[t].offset = tasks[t].begin;
+      tasks[t].exported = 0;
+
+    }
+
+    // Tombstones are skipped, so the slices land where the live nodes before them end
+    if (pq->tombstones > NO_ELEMENTS_IN_QUEUE) {
+
+      _run (_count_live, tasks, sizeof(export_task_t), workers);
+
+      for (size_t t = 0; t < workers; t++) {
+
+        tasks[t].offset = exported;
+        exported += tasks[t].exported;
+
+      }
+
+    }
+
+    _run (_export_range, tasks, sizeof(export_task_t), workers);
+
+    exported = 0;
+
+    for (size_t t = 0; t < workers; t++) {
+
+      runs[t].start = tasks[t].offset;
+      runs[t].length = tasks[t].exported;
+      exported += tasks[t].exported;
+
+    }
+
+    while (run_count > 1) {
+
+      size_t pairs = (run_count + 1) / 2;
+      size_t parts = (workers > pairs) ? workers / pairs : 1;
+      size_t count = 0;
+
+      for (size_t p = 0; p < pairs; p++) {
+
+        run_t a = runs[2 * p];
+        run_t b = { a.start + a.length, 0 };
+
+        if (2 * p + 1 < run_count) {
+
+          b = runs[2 * p + 1];
+
+        }
+
+        for (size_t part = 0; part < parts; part++) {
+
+          merges[count].pq = pq;
+          merges[count].src = src;
+          merges[count].dst = dst;
+          merges[count].a = a;
+          merges[count].b = b;
+          merges[count].first = part * (a.length + b.length) / parts;
+          merges[count].end = (part + 1) * (a.length + b.length) / parts;
+          count++;
+
+        }
+
+        runs[p].start = a.start;
+        runs[p].length = a.length + b.length;
+
+      }
+
+      _run (_merge_range, merges, sizeof(merge_task_t), count);
+
+      run_count = pairs;
+      src = dst;
+      dst = (dst == out) ? scratch : out;
+
+    }
+
+  }
+
+  return exported;
+
+}
+
+/********************** end of file ******************************************/
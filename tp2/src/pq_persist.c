@@ -0,0 +1,593 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Implementation file for persistent priority queue module
+ **
+ ** Insert and extract move a hole along one path instead of swapping nodes. Each step copies a
+ ** node into the hole, so a crash leaves the array with one node written twice on that path
+ ** and the missing node saved in the header as pending. Recovery looks for that duplicate,
+ ** puts the pending node in the hole and resumes the operation.
+ **
+ ** \addtogroup pq_persist module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** inclusions *******************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "pq_persist.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/********************** macros and definitions *******************************/
+#define ROOT_INDEX                0
+#define NO_ELEMENTS_IN_QUEUE      0
+#define FILE_PERMISSIONS          0644
+#define TEMP_SUFFIX               ".tmp"
+
+// Keeps the stores of the journal in program order
+#define PERSIST_BARRIER()         atomic_thread_fence (memory_order_release)
+
+/********************** internal data declaration ****************************/
+
+/********************** internal functions declaration ***********************/
+
+static bool _is_open (const pq_persist_t* persist);
+
+static bool _same_node (const pq_node_t* a, const pq_node_t* b);
+
+static void _sift_up (priority_queue_t* pq, const pq_node_t* node, size_t hole);
+
+static void _sift_down (priority_queue_t* pq, const pq_node_t* node, size_t hole, size_t size);
+
+static void _commit (priority_queue_t* pq, pq_persist_header_t* header);
+
+static void _recover_insert (priority_queue_t* pq, pq_persist_header_t* header);
+
+static void _recover_extract (priority_queue_t* pq, pq_persist_header_t* header);
+
+static bool _header_matches (const pq_persist_header_t* header, size_t capacity, pq_type_t type);
+
+static bool _queue_matches (const priority_queue_t* pq, const pq_persist_header_t* header);
+
+static priority_queue_t* _initialize (void* map, size_t capacity, pq_type_t type);
+
+static int _create_file (const char* path, size_t capacity, pq_type_t type);
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static bool _is_open (const pq_persist_t* persist) {
+
+  return (NULL != persist && NULL != persist->header);
+
+}
+
+
+static bool _same_node (const pq_node_t* a, const pq_node_t* b) {
+
+  return (a->insertion_index == b->insertion_index &&
+          a->priority == b->priority &&
+          a->id == b->id);
+
+}
+
+
+static void _sift_up (priority_queue_t* pq, const pq_node_t* node, size_t hole) {
+
+  while (hole > ROOT_INDEX) {
+
+    size_t parent = (hole - 1) / 2;
+
+    if (!pq_node_precedes (pq, node, &pq->nodes[parent])) {
+
+      break;
+
+    }
+
+    pq->nodes[hole] = pq->nodes[parent];
+    PERSIST_BARRIER ();
+
+    hole = parent;
+
+  }
+
+  pq->nodes[hole] = *node;
+  PERSIST_BARRIER ();
+
+}
+
+
+static void _sift_down (priority_queue_t* pq, const pq_node_t* node, size_t hole, size_t size) {
+
+  size_t child = 2 * hole + 1;
+
+  while (child < size) {
+
+    if (child + 1 < size && pq_node_precedes (pq, &pq->nodes[child + 1], &pq->nodes[child])) {
+
+      child++;
+
+    }
+
+    if (!pq_node_precedes (pq, &pq->nodes[child], node)) {
+
+      break;
+
+    }
+
+    pq->nodes[hole] = pq->nodes[child];
+    PERSIST_BARRIER ();
+
+    hole = child;
+    child = 2 * hole + 1;
+
+  }
+
+  pq->nodes[hole] = *node;
+  PERSIST_BARRIER ();
+
+}
+
+
+static void _commit (priority_queue_t* pq, pq_persist_header_t* header) {
+
+  pq->size = header->target_size;
+
+  if (pq->next_insertion_index <= header->pending.insertion_index) {
+
+    pq->next_insertion_index = header->pending.insertion_index + 1;
+
+  }
+
+  PERSIST_BARRIER ();
+  header->state = PQ_PERSIST_IDLE;
+  PERSIST_BARRIER ();
+
+}
+
+
+static void _recover_insert (priority_queue_t* pq, pq_persist_header_t* header) {
+
+  // The hole climbs from the new slot towards the root: look for the pending node already in
+  // place or for the node copied down, whose parent slot is the hole
+  size_t index = header->target_size - 1;
+  size_t hole = index;
+  bool found = false;
+
+  while (!found) {
+
+    if (_same_node (&pq->nodes[index], &header->pending)) {
+
+      hole = index;
+      found = true;
+
+    } else if (index > ROOT_INDEX) {
+
+      size_t parent = (index - 1) / 2;
+
+      if (_same_node (&pq->nodes[index], &pq->nodes[parent])) {
+
+        hole = parent;
+        found = true;
+
+      }
+
+      index = parent;
+
+    } else {
+
+      found = true;
+
+    }
+
+  }
+
+  _sift_up (pq, &header->pending, hole);
+
+}
+
+
+static void _recover_extract (priority_queue_t* pq, pq_persist_header_t* header) {
+
+  // The hole descends from the root: follow the nodes copied up until the hole is reached
+  size_t size = header->target_size;
+  size_t index = ROOT_INDEX;
+  bool placed = false;
+  bool descending = (size > NO_ELEMENTS_IN_QUEUE);
+
+  while (descending) {
+
+    size_t child = 2 * index + 1;
+    size_t next = index;
+
+    if (_same_node (&pq->nodes[index], &header->pending)) {
+
+      placed = true;
+
+    }
+
+    for (size_t c = child; !placed && next == index && c < size && c <= child + 1; c++) {
+
+      if (_same_node (&pq->nodes[c], &header->pending)) {
+
+        placed = true;
+
+      } else if (_same_node (&pq->nodes[c], &pq->nodes[index])) {
+
+        next = c;
+
+      }
+
+    }
+
+    descending = !placed && next != index;
+    index = next;
+
+  }
+
+  if (!placed && size > NO_ELEMENTS_IN_QUEUE) {
+
+    _sift_down (pq, &header->pending, index, size);
+
+  }
+
+}
+
+
+static bool _header_matches (const pq_persist_header_t* header, size_t capacity, pq_type_t type) {
+
+  return (PQ_PERSIST_MAGIC == header->magic &&
+          PQ_PERSIST_VERSION == header->version &&
+          sizeof(priority_queue_t) == header->queue_size &&
+          sizeof(pq_node_t) == header->node_size &&
+          capacity == header->capacity &&
+          (uint32_t)type == header->type &&
+          header->target_size <= capacity);
+
+}
+
+
+// O(1) checks of the mapped queue and the journal, so that neither the recovery nor the
+// queue operations index past the capacity of a corrupted file
+static bool _queue_matches (const priority_queue_t* pq, const pq_persist_header_t* header) {
+
+  bool matches = (pq->capacity == header->capacity &&
+                  (uint32_t)pq->type == header->type &&
+                  pq->size <= pq->capacity &&
+                  pq->tombstones <= pq->size);
+
+  if (PQ_PERSIST_INSERTING == header->state) {
+
+    matches = matches && header->target_size > NO_ELEMENTS_IN_QUEUE;
+
+  } else if (PQ_PERSIST_EXTRACTING == header->state) {
+
+    matches = matches && header->target_size + 1 <= header->capacity;
+
+  } else {
+
+    matches = matches && PQ_PERSIST_IDLE == header->state;
+
+  }
+
+  return matches;
+
+}
+
+static priority_queue_t* _initialize (void* map, size_t capacity, pq_type_t type) {
+
+  pq_persist_header_t* header = (pq_persist_header_t*)map;
+  priority_queue_t* pq = pq_create ((char*)map + sizeof(pq_persist_header_t), capacity, type);
+
+  header->version = PQ_PERSIST_VERSION;
+  header->queue_size = sizeof(priority_queue_t);
+  header->node_size = sizeof(pq_node_t);
+  header->capacity = capacity;
+  header->type = (uint32_t)type;
+  header->state = PQ_PERSIST_IDLE;
+  header->target_size = NO_ELEMENTS_IN_QUEUE;
+  PERSIST_BARRIER ();
+  header->magic = PQ_PERSIST_MAGIC;
+
+  return pq;
+
+}
+
+
+static int _create_file (const char* path, size_t capacity, pq_type_t type) {
+
+  // The file is built under a temporary name and renamed once complete, so a crash never
+  // leaves a file at path without a valid header
+  size_t length = PQ_PERSIST_FILE_SIZE(capacity);
+  char* temp = malloc (strlen (path) + sizeof(TEMP_SUFFIX));
+  int fd = -1;
+
+  if (NULL != temp) {
+
+    sprintf (temp, "%s%s", path, TEMP_SUFFIX);
+    fd = open (temp, O_RDWR | O_CREAT | O_TRUNC, FILE_PERMISSIONS);
+
+    bool successful = (fd >= 0 && 0 == ftruncate (fd, (off_t)length));
+    void* map = successful ? mmap (NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+
+    successful = (MAP_FAILED != map);
+
+    if (successful) {
+
+      _initialize (map, capacity, type);
+      successful = (0 == msync (map, length, MS_SYNC));
+      munmap (map, length);
+
+    }
+
+    if (successful) {
+
+      successful = (0 == rename (temp, path));
+
+    }
+
+    if (!successful && fd >= 0) {
+
+      close (fd);
+      unlink (temp);
+      fd = -1;
+
+    }
+
+    free (temp);
+
+  }
+
+  return fd;
+
+}
+
+/********************** external functions definition ************************/
+
+bool pq_persist_open (pq_persist_t* persist, const char* path, size_t capacity, pq_type_t type) {
+
+  priority_queue_t* pq = NULL;
+
+  if (NULL != persist && NULL != path && capacity > NO_ELEMENTS_IN_QUEUE) {
+
+    size_t length = PQ_PERSIST_FILE_SIZE(capacity);
+    int fd = open (path, O_RDWR);
+    struct stat info;
+
+    if (fd < 0 && ENOENT == errno) {
+
+      fd = _create_file (path, capacity, type);
+
+    }
+
+    if (fd >= 0 && 0 == fstat (fd, &info)) {
+
+      // An empty file (for example from mkstemp) is sized here; it stays with magic 0 until the
+      // header is complete, so a crash in between is handled as a new file on the next open
+      bool length_ok = (0 == info.st_size) ? (0 == ftruncate (fd, (off_t)length)) : ((off_t)length == info.st_size);
+      void* map = length_ok ? mmap (NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+
+      if (MAP_FAILED != map) {
+
+        pq_persist_header_t* header = (pq_persist_header_t*)map;
+        void* memory_pool = (char*)map + sizeof(pq_persist_header_t);
+
+        if (0 == header->magic) {
+
+          // Right length but the header was never completed: start over
+          pq = _initialize (map, capacity, type);
+
+        } else if (_header_matches (header, capacity, type) &&
+                   _queue_matches ((const priority_queue_t*)memory_pool, header)) {
+
+          pq = (priority_queue_t*)memory_pool;
+          pq->nodes = (pq_node_t*)((char*)memory_pool + sizeof(priority_queue_t));
+
+          if (PQ_PERSIST_INSERTING == header->state) {
+
+            _recover_insert (pq, header);
+            _commit (pq, header);
+
+          } else if (PQ_PERSIST_EXTRACTING == header->state) {
+
+            _recover_extract (pq, header);
+            _commit (pq, header);
+
+          }
+
+        } else {
+
+          munmap (map, length);
+
+        }
+
+        if (NULL != pq) {
+
+          persist->header = header;
+          persist->pq = pq;
+
+        }
+
+      }
+
+    }
+
+    if (fd >= 0) {
+
+      close (fd); // The mapping keeps the file referenced
+
+    }
+
+  }
+
+  return (NULL != pq);
+
+}
+
+
+bool pq_persist_insert (pq_persist_t* persist, pq_id_t id, uint16_t priority) {
+
+  bool successful = false;
+
+  if (_is_open (persist) && persist->pq->size < persist->pq->capacity && PQ_PERSIST_NO_ID != id) {
+
+    pq_persist_header_t* header = persist->header;
+    priority_queue_t* pq = persist->pq;
+
+    header->pending.priority = priority;
+    header->pending.insertion_index = pq->next_insertion_index;
+    header->pending.id = id;
+    header->target_size = pq->size + 1;
+
+    // The new slot is outside the queue until the commit, so it can be written before the state
+    pq->nodes[pq->size] = header->pending;
+    PERSIST_BARRIER ();
+    header->state = PQ_PERSIST_INSERTING;
+    PERSIST_BARRIER ();
+
+    _sift_up (pq, &header->pending, pq->size);
+    _commit (pq, header);
+
+    successful = true;
+
+  }
+
+  return successful;
+
+}
+
+
+bool pq_persist_peek (const pq_persist_t* persist, pq_id_t* id) {
+
+  bool successful = false;
+
+  if (_is_open (persist) && NULL != id && persist->pq->size > NO_ELEMENTS_IN_QUEUE) {
+
+    *id = persist->pq->nodes[ROOT_INDEX].id;
+    successful = true;
+
+  }
+
+  return successful;
+
+}
+
+
+bool pq_persist_extract (pq_persist_t* persist, pq_id_t* id) {
+
+  bool successful = false;
+
+  if (_is_open (persist) && NULL != id && persist->pq->size > NO_ELEMENTS_IN_QUEUE) {
+
+    pq_persist_header_t* header = persist->header;
+    priority_queue_t* pq = persist->pq;
+
+    *id = pq->nodes[ROOT_INDEX].id;
+
+    header->pending = pq->nodes[pq->size - 1];
+    header->target_size = pq->size - 1;
+    PERSIST_BARRIER ();
+    header->state = PQ_PERSIST_EXTRACTING;
+    PERSIST_BARRIER ();
+
+    if (header->target_size > NO_ELEMENTS_IN_QUEUE) {
+
+      _sift_down (pq, &header->pending, ROOT_INDEX, header->target_size);
+
+    }
+
+    _commit (pq, header);
+
+    successful = true;
+
+  }
+
+  return successful;
+
+}
+
+
+bool pq_persist_verify (const pq_persist_t* persist) {
+
+  bool valid = _is_open (persist);
+  const priority_queue_t* pq = valid ? persist->pq : NULL;
+
+  valid = (valid &&
+           _header_matches (persist->header, pq->capacity, pq->type) &&
+           PQ_PERSIST_IDLE == persist->header->state &&
+           pq->size <= pq->capacity);
+
+  for (size_t i = 1; valid && i < pq->size; i++) {
+
+    valid = !pq_node_precedes (pq, &pq->nodes[i], &pq->nodes[(i - 1) / 2]) &&
+            pq->nodes[i].insertion_index < pq->next_insertion_index;
+
+  }
+
+  return valid;
+
+}
+
+
+bool pq_persist_sync (const pq_persist_t* persist) {
+
+  bool successful = false;
+
+  if (_is_open (persist)) {
+
+    pq_persist_header_t* header = persist->header;
+    successful = (0 == msync (header, PQ_PERSIST_FILE_SIZE(header->capacity), MS_SYNC));
+
+  }
+
+  return successful;
+
+}
+
+
+void pq_persist_close (pq_persist_t* persist) {
+
+  if (_is_open (persist)) {
+
+    munmap (persist->header, PQ_PERSIST_FILE_SIZE(persist->header->capacity));
+    persist->header = NULL;
+    persist->pq = NULL;
+
+  }
+
+}
+
+/********************** end of file ******************************************/
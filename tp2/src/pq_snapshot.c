@@ -0,0 +1,320 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Implementation file for priority queue snapshot module
+ **
+ ** \addtogroup pq_snapshot module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** inclusions *******************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "pq_snapshot.h"
+#include <errno.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+/********************** macros and definitions *******************************/
+#define HEADER_IOV                0
+#define NODES_IOV                 1
+#define SNAPSHOT_IOVS             2
+
+/********************** internal data declaration ****************************/
+
+/********************** internal functions declaration ***********************/
+
+static void _fill_header (const priority_queue_t* pq, pq_snapshot_header_t* header);
+
+static bool _header_is_valid (const pq_snapshot_header_t* header, size_t capacity);
+
+static priority_queue_t* _create_from_header (void* memory_pool, size_t capacity,
+                                              const pq_snapshot_header_t* header);
+
+static bool _nodes_are_valid (const priority_queue_t* pq);
+
+static bool _read_all (int fd, void* buffer, size_t length);
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static void _fill_header (const priority_queue_t* pq, pq_snapshot_header_t* header) {
+
+  memset (header, 0, sizeof(*header));
+
+  header->magic = PQ_SNAPSHOT_MAGIC;
+  header->version = PQ_SNAPSHOT_VERSION;
+  header->node_size = sizeof(pq_node_t);
+  header->type = (uint32_t)pq->type;
+  header->byte_order = PQ_SNAPSHOT_BYTE_ORDER;
+  header->size = pq->size;
+  header->next_insertion_index = pq->next_insertion_index;
+  header->tombstones = pq->tombstones;
+
+}
+
+
+static bool _header_is_valid (const pq_snapshot_header_t* header, size_t capacity) {
+
+  return (PQ_SNAPSHOT_MAGIC == header->magic &&
+          PQ_SNAPSHOT_VERSION == header->version &&
+          sizeof(pq_node_t) == header->node_size &&
+          PQ_SNAPSHOT_BYTE_ORDER == header->byte_order &&
+          (PQ_MIN_PRIORITY_QUEUE == header->type || PQ_MAX_PRIORITY_QUEUE == header->type) &&
+          header->size <= capacity &&
+          header->tombstones <= header->size);
+
+}
+
+
+static priority_queue_t* _create_from_header (void* memory_pool, size_t capacity,
+                                              const pq_snapshot_header_t* header) {
+
+  priority_queue_t* pq = pq_create (memory_pool, capacity, (pq_type_t)header->type);
+
+  if (NULL != pq) {
+
+    pq->size = (size_t)header->size;
+    pq->next_insertion_index = (size_t)header->next_insertion_index;
+    pq->tombstones = (size_t)header->tombstones;
+
+  }
+
+  return pq;
+
+}
+
+
+static bool _nodes_are_valid (const priority_queue_t* pq) {
+
+  size_t tombstones = 0;
+  bool valid = true;
+
+  for (size_t i = 0; valid && i < pq->size; i++) {
+
+    valid = (pq->nodes[i].insertion_index < pq->next_insertion_index &&
+             (0 == i || !pq_node_precedes (pq, &pq->nodes[i], &pq->nodes[(i - 1) / 2])));
+
+    if (NULL == pq->nodes[i].data) {
+
+      tombstones++;
+
+    }
+
+  }
+
+  return (valid && tombstones == pq->tombstones);
+
+}
+
+
+static bool _read_all (int fd, void* buffer, size_t length) {
+
+  char* cursor = (char*)buffer;
+  bool successful = true;
+
+  while (successful && length > 0) {
+
+    ssize_t done = read (fd, cursor, length);
+
+    if (done > 0) {
+
+      cursor += done;
+      length -= (size_t)done;
+
+    } else if (done < 0 && EINTR == errno) {
+
+      continue;
+
+    } else {
+
+      successful = false; // Error or snapshot truncated
+
+    }
+
+  }
+
+  return successful;
+
+}
+
+/********************** external functions definition ************************/
+
+size_t pq_snapshot_size (const priority_queue_t* pq) {
+
+  size_t size = 0;
+
+  if (NULL != pq) {
+
+    size = PQ_SNAPSHOT_SIZE(pq->size);
+
+  }
+
+  return size;
+
+}
+
+
+size_t pq_snapshot (const priority_queue_t* pq, void* buffer, size_t buffer_size) {
+
+  size_t written = 0;
+  size_t needed = pq_snapshot_size (pq);
+
+  if (NULL != pq && NULL != buffer && buffer_size >= needed) {
+
+    pq_snapshot_header_t header;
+
+    // The buffer has no alignment guarantee: the header is built aside and copied
+    _fill_header (pq, &header);
+    memcpy (buffer, &header, sizeof(header));
+    memcpy ((char*)buffer + sizeof(header), pq->nodes, pq->size * sizeof(pq_node_t));
+
+    written = needed;
+
+  }
+
+  return written;
+
+}
+
+
+bool pq_snapshot_fd (const priority_queue_t* pq, int fd) {
+
+  bool successful = false;
+
+  if (NULL != pq && fd >= 0) {
+
+    pq_snapshot_header_t header;
+    struct iovec iov[SNAPSHOT_IOVS];
+    int first = HEADER_IOV;
+
+    _fill_header (pq, &header);
+
+    iov[HEADER_IOV].iov_base = &header;
+    iov[HEADER_IOV].iov_len = sizeof(header);
+    iov[NODES_IOV].iov_base = pq->nodes;
+    iov[NODES_IOV].iov_len = pq->size * sizeof(pq_node_t);
+
+    successful = true;
+
+    while (successful && first < SNAPSHOT_IOVS) {
+
+      ssize_t done = writev (fd, &iov[first], SNAPSHOT_IOVS - first);
+
+      if (done < 0) {
+
+        successful = (EINTR == errno);
+        done = 0;
+
+      }
+
+      // Partial write: skip what the kernel already took
+      while (first < SNAPSHOT_IOVS && (size_t)done >= iov[first].iov_len) {
+
+        done -= (ssize_t)iov[first].iov_len;
+        first++;
+
+      }
+
+      if (first < SNAPSHOT_IOVS) {
+
+        iov[first].iov_base = (char*)iov[first].iov_base + done;
+        iov[first].iov_len -= (size_t)done;
+
+      }
+
+    }
+
+  }
+
+  return successful;
+
+}
+
+
+priority_queue_t* pq_restore (void* memory_pool, size_t capacity,
+                              const void* buffer, size_t length) {
+
+  priority_queue_t* pq = NULL;
+
+  if (NULL != memory_pool && NULL != buffer && length >= sizeof(pq_snapshot_header_t)) {
+
+    pq_snapshot_header_t header;
+
+    memcpy (&header, buffer, sizeof(header));
+
+    if (_header_is_valid (&header, capacity) && length >= PQ_SNAPSHOT_SIZE(header.size)) {
+
+      pq = _create_from_header (memory_pool, capacity, &header);
+
+      if (NULL != pq) {
+
+        memcpy (pq->nodes, (const char*)buffer + sizeof(header), pq->size * sizeof(pq_node_t));
+
+      }
+
+      if (NULL != pq && !_nodes_are_valid (pq)) {
+
+        pq = NULL;
+
+      }
+
+    }
+
+  }
+
+  return pq;
+
+}
+
+
+priority_queue_t* pq_restore_fd (void* memory_pool, size_t capacity, int fd) {
+
+  priority_queue_t* pq = NULL;
+  pq_snapshot_header_t header;
+
+  if (NULL != memory_pool && fd >= 0 &&
+      _read_all (fd, &header, sizeof(header)) && _header_is_valid (&header, capacity)) {
+
+    pq = _create_from_header (memory_pool, capacity, &header);
+
+    if (NULL != pq && (!_read_all (fd, pq->nodes, pq->size * sizeof(pq_node_t)) ||
+                       !_nodes_are_valid (pq))) {
+
+      pq = NULL;
+
+    }
+
+  }
+
+  return pq;
+
+}
+
+/********************** end of file ******************************************/
@@ -0,0 +1,314 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Implementation file for priority queue trace module
+ **
+ ** \addtogroup pq_trace module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** inclusions *******************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "pq_trace.h"
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/********************** macros and definitions *******************************/
+#define NO_QUEUE                  PQ_TRACE_MAX_QUEUES
+
+typedef struct {
+
+  pq_trace_record_t* _Atomic ring;           // NULL while not recording
+  pq_trace_record_t* buffer;                 // Last ring, kept after stopping to save it
+  size_t capacity;
+  atomic_uint_fast64_t head;                 // Records appended since the start
+  atomic_uint_fast64_t lost;                 // Records of queues past PQ_TRACE_MAX_QUEUES
+  const priority_queue_t* queues[PQ_TRACE_MAX_QUEUES];
+  atomic_size_t queue_count;
+
+} trace_state_t;
+
+/********************** internal data declaration ****************************/
+
+/********************** internal functions declaration ***********************/
+
+static uint8_t _find (const priority_queue_t* pq);
+
+static void _append (pq_trace_record_t* ring, pq_trace_op_t op, uint8_t queue, uint16_t value,
+                     size_t size);
+
+/********************** internal data definition *****************************/
+
+static trace_state_t _trace;
+
+static pthread_mutex_t _register_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static uint8_t _find (const priority_queue_t* pq) {
+
+  size_t count = atomic_load_explicit (&_trace.queue_count, memory_order_acquire);
+  uint8_t id = NO_QUEUE;
+
+  for (size_t i = 0; NO_QUEUE == id && i < count; i++) {
+
+    if (_trace.queues[i] == pq) {
+
+      id = (uint8_t)i;
+
+    }
+
+  }
+
+  return id;
+
+}
+
+
+static void _append (pq_trace_record_t* ring, pq_trace_op_t op, uint8_t queue, uint16_t value,
+                     size_t size) {
+
+  uint64_t slot = atomic_fetch_add_explicit (&_trace.head, 1, memory_order_relaxed);
+  pq_trace_record_t* record = &ring[slot % _trace.capacity];
+
+  record->op = (uint8_t)op;
+  record->queue = queue;
+  record->value = value;
+  record->size = (size > UINT32_MAX) ? UINT32_MAX : (uint32_t)size;
+
+}
+
+/********************** external functions definition ************************/
+
+bool pq_trace_start (pq_trace_record_t* ring, size_t capacity) {
+
+  bool successful = false;
+
+  if (NULL != ring && capacity > 0) {
+
+    pq_trace_stop ();
+
+    _trace.buffer = ring;
+    _trace.capacity = capacity;
+    atomic_store (&_trace.head, 0);
+    atomic_store (&_trace.lost, 0);
+    atomic_store (&_trace.queue_count, 0);
+    atomic_store_explicit (&_trace.ring, ring, memory_order_release);
+
+    successful = true;
+
+  }
+
+  return successful;
+
+}
+
+
+void pq_trace_stop (void) {
+
+  atomic_store_explicit (&_trace.ring, NULL, memory_order_release);
+
+}
+
+
+size_t pq_trace_count (void) {
+
+  uint64_t head = atomic_load (&_trace.head);
+
+  return (head < _trace.capacity) ? (size_t)head : _trace.capacity;
+
+}
+
+
+uint64_t pq_trace_dropped (void) {
+
+  return atomic_load (&_trace.head) - pq_trace_count () + atomic_load (&_trace.lost);
+
+}
+
+
+uint8_t pq_trace_queue_id (const priority_queue_t* pq) {
+
+  pq_trace_record_t* ring = atomic_load_explicit (&_trace.ring, memory_order_acquire);
+  uint8_t id = (NULL != ring && NULL != pq) ? _find (pq) : NO_QUEUE;
+
+  if (NULL != ring && NULL != pq && NO_QUEUE == id) {
+
+    pthread_mutex_lock (&_register_lock);
+
+    id = _find (pq);
+    size_t count = atomic_load (&_trace.queue_count);
+
+    if (NO_QUEUE == id && count < PQ_TRACE_MAX_QUEUES) {
+
+      id = (uint8_t)count;
+      _trace.queues[count] = pq;
+
+      // Appended before the id is published, so it comes before any other call on the queue
+      _append (ring, PQ_TRACE_CREATE, id, (uint16_t)pq->type, pq->capacity);
+      atomic_store_explicit (&_trace.queue_count, count + 1, memory_order_release);
+
+    }
+
+    pthread_mutex_unlock (&_register_lock);
+
+  }
+
+  return id;
+
+}
+
+
+void pq_trace_record (const priority_queue_t* pq, pq_trace_op_t op, uint16_t value) {
+
+  pq_trace_record_t* ring = atomic_load_explicit (&_trace.ring, memory_order_acquire);
+
+  if (NULL != ring && NULL != pq) {
+
+    uint8_t id = _find (pq);
+
+    if (NO_QUEUE == id) {
+
+      id = pq_trace_queue_id (pq); // A new queue gets its CREATE record here
+
+    } else if (PQ_TRACE_CREATE == op) {
+
+      _append (ring, op, id, (uint16_t)pq->type, pq->capacity); // Created again in the same pool
+
+    }
+
+    if (NO_QUEUE == id) {
+
+      atomic_fetch_add (&_trace.lost, 1);
+
+    } else if (PQ_TRACE_CREATE != op) {
+
+      _append (ring, op, id, value, pq->size - pq->tombstones);
+
+    }
+
+  }
+
+}
+
+
+bool pq_trace_save (const char* path) {
+
+  bool successful = false;
+  FILE* file = (NULL != path && NULL != _trace.buffer) ? fopen (path, "wb") : NULL;
+
+  if (NULL != file) {
+
+    uint64_t head = atomic_load (&_trace.head);
+    size_t count = pq_trace_count ();
+    size_t oldest = (head > _trace.capacity) ? (size_t)(head % _trace.capacity) : 0;
+    pq_trace_header_t header = { PQ_TRACE_MAGIC, PQ_TRACE_VERSION, sizeof(pq_trace_record_t),
+                                 count, pq_trace_dropped () };
+
+    // Once the ring wraps, the oldest record sits right after the newest one
+    successful = (1 == fwrite (&header, sizeof(header), 1, file) &&
+                  count - oldest == fwrite (&_trace.buffer[oldest], sizeof(pq_trace_record_t),
+                                            count - oldest, file) &&
+                  oldest == fwrite (_trace.buffer, sizeof(pq_trace_record_t), oldest, file));
+
+    successful = (0 == fclose (file)) && successful;
+
+  }
+
+  return successful;
+
+}
+
+
+bool pq_trace_open (pq_trace_file_t* trace, const char* path) {
+
+  bool successful = false;
+  int fd = (NULL != trace && NULL != path) ? open (path, O_RDONLY) : -1;
+  struct stat info;
+
+  if (fd >= 0 && 0 == fstat (fd, &info) && (size_t)info.st_size >= sizeof(pq_trace_header_t)) {
+
+    size_t length = (size_t)info.st_size;
+    void* map = mmap (NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (MAP_FAILED != map) {
+
+      const pq_trace_header_t* header = (const pq_trace_header_t*)map;
+
+      successful = (PQ_TRACE_MAGIC == header->magic && PQ_TRACE_VERSION == header->version &&
+                    sizeof(pq_trace_record_t) == header->record_size &&
+                    sizeof(*header) + header->records * sizeof(pq_trace_record_t) == length);
+
+      if (successful) {
+
+        trace->records = (const pq_trace_record_t*)(header + 1);
+        trace->count = (size_t)header->records;
+        trace->dropped = header->dropped;
+        trace->mapping = map;
+        trace->mapping_size = length;
+
+      } else {
+
+        munmap (map, length);
+
+      }
+
+    }
+
+  }
+
+  if (fd >= 0) {
+
+    close (fd); // The mapping keeps the file referenced
+
+  }
+
+  return successful;
+
+}
+
+
+void pq_trace_close (pq_trace_file_t* trace) {
+
+  if (NULL != trace && NULL != trace->mapping) {
+
+    munmap (trace->mapping, trace->mapping_size);
+    trace->mapping = NULL;
+    trace->mapping_size = 0;
+    trace->records = NULL;
+    trace->count = 0;
+
+  }
+
+}
+
+/********************** end of file ******************************************/
@@ -33,14 +33,14 @@ SPDX-License-Identifier: MIT
 /********************** inclusions *******************************************/
 
 #include "priority_queue.h"
+#include "pq_trace.h"
+#include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
-#include <string.h>
 
 /********************** macros and definitions *******************************/
 #define ROOT_INDEX                0
 #define NO_ELEMENTS_IN_QUEUE      0
-#define NULL_VALUE                0
 #define INITIAL_INSERTION_INDEX   0
 
 /********************** internal data declaration ****************************/
@@ -59,6 +59,24 @@ static void _heapify (priority_queue_t* pq, size_t index);
 
 static void _bubble_up (priority_queue_t* pq, size_t index);
 
+static void _build_heap (priority_queue_t* pq);
+
+static void _remove_root (priority_queue_t* pq);
+
+static void _drop_root_tombstones (priority_queue_t* pq);
+
+static void _append (priority_queue_t* pq, const pq_node_t* node, bool keep_heap);
+
+static size_t _compact (priority_queue_t* pq, pq_predicate_t predicate, void* ctx);
+
+static int _compare_min (const void* a, const void* b);
+
+static int _compare_max (const void* a, const void* b);
+
+static bool _frontier_push (pq_iter_t* iter, size_t index);
+
+static size_t _frontier_pop (pq_iter_t* iter);
+
 /********************** internal data definition *****************************/
 
 
@@ -93,6 +111,8 @@ static int _power_of_two (int exp) {
 
 }
 
+#endif
+
 static uint16_t _calculate_level (size_t size) {
 
   // Implement log2(size) using bitwise operations
@@ -102,8 +122,6 @@ static uint16_t _calculate_level (size_t size) {
 
 }
 
-#endif
-
 
 // Function to swap two elements in an array
 static void _swap (priority_queue_t* pq, size_t i, size_t j) {
@@ -132,20 +150,7 @@ static bool _child_better_than_parent (const priority_queue_t* pq,
 
   if (parent != candidate) {
 
-    const pq_node_t* c = &pq->nodes[candidate]; // Candidate node
-    const pq_node_t* p = &pq->nodes[parent]; // Parent node
-
-    if (PQ_MAX_PRIORITY_QUEUE == pq->type) {
-
-      is_better =
-        (c->priority > p->priority || _should_update_by_order (c, p));
-
-    } else { // MIN_PRIORITY_QUEUE
-
-      is_better =
-        (c->priority < p->priority || _should_update_by_order (c, p));
-
-    }
+    is_better = pq_node_precedes (pq, &pq->nodes[candidate], &pq->nodes[parent]);
 
   }
 
@@ -154,30 +159,39 @@ static bool _child_better_than_parent (const priority_queue_t* pq,
 }
 
 
+// Iterative sift-down: constant stack, at most log_2(n) swaps
 static void _heapify (priority_queue_t* pq, size_t index) {
 
-	size_t child_left = _get_left (index);
-	size_t child_right = _get_right (index);
-	size_t best = index;
+  bool sifting = true;
 
-	if (child_left < pq->size && _child_better_than_parent (pq, best, child_left)) {
+  while (sifting) {
 
-		best = child_left;
+    size_t child_left = _get_left (index);
+    size_t child_right = _get_right (index);
+    size_t best = index;
 
-	}
+    if (child_left < pq->size && _child_better_than_parent (pq, best, child_left)) {
 
-	if (child_right < pq->size && _child_better_than_parent (pq, best, child_right)) {
+      best = child_left;
 
-		best = child_right;
+    }
 
-	}
+    if (child_right < pq->size && _child_better_than_parent (pq, best, child_right)) {
 
-	if (best != index) {
+      best = child_right;
 
-		_swap (pq, index, best);
-		_heapify (pq, best);
+    }
 
-	}
+    sifting = (best != index);
+
+    if (sifting) {
+
+      _swap (pq, index, best);
+      index = best;
+
+    }
+
+  }
 
 }
 
@@ -196,6 +210,217 @@ static void _bubble_up (priority_queue_t* pq, size_t index) {
 
 }
 
+
+// Bottom-up heap construction (Floyd): every sift-down only touches its own subtree
+static void _build_heap (priority_queue_t* pq) {
+
+  for (size_t i = pq->size / 2; i > ROOT_INDEX; i--) {
+
+    _heapify (pq, i - 1);
+
+  }
+
+}
+
+
+static void _remove_root (priority_queue_t* pq) {
+
+  pq->nodes[ROOT_INDEX] = pq->nodes[pq->size - 1];
+  pq->size--;
+
+  if (pq->size > NO_ELEMENTS_IN_QUEUE) {
+
+    _heapify (pq, ROOT_INDEX);
+
+  }
+
+}
+
+
+static void _drop_root_tombstones (priority_queue_t* pq) {
+
+  while (pq->tombstones > NO_ELEMENTS_IN_QUEUE && NULL == pq->nodes[ROOT_INDEX].data) {
+
+    _remove_root (pq);
+    pq->tombstones--;
+
+  }
+
+}
+
+
+static void _append (priority_queue_t* pq, const pq_node_t* node, bool keep_heap) {
+
+  pq->nodes[pq->size] = *node;
+
+  if (keep_heap) {
+
+    _bubble_up (pq, pq->size);
+
+  }
+
+  pq->size++;
+
+}
+
+
+// Keeps, in array order, the live nodes not selected by the predicate (if any) in one pass
+static size_t _compact (priority_queue_t* pq, pq_predicate_t predicate, void* ctx) {
+
+  size_t kept = 0;
+  size_t removed = 0;
+
+  for (size_t i = 0; i < pq->size; i++) {
+
+    const pq_node_t* node = &pq->nodes[i];
+
+    if (NULL == node->data) {
+
+      continue; // Tombstone
+
+    }
+
+    if (NULL != predicate && predicate (node, ctx)) {
+
+      removed++;
+
+    } else {
+
+      pq->nodes[kept++] = *node;
+
+    }
+
+  }
+
+  pq->size = kept;
+  pq->tombstones = NO_ELEMENTS_IN_QUEUE;
+
+  _build_heap (pq);
+
+  return removed;
+
+}
+
+
+// qsort comparators: insertion indices are unique, so the order is total
+static int _compare_min (const void* a, const void* b) {
+
+  const pq_node_t* x = (const pq_node_t*)a;
+  const pq_node_t* y = (const pq_node_t*)b;
+  int order = (x->priority > y->priority) - (x->priority < y->priority);
+
+  if (0 == order) {
+
+    order = (x->insertion_index > y->insertion_index) - (x->insertion_index < y->insertion_index);
+
+  }
+
+  return order;
+
+}
+
+
+static int _compare_max (const void* a, const void* b) {
+
+  const pq_node_t* x = (const pq_node_t*)a;
+  const pq_node_t* y = (const pq_node_t*)b;
+  int order = (x->priority < y->priority) - (x->priority > y->priority);
+
+  if (0 == order) {
+
+    order = (x->insertion_index > y->insertion_index) - (x->insertion_index < y->insertion_index);
+
+  }
+
+  return order;
+
+}
+
+
+static bool _frontier_before (const pq_iter_t* iter, size_t a, size_t b) {
+
+  return pq_node_precedes (iter->pq, &iter->pq->nodes[iter->frontier[a]],
+                           &iter->pq->nodes[iter->frontier[b]]);
+
+}
+
+
+static void _frontier_swap (pq_iter_t* iter, size_t a, size_t b) {
+
+  size_t temp = iter->frontier[a];
+  iter->frontier[a] = iter->frontier[b];
+  iter->frontier[b] = temp;
+
+}
+
+
+static bool _frontier_push (pq_iter_t* iter, size_t index) {
+
+  bool pushed = false;
+
+  if (iter->frontier_size < iter->frontier_capacity) {
+
+    size_t position = iter->frontier_size++;
+
+    iter->frontier[position] = index;
+
+    while (position > ROOT_INDEX && _frontier_before (iter, position, _get_parent (position))) {
+
+      _frontier_swap (iter, position, _get_parent (position));
+      position = _get_parent (position);
+
+    }
+
+    pushed = true;
+
+  }
+
+  return pushed;
+
+}
+
+
+static size_t _frontier_pop (pq_iter_t* iter) {
+
+  size_t index = iter->frontier[ROOT_INDEX];
+  size_t position = ROOT_INDEX;
+  bool sifting = true;
+
+  iter->frontier[ROOT_INDEX] = iter->frontier[--iter->frontier_size];
+
+  while (sifting) {
+
+    size_t best = position;
+    size_t left = _get_left (position);
+    size_t right = _get_right (position);
+
+    if (left < iter->frontier_size && _frontier_before (iter, left, best)) {
+
+      best = left;
+
+    }
+
+    if (right < iter->frontier_size && _frontier_before (iter, right, best)) {
+
+      best = right;
+
+    }
+
+    sifting = (best != position);
+
+    if (sifting) {
+
+      _frontier_swap (iter, position, best);
+      position = best;
+
+    }
+
+  }
+
+  return index;
+
+}
+
 /********************** external functions definition ************************/
 
 priority_queue_t* pq_create (void* memory_pool, size_t capacity, pq_type_t type) {
@@ -212,8 +437,11 @@ priority_queue_t* pq_create (void* memory_pool, size_t capacity, pq_type_t type)
     pq->type = type;
 		pq->capacity = capacity;
     pq->next_insertion_index = INITIAL_INSERTION_INDEX;
+    pq->tombstones = NO_ELEMENTS_IN_QUEUE;
+
+    // Slots past size are never read, so they are left as they are: O(1) for any capacity
 
-    memset (pq->nodes, NULL_VALUE, capacity * sizeof(pq_node_t));
+    PQ_TRACE_RECORD (pq, PQ_TRACE_CREATE, type);
 
 	}
 
@@ -226,6 +454,12 @@ bool pq_insert (priority_queue_t* pq, void* data, uint16_t priority) {
 
 	bool successful = false;
 
+	if (NULL != pq && pq->size == pq->capacity && pq->tombstones > NO_ELEMENTS_IN_QUEUE) {
+
+    _compact (pq, NULL, NULL); // Reclaim the slots of the tombstones
+
+	}
+
 	if (NULL != pq && pq->size < pq->capacity && NULL != data) {
 
     pq->nodes[pq->size].data = data;
@@ -236,6 +470,8 @@ bool pq_insert (priority_queue_t* pq, void* data, uint16_t priority) {
 
     pq->size++;
 
+    PQ_TRACE_RECORD (pq, PQ_TRACE_INSERT, priority);
+
     successful = true;
 
 	}
@@ -249,12 +485,20 @@ void* pq_peek (priority_queue_t* pq) {
 
   void* data = NULL;
 
+  if (NULL != pq) {
+
+    _drop_root_tombstones (pq);
+
+  }
+
   if (NULL != pq && pq->size > NO_ELEMENTS_IN_QUEUE) {
 
     data = pq->nodes[ROOT_INDEX].data;
 
   }
 
+  PQ_TRACE_RECORD (pq, PQ_TRACE_PEEK, (NULL != data) ? pq->nodes[ROOT_INDEX].priority : 0);
+
   return data;
 
 }
@@ -264,18 +508,21 @@ void* pq_extract (priority_queue_t* pq) {
 
 	void* data = NULL;
 
-	if (NULL != pq && pq->size > NO_ELEMENTS_IN_QUEUE) {
+	if (NULL != pq) {
 
-    data = pq->nodes[ROOT_INDEX].data;
+    _drop_root_tombstones (pq);
 
-    pq->nodes[ROOT_INDEX] = pq->nodes[pq->size - 1];
-    pq->size--;
+	}
 
-    if (pq->size > NO_ELEMENTS_IN_QUEUE) {
+	if (NULL != pq && pq->size > NO_ELEMENTS_IN_QUEUE) {
 
-      _heapify (pq, ROOT_INDEX);
+    pq_node_t root = pq->nodes[ROOT_INDEX];
 
-    }
+    data = root.data;
+
+    _remove_root (pq);
+
+    PQ_TRACE_RECORD (pq, PQ_TRACE_EXTRACT, root.priority);
 
 	}
 
@@ -290,7 +537,7 @@ bool pq_is_empty (priority_queue_t* pq) {
 
 	if (NULL != pq) {
 
-		is_empty = pq->size == NO_ELEMENTS_IN_QUEUE;
+		is_empty = (pq->size - pq->tombstones) == NO_ELEMENTS_IN_QUEUE;
 
 	}
 
@@ -305,7 +552,7 @@ size_t pq_size (priority_queue_t* pq) {
 
 	if (NULL != pq) {
 
-		size = pq->size;
+		size = pq->size - pq->tombstones;
 
 	}
 
@@ -383,4 +630,292 @@ void pq_print_priority_queue (priority_queue_t* pq) {
 
 }
 
+
+size_t pq_remove_if (priority_queue_t* pq, pq_predicate_t predicate, void* ctx) {
+
+  size_t removed = 0;
+
+  if (NULL != pq && NULL != predicate) {
+
+    removed = _compact (pq, predicate, ctx);
+
+    PQ_TRACE_RECORD (pq, PQ_TRACE_REMOVE, (removed > UINT16_MAX) ? UINT16_MAX : removed);
+
+  }
+
+  return removed;
+
+}
+
+
+size_t pq_remove_if_lazy (priority_queue_t* pq, pq_predicate_t predicate, void* ctx) {
+
+  size_t removed = 0;
+
+  if (NULL != pq && NULL != predicate) {
+
+    for (size_t i = 0; i < pq->size; i++) {
+
+      if (NULL != pq->nodes[i].data && predicate (&pq->nodes[i], ctx)) {
+
+        pq->nodes[i].data = NULL;
+        removed++;
+
+      }
+
+    }
+
+    pq->tombstones += removed;
+
+    // Once tombstones are the majority, extracting past them costs more than a rebuild
+    if (2 * pq->tombstones > pq->size) {
+
+      _compact (pq, NULL, NULL);
+
+    } else {
+
+      _drop_root_tombstones (pq);
+
+    }
+
+    PQ_TRACE_RECORD (pq, PQ_TRACE_REMOVE, (removed > UINT16_MAX) ? UINT16_MAX : removed);
+
+  }
+
+  return removed;
+
+}
+
+
+bool pq_merge (priority_queue_t* dst, priority_queue_t* src) {
+
+  bool successful = false;
+
+  if (NULL != dst && NULL != src && dst != src && dst->type == src->type) {
+
+    size_t incoming = src->size - src->tombstones;
+
+    if (dst->size + incoming > dst->capacity && dst->tombstones > NO_ELEMENTS_IN_QUEUE) {
+
+      _compact (dst, NULL, NULL);
+
+    }
+
+    if (dst->size + incoming <= dst->capacity) {
+
+      size_t total = dst->size + incoming;
+
+      // m inserts cost m*log(n+m) moves, appending and rebuilding costs n+m
+      bool insert_each = (incoming * _calculate_level (total) < total);
+
+      for (size_t i = 0; i < src->size; i++) {
+
+        if (NULL != src->nodes[i].data) {
+
+          pq_node_t node = src->nodes[i];
+
+          // src elements rank after every dst element of the same priority, in their own order
+          node.insertion_index += dst->next_insertion_index;
+          _append (dst, &node, insert_each);
+
+        }
+
+      }
+
+      if (!insert_each) {
+
+        _build_heap (dst);
+
+      }
+
+      dst->next_insertion_index += src->next_insertion_index;
+
+      src->size = NO_ELEMENTS_IN_QUEUE;
+      src->tombstones = NO_ELEMENTS_IN_QUEUE;
+
+      PQ_TRACE_RECORD (dst, PQ_TRACE_MERGE, pq_trace_queue_id (src));
+
+      successful = true;
+
+    }
+
+  }
+
+  return successful;
+
+}
+
+
+bool pq_insert_bulk (priority_queue_t* pq, void* const* data, const uint16_t* priorities,
+                     size_t count) {
+
+  bool successful = false;
+
+  // The live nodes plus the new ones must fit, once the tombstones are reclaimed
+  if (NULL != pq && NULL != data && NULL != priorities &&
+      count <= pq->capacity - (pq->size - pq->tombstones)) {
+
+    successful = true;
+
+    for (size_t i = 0; successful && i < count; i++) {
+
+      successful = (NULL != data[i]);
+
+    }
+
+  }
+
+  if (successful && pq->size + count > pq->capacity && pq->tombstones > NO_ELEMENTS_IN_QUEUE) {
+
+    _compact (pq, NULL, NULL);
+
+  }
+
+  if (successful && pq->size + count <= pq->capacity) {
+
+    for (size_t i = 0; i < count; i++) {
+
+      pq->nodes[pq->size + i].data = data[i];
+      pq->nodes[pq->size + i].priority = priorities[i];
+      pq->nodes[pq->size + i].insertion_index = pq->next_insertion_index + i;
+
+    }
+
+    pq->size += count;
+    pq->next_insertion_index += count;
+
+    _build_heap (pq);
+
+    for (size_t i = 0; i < count; i++) {
+
+      PQ_TRACE_RECORD (pq, PQ_TRACE_INSERT, priorities[i]);
+
+    }
+
+  } else {
+
+    successful = false;
+
+  }
+
+  return successful;
+
+}
+
+
+size_t pq_export_sorted (const priority_queue_t* pq, pq_node_t* out) {
+
+  size_t exported = 0;
+
+  if (NULL != pq && NULL != out) {
+
+    for (size_t i = 0; i < pq->size; i++) {
+
+      if (NULL != pq->nodes[i].data) {
+
+        out[exported++] = pq->nodes[i];
+
+      }
+
+    }
+
+    qsort (out, exported, sizeof(pq_node_t),
+           (PQ_MAX_PRIORITY_QUEUE == pq->type) ? _compare_max : _compare_min);
+
+  }
+
+  return exported;
+
+}
+
+
+bool pq_iter_sorted (pq_iter_t* iter, const priority_queue_t* pq,
+                     size_t* frontier, size_t frontier_capacity) {
+
+  bool successful = false;
+
+  if (NULL != iter && NULL != pq && NULL != frontier && frontier_capacity > NO_ELEMENTS_IN_QUEUE) {
+
+    iter->pq = pq;
+    iter->frontier = frontier;
+    iter->frontier_size = NO_ELEMENTS_IN_QUEUE;
+    iter->frontier_capacity = frontier_capacity;
+    iter->truncated = false;
+
+    if (pq->size > NO_ELEMENTS_IN_QUEUE) {
+
+      _frontier_push (iter, ROOT_INDEX);
+
+    }
+
+    successful = true;
+
+  }
+
+  return successful;
+
+}
+
+
+const pq_node_t* pq_iter_next (pq_iter_t* iter) {
+
+  const pq_node_t* node = NULL;
+
+  // Popping a node frees one entry and its two children take at most two
+  while (NULL == node && NULL != iter && iter->frontier_size > NO_ELEMENTS_IN_QUEUE &&
+         iter->frontier_size < iter->frontier_capacity) {
+
+    size_t index = _frontier_pop (iter);
+    size_t left = _get_left (index);
+    size_t right = _get_right (index);
+
+    if (left < iter->pq->size) {
+
+      _frontier_push (iter, left);
+
+    }
+
+    if (right < iter->pq->size) {
+
+      _frontier_push (iter, right);
+
+    }
+
+    if (NULL != iter->pq->nodes[index].data) {
+
+      node = &iter->pq->nodes[index]; // Tombstones are walked through but not returned
+
+    }
+
+  }
+
+  if (NULL == node && NULL != iter && iter->frontier_size >= iter->frontier_capacity) {
+
+    iter->truncated = true;
+
+  }
+
+  return node;
+
+}
+
+
+bool pq_node_precedes (const priority_queue_t* pq, const pq_node_t* a, const pq_node_t* b) {
+
+  bool precedes = false;
+
+  if (PQ_MAX_PRIORITY_QUEUE == pq->type) {
+
+    precedes = (a->priority > b->priority || _should_update_by_order (a, b));
+
+  } else { // MIN_PRIORITY_QUEUE
+
+    precedes = (a->priority < b->priority || _should_update_by_order (a, b));
+
+  }
+
+  return precedes;
+
+}
+
 /********************** end of file ******************************************/
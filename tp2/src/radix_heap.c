@@ -0,0 +1,261 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Implementation file for radix heap module
+ **
+ ** \addtogroup radix_heap module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** inclusions *******************************************/
+
+#include "radix_heap.h"
+
+/********************** macros and definitions *******************************/
+#define KEY_BITS                  64
+
+/********************** internal data declaration ****************************/
+
+/********************** internal functions declaration ***********************/
+
+static unsigned _bucket (uint64_t key, uint64_t last);
+
+static void _link (radix_heap_t* rh, unsigned bucket, uint32_t entry);
+
+static void _redistribute (radix_heap_t* rh);
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static unsigned _bucket (uint64_t key, uint64_t last) {
+
+  // 0 for key == last, otherwise one plus the highest differing bit
+  return (key == last) ? 0U : (unsigned)(KEY_BITS - __builtin_clzll (key ^ last));
+
+}
+
+
+static void _link (radix_heap_t* rh, unsigned bucket, uint32_t entry) {
+
+  rh->entries[entry].next = rh->buckets[bucket];
+  rh->buckets[bucket] = entry;
+
+}
+
+
+static void _redistribute (radix_heap_t* rh) {
+
+  unsigned bucket = 1;
+  uint32_t entry = RH_NO_ENTRY;
+
+  while (RH_NO_ENTRY == rh->buckets[bucket]) {
+
+    bucket++;
+
+  }
+
+  // The new last key is the minimum of the first non empty bucket
+  entry = rh->buckets[bucket];
+  rh->last = rh->entries[entry].key;
+
+  for (entry = rh->entries[entry].next; RH_NO_ENTRY != entry; entry = rh->entries[entry].next) {
+
+    if (rh->entries[entry].key < rh->last) {
+
+      rh->last = rh->entries[entry].key;
+
+    }
+
+  }
+
+  // Every entry lands in a lower bucket, at least the minimum in bucket 0
+  entry = rh->buckets[bucket];
+  rh->buckets[bucket] = RH_NO_ENTRY;
+
+  while (RH_NO_ENTRY != entry) {
+
+    uint32_t next = rh->entries[entry].next;
+
+    _link (rh, _bucket (rh->entries[entry].key, rh->last), entry);
+    entry = next;
+
+  }
+
+}
+
+/********************** external functions definition ************************/
+
+radix_heap_t* rh_create (void* memory_pool, uint32_t capacity) {
+
+  radix_heap_t* rh = NULL;
+
+  if (NULL != memory_pool && capacity > 0 && capacity < RH_NO_ENTRY) {
+
+    rh = (radix_heap_t*)memory_pool;
+
+    rh->entries = (rh_entry_t*)((char*)memory_pool + sizeof(radix_heap_t));
+    rh->capacity = capacity;
+
+    for (uint32_t i = 0; i < capacity; i++) {
+
+      rh->entries[i].next = i + 1U;
+
+    }
+
+    rh->entries[capacity - 1U].next = RH_NO_ENTRY;
+    rh->free = 0;
+
+    for (unsigned bucket = 0; bucket < RH_BUCKETS; bucket++) {
+
+      rh->buckets[bucket] = RH_NO_ENTRY;
+
+    }
+
+    rh->size = 0;
+    rh->last = 0;
+
+  }
+
+  return rh;
+
+}
+
+
+bool rh_push (radix_heap_t* rh, uint64_t key, uint32_t value) {
+
+  bool successful = false;
+
+  if (NULL != rh && RH_NO_ENTRY != rh->free && key >= rh->last) {
+
+    uint32_t entry = rh->free;
+
+    rh->free = rh->entries[entry].next;
+    rh->entries[entry].key = key;
+    rh->entries[entry].value = value;
+
+    _link (rh, _bucket (key, rh->last), entry);
+    rh->size++;
+
+    successful = true;
+
+  }
+
+  return successful;
+
+}
+
+
+bool rh_pop (radix_heap_t* rh, uint64_t* key, uint32_t* value) {
+
+  bool successful = false;
+
+  if (NULL != rh && rh->size > 0) {
+
+    uint32_t entry = RH_NO_ENTRY;
+
+    if (RH_NO_ENTRY == rh->buckets[0]) {
+
+      _redistribute (rh);
+
+    }
+
+    entry = rh->buckets[0];
+    rh->buckets[0] = rh->entries[entry].next;
+
+    if (NULL != key) {
+
+      *key = rh->entries[entry].key;
+
+    }
+
+    if (NULL != value) {
+
+      *value = rh->entries[entry].value;
+
+    }
+
+    rh->entries[entry].next = rh->free;
+    rh->free = entry;
+    rh->size--;
+
+    successful = true;
+
+  }
+
+  return successful;
+
+}
+
+
+bool rh_is_empty (const radix_heap_t* rh) {
+
+  return (NULL == rh || 0 == rh->size);
+
+}
+
+
+size_t rh_size (const radix_heap_t* rh) {
+
+  size_t size = 0;
+
+  if (NULL != rh) {
+
+    size = rh->size;
+
+  }
+
+  return size;
+
+}
+
+
+void rh_clear (radix_heap_t* rh) {
+
+  if (NULL != rh) {
+
+    for (unsigned bucket = 0; bucket < RH_BUCKETS; bucket++) {
+
+      while (RH_NO_ENTRY != rh->buckets[bucket]) {
+
+        uint32_t entry = rh->buckets[bucket];
+
+        rh->buckets[bucket] = rh->entries[entry].next;
+        rh->entries[entry].next = rh->free;
+        rh->free = entry;
+
+      }
+
+    }
+
+    rh->size = 0;
+    rh->last = 0;
+
+  }
+
+}
+
+/********************** end of file ******************************************/
@@ -0,0 +1,365 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Implementation file for cooperative scheduler module
+ **
+ ** \addtogroup scheduler module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** inclusions *******************************************/
+
+#include "scheduler.h"
+
+/********************** macros and definitions *******************************/
+#define REBASE_THRESHOLD          SCHED_MAX_INTERVAL
+
+/********************** internal data declaration ****************************/
+
+/********************** internal functions declaration ***********************/
+
+static uint16_t _key (const scheduler_t* sched, uint64_t time);
+
+static bool _keep (const pq_node_t* node, void* ctx);
+
+static void _shift_keys (const scheduler_t* sched, priority_queue_t* pq, uint16_t delta);
+
+static void _rebase (scheduler_t* sched, uint64_t now);
+
+static bool _make_ready (scheduler_t* sched, sched_task_t* task);
+
+static void _release_due (scheduler_t* sched, uint64_t now);
+
+static void _run (scheduler_t* sched, sched_task_t* task);
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static uint16_t _key (const scheduler_t* sched, uint64_t time) {
+
+  uint64_t offset = (time > sched->base) ? time - sched->base : 0;
+
+  return (offset < UINT16_MAX) ? (uint16_t)offset : UINT16_MAX;
+
+}
+
+
+static bool _keep (const pq_node_t* node, void* ctx) {
+
+  (void)node;
+  (void)ctx;
+
+  return false;
+
+}
+
+
+// Called once sched->base has moved forward by delta. A saturated key hides how far its time
+// really is, so shifting it would move it ahead of earlier times: then every key is computed
+// again from the new base and the heap is rebuilt
+static void _shift_keys (const scheduler_t* sched, priority_queue_t* pq, uint16_t delta) {
+
+  bool saturated = false;
+
+  for (size_t i = 0; !saturated && i < pq->size; i++) {
+
+    saturated = (NULL != pq->nodes[i].data && UINT16_MAX == pq->nodes[i].priority);
+
+  }
+
+  for (size_t i = 0; i < pq->size; i++) {
+
+    const sched_task_t* task = (const sched_task_t*)pq->nodes[i].data;
+
+    if (!saturated) {
+
+      pq->nodes[i].priority -= delta;
+
+    } else if (NULL != task) {
+
+      pq->nodes[i].priority = _key (sched, (pq == sched->releases) ? task->release : task->deadline);
+
+    }
+
+  }
+
+  if (saturated) {
+
+    pq_remove_if (pq, _keep, NULL); // Removes nothing, only rebuilds the heap
+
+  }
+
+}
+
+
+static void _rebase (scheduler_t* sched, uint64_t now) {
+
+  uint64_t target = now;
+  const sched_task_t* task = (const sched_task_t*)pq_peek (sched->releases);
+
+  // No key may go below zero, so the base can only reach the earliest stored time
+  if (NULL != task && task->release < target) {
+
+    target = task->release;
+
+  }
+
+  task = (const sched_task_t*)pq_peek (sched->ready);
+
+  if (SCHED_EDF == sched->policy && NULL != task && task->deadline < target) {
+
+    target = task->deadline;
+
+  }
+
+  if (target > sched->base && target - sched->base >= REBASE_THRESHOLD) {
+
+    uint16_t delta = _key (sched, target);
+
+    sched->base += delta;
+
+    _shift_keys (sched, sched->releases, delta);
+
+    if (SCHED_EDF == sched->policy) {
+
+      _shift_keys (sched, sched->ready, delta);
+
+    }
+
+  }
+
+}
+
+
+static bool _make_ready (scheduler_t* sched, sched_task_t* task) {
+
+  uint16_t key = (SCHED_EDF == sched->policy) ? _key (sched, task->deadline) : task->priority;
+
+  return pq_insert (sched->ready, task, key);
+
+}
+
+
+static void _release_due (scheduler_t* sched, uint64_t now) {
+
+  const sched_task_t* task = (const sched_task_t*)pq_peek (sched->releases);
+
+  while (NULL != task && task->release <= now) {
+
+    // Both queues have room for every task, so this cannot fail
+    _make_ready (sched, (sched_task_t*)pq_extract (sched->releases));
+
+    task = (const sched_task_t*)pq_peek (sched->releases);
+
+  }
+
+}
+
+
+static void _run (scheduler_t* sched, sched_task_t* task) {
+
+  uint64_t start = sched->clock (sched->clock_ctx);
+  uint64_t jitter = (start > task->release) ? start - task->release : 0;
+
+  task->job (task->ctx);
+
+  if (sched->clock (sched->clock_ctx) > task->deadline) {
+
+    task->misses++;
+    sched->misses++;
+
+  }
+
+  task->activations++;
+  task->total_jitter += jitter;
+
+  if (jitter > task->max_jitter) {
+
+    task->max_jitter = jitter;
+
+  }
+
+  sched->dispatched++;
+
+}
+
+/********************** external functions definition ************************/
+
+bool sched_init (scheduler_t* sched, void* releases_pool, void* ready_pool, size_t capacity,
+                 sched_policy_t policy, sched_clock_t clock, void* clock_ctx) {
+
+  bool successful = false;
+
+  if (NULL != sched && NULL != clock &&
+      (SCHED_EDF == policy || SCHED_FIXED_PRIORITY == policy)) {
+
+    sched->releases = pq_create (releases_pool, capacity, PQ_MIN_PRIORITY_QUEUE);
+    sched->ready = pq_create (ready_pool, capacity, PQ_MIN_PRIORITY_QUEUE);
+
+    if (NULL != sched->releases && NULL != sched->ready) {
+
+      sched->policy = policy;
+      sched->clock = clock;
+      sched->clock_ctx = clock_ctx;
+      sched->base = clock (clock_ctx);
+      sched->dispatched = 0;
+      sched->misses = 0;
+
+      successful = true;
+
+    }
+
+  }
+
+  return successful;
+
+}
+
+
+bool sched_task_init (sched_task_t* task, sched_job_t job, void* ctx, uint32_t period,
+                      uint32_t relative_deadline, uint16_t priority) {
+
+  bool successful = false;
+
+  if (NULL != task && NULL != job &&
+      period <= SCHED_MAX_INTERVAL && relative_deadline <= SCHED_MAX_INTERVAL) {
+
+    task->job = job;
+    task->ctx = ctx;
+    task->priority = priority;
+    task->period = period;
+    task->relative_deadline = relative_deadline;
+    task->release = 0;
+    task->deadline = 0;
+    task->activations = 0;
+    task->misses = 0;
+    task->total_jitter = 0;
+    task->max_jitter = 0;
+
+    successful = true;
+
+  }
+
+  return successful;
+
+}
+
+
+bool sched_add (scheduler_t* sched, sched_task_t* task, uint64_t release) {
+
+  bool successful = false;
+
+  if (NULL != sched && NULL != task &&
+      release <= sched->clock (sched->clock_ctx) + SCHED_MAX_INTERVAL) {
+
+    task->release = release;
+    task->deadline = release + task->relative_deadline;
+
+    successful = pq_insert (sched->releases, task, _key (sched, release));
+
+  }
+
+  return successful;
+
+}
+
+
+bool sched_run_once (scheduler_t* sched) {
+
+  bool dispatched = false;
+
+  if (NULL != sched) {
+
+    uint64_t now = sched->clock (sched->clock_ctx);
+    sched_task_t* task = NULL;
+
+    _rebase (sched, now);
+    _release_due (sched, now);
+
+    task = (sched_task_t*)pq_extract (sched->ready);
+
+    if (NULL != task) {
+
+      _run (sched, task);
+
+      if (SCHED_ONE_SHOT != task->period) {
+
+        task->release += task->period;
+        task->deadline = task->release + task->relative_deadline;
+
+        pq_insert (sched->releases, task, _key (sched, task->release));
+
+      }
+
+      dispatched = true;
+
+    }
+
+  }
+
+  return dispatched;
+
+}
+
+
+bool sched_next_release (const scheduler_t* sched, uint64_t* release) {
+
+  bool found = false;
+
+  if (NULL != sched && NULL != release) {
+
+    const sched_task_t* task = (const sched_task_t*)pq_peek (sched->releases);
+
+    if (NULL != task) {
+
+      *release = task->release;
+      found = true;
+
+    }
+
+  }
+
+  return found;
+
+}
+
+
+size_t sched_pending (const scheduler_t* sched) {
+
+  size_t pending = 0;
+
+  if (NULL != sched) {
+
+    pending = pq_size (sched->releases) + pq_size (sched->ready);
+
+  }
+
+  return pending;
+
+}
+
+/********************** end of file ******************************************/
@@ -0,0 +1,386 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+
+/** \brief Implementation file for timer wheel module
+ **
+ ** A timer goes to the lowest level L whose next-coarser bits match the current time, that is
+ ** (deadline >> (TW_SLOT_BITS * (L + 1))) == (now >> (TW_SLOT_BITS * (L + 1))), in slot
+ ** (deadline >> (TW_SLOT_BITS * L)) % TW_SLOTS. That slot is visited exactly when the upper
+ ** bits of time reach the deadline, so level 0 slots hold only timers due at that tick.
+ **
+ ** \addtogroup timer_wheel module
+ ** \author Roberto Castro Beltran <
+ ** @{ */
+
+/********************** inclusions *******************************************/
+
+#include "timer_wheel.h"
+
+/********************** macros and definitions *******************************/
+#define SLOT_MASK                 (TW_SLOTS - 1U)
+#define SPAN_MASK                 (TW_SPAN - 1U)
+
+/********************** internal data declaration ****************************/
+
+/********************** internal functions declaration ***********************/
+
+static void _link (tw_timer_t** slot, tw_timer_t* timer);
+
+static void _unlink (tw_timer_t* timer);
+
+static bool _place (timer_wheel_t* tw, tw_timer_t* timer);
+
+static bool _is_timer (const pq_node_t* node, void* ctx);
+
+static void _cascade_level (timer_wheel_t* tw, unsigned level);
+
+static void _cascade_overflow (timer_wheel_t* tw);
+
+static size_t _expire_tick (timer_wheel_t* tw);
+
+/********************** internal data definition *****************************/
+
+
+/********************** external data definition *****************************/
+
+
+/********************** internal functions definition ************************/
+
+static void _link (tw_timer_t** slot, tw_timer_t* timer) {
+
+  timer->prev = NULL;
+  timer->next = *slot;
+
+  if (NULL != *slot) {
+
+    (*slot)->prev = timer;
+
+  }
+
+  *slot = timer;
+  timer->slot = slot;
+
+}
+
+
+static void _unlink (tw_timer_t* timer) {
+
+  if (NULL != timer->prev) {
+
+    timer->prev->next = timer->next;
+
+  } else {
+
+    *timer->slot = timer->next;
+
+  }
+
+  if (NULL != timer->next) {
+
+    timer->next->prev = timer->prev;
+
+  }
+
+  timer->next = NULL;
+  timer->prev = NULL;
+  timer->slot = NULL;
+
+}
+
+
+static bool _place (timer_wheel_t* tw, tw_timer_t* timer) {
+
+  bool placed = false;
+  uint64_t deadline = timer->deadline;
+
+  for (unsigned level = 0; !placed && level < TW_LEVELS; level++) {
+
+    unsigned shift = TW_SLOT_BITS * level;
+
+    if ((deadline >> (shift + TW_SLOT_BITS)) == (tw->now >> (shift + TW_SLOT_BITS))) {
+
+      _link (&tw->slots[level][(deadline >> shift) & SLOT_MASK], timer);
+      timer->state = TW_TIMER_IN_WHEEL;
+      tw->in_wheel++;
+
+      placed = true;
+
+    }
+
+  }
+
+  if (!placed) {
+
+    uint64_t key = (deadline >> TW_SPAN_BITS) - tw->overflow_base;
+
+    if (key <= TW_MAX_EPOCHS && pq_insert (tw->overflow, timer, (uint16_t)key)) {
+
+      timer->state = TW_TIMER_IN_OVERFLOW;
+
+      placed = true;
+
+    }
+
+  }
+
+  return placed;
+
+}
+
+
+static bool _is_timer (const pq_node_t* node, void* ctx) {
+
+  return (node->data == ctx);
+
+}
+
+
+static void _cascade_level (timer_wheel_t* tw, unsigned level) {
+
+  tw_timer_t** slot = &tw->slots[level][(tw->now >> (TW_SLOT_BITS * level)) & SLOT_MASK];
+  tw_timer_t* timer = *slot;
+
+  *slot = NULL;
+
+  while (NULL != timer) {
+
+    tw_timer_t* next = timer->next;
+
+    tw->in_wheel--;
+    _place (tw, timer); // Always fits a lower level: its upper bits match now
+
+    timer = next;
+
+  }
+
+}
+
+
+static void _cascade_overflow (timer_wheel_t* tw) {
+
+  uint64_t key = (tw->now >> TW_SPAN_BITS) - tw->overflow_base;
+
+  while (NULL != pq_peek (tw->overflow) && tw->overflow->nodes[0].priority <= key) {
+
+    _place (tw, (tw_timer_t*)pq_extract (tw->overflow));
+
+  }
+
+  // Every remaining key is above the current one, so shifting them all keeps the heap order
+  if (key >= TW_RENORMALIZE_EPOCHS) {
+
+    for (size_t i = 0; i < tw->overflow->size; i++) {
+
+      tw->overflow->nodes[i].priority -= (uint16_t)key;
+
+    }
+
+    tw->overflow_base += key;
+
+  }
+
+}
+
+
+static size_t _expire_tick (timer_wheel_t* tw) {
+
+  tw_timer_t** slot = &tw->slots[0][tw->now & SLOT_MASK];
+  size_t expired = 0;
+
+  // Callbacks cannot arm into this slot (deadlines are after now), but they may cancel
+  // timers still in it, so always take the current head
+  while (NULL != *slot) {
+
+    tw_timer_t* timer = *slot;
+
+    _unlink (timer);
+    timer->state = TW_TIMER_IDLE;
+    tw->in_wheel--;
+
+    expired++;
+    timer->callback (timer->ctx);
+
+  }
+
+  return expired;
+
+}
+
+/********************** external functions definition ************************/
+
+bool tw_init (timer_wheel_t* tw, void* overflow_pool, size_t overflow_capacity, uint64_t now) {
+
+  bool successful = false;
+
+  if (NULL != tw) {
+
+    tw->overflow = pq_create (overflow_pool, overflow_capacity, PQ_MIN_PRIORITY_QUEUE);
+
+    if (NULL != tw->overflow) {
+
+      tw->now = now;
+      tw->in_wheel = 0;
+      tw->overflow_base = now >> TW_SPAN_BITS;
+
+      for (unsigned level = 0; level < TW_LEVELS; level++) {
+
+        for (unsigned slot = 0; slot < TW_SLOTS; slot++) {
+
+          tw->slots[level][slot] = NULL;
+
+        }
+
+      }
+
+      successful = true;
+
+    }
+
+  }
+
+  return successful;
+
+}
+
+
+void tw_timer_init (tw_timer_t* timer, tw_callback_t callback, void* ctx) {
+
+  if (NULL != timer) {
+
+    timer->next = NULL;
+    timer->prev = NULL;
+    timer->slot = NULL;
+    timer->deadline = 0;
+    timer->state = TW_TIMER_IDLE;
+    timer->callback = callback;
+    timer->ctx = ctx;
+
+  }
+
+}
+
+
+bool tw_arm (timer_wheel_t* tw, tw_timer_t* timer, uint64_t deadline) {
+
+  bool successful = false;
+
+  if (NULL != tw && NULL != timer && NULL != timer->callback) {
+
+    tw_cancel (tw, timer);
+
+    timer->deadline = (deadline > tw->now) ? deadline : tw->now + 1;
+
+    successful = _place (tw, timer);
+
+  }
+
+  return successful;
+
+}
+
+
+bool tw_cancel (timer_wheel_t* tw, tw_timer_t* timer) {
+
+  bool cancelled = false;
+
+  if (NULL != tw && NULL != timer) {
+
+    if (TW_TIMER_IN_WHEEL == timer->state) {
+
+      _unlink (timer);
+      tw->in_wheel--;
+      cancelled = true;
+
+    } else if (TW_TIMER_IN_OVERFLOW == timer->state) {
+
+      // A tombstone keeps the heap shape and forgets the timer, so the caller may free it
+      pq_remove_if_lazy (tw->overflow, _is_timer, timer);
+      cancelled = true;
+
+    }
+
+    timer->state = TW_TIMER_IDLE;
+
+  }
+
+  return cancelled;
+
+}
+
+
+size_t tw_advance (timer_wheel_t* tw, uint64_t now) {
+
+  size_t expired = 0;
+
+  while (NULL != tw && tw->now < now) {
+
+    // With an empty wheel nothing happens until the next epoch starts
+    if (0 == tw->in_wheel) {
+
+      uint64_t next_epoch = (tw->now | SPAN_MASK) + 1;
+
+      if (next_epoch > now) {
+
+        tw->now = now;
+        break;
+
+      }
+
+      tw->now = next_epoch - 1;
+
+    }
+
+    tw->now++;
+
+    if (0 == (tw->now & SPAN_MASK)) {
+
+      _cascade_overflow (tw);
+
+    }
+
+    // Coarser levels first, so cascaded timers are never left in a slot already visited
+    for (unsigned level = TW_LEVELS - 1; level > 0; level--) {
+
+      if (0 == (tw->now & ((1ULL << (TW_SLOT_BITS * level)) - 1U))) {
+
+        _cascade_level (tw, level);
+
+      }
+
+    }
+
+    expired += _expire_tick (tw);
+
+  }
+
+  return expired;
+
+}
+
+
+bool tw_is_armed (const tw_timer_t* timer) {
+
+  return (NULL != timer && TW_TIMER_IDLE != timer->state);
+
+}
+
+/********************** end of file ******************************************/
@@ -0,0 +1,285 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo de ordenamiento externo
+ **
+ ** Pruebas a realizar:
+ ** - Ordenar un fichero que entra en una sola corrida
+ ** - Ordenar con poca memoria para forzar muchas corridas y verificar el resultado
+ ** - Ordenar registros cortos que no entran en el indice y partir cada trozo en corridas
+ ** - Agregar el salto de linea a la ultima linea que no lo tiene
+ ** - Ordenar un fichero vacio
+ ** - Fallar si un registro no entra en un cuarto de la memoria
+ ** - Validar comportamiento ante nulos y ficheros inexistentes
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "loser_tree.h"
+#include "external_sort.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define LINES         20000
+#define LINE_SIZE     24
+#define CONTENT_SIZE  (LINES * LINE_SIZE)
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+static char input[] = "/tmp/test_es_in_XXXXXX";
+static char output[] = "/tmp/test_es_out_XXXXXX";
+static char content[CONTENT_SIZE];
+static char result[CONTENT_SIZE + 2];
+static es_stats_t stats;
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void _write_input (const char* data, size_t length) {
+
+  FILE* file = fopen (input, "wb");
+
+  TEST_ASSERT_NOT_NULL (file);
+  TEST_ASSERT_EQUAL (length, fwrite (data, 1, length, file));
+  fclose (file);
+
+}
+
+static size_t _read_output (void) {
+
+  FILE* file = fopen (output, "rb");
+  size_t length = 0;
+
+  TEST_ASSERT_NOT_NULL (file);
+  length = fread (result, 1, sizeof(result) - 1U, file);
+  fclose (file);
+  result[length] = '\0';
+
+  return length;
+
+}
+
+static int _compare_lines (const void* a, const void* b) {
+
+  return strcmp (*(const char* const*)a, *(const char* const*)b);
+
+}
+
+// Lineas de largo variable con repeticiones; devuelve el largo total
+static size_t _make_lines (char** lines) {
+
+  static char storage[LINES][LINE_SIZE];
+  uint32_t seed = 5;
+  size_t length = 0;
+
+  for (unsigned i = 0; i < LINES; i++) {
+
+    seed = seed * 1103515245U + 12345U;
+    snprintf (storage[i], LINE_SIZE, "%u-%.*s", (seed >> 16) % 500U, (int)((seed >> 8) % 8U), "abcdefgh");
+    lines[i] = storage[i];
+    length += strlen (storage[i]) + 1U;
+
+  }
+
+  return length;
+
+}
+
+static size_t _join (char** lines, char* buffer) {
+
+  size_t length = 0;
+
+  for (unsigned i = 0; i < LINES; i++) {
+
+    size_t line_length = strlen (lines[i]);
+
+    memcpy (buffer + length, lines[i], line_length);
+    buffer[length + line_length] = '\n';
+    length += line_length + 1U;
+
+  }
+
+  return length;
+
+}
+
+static void _assert_sorts (size_t memory_limit) {
+
+  static char* lines[LINES];
+  static char expected[CONTENT_SIZE];
+  es_config_t config = { memory_limit, "/tmp" };
+  size_t length = _make_lines (lines);
+
+  TEST_ASSERT_EQUAL (length, _join (lines, content));
+  _write_input (content, length);
+
+  qsort (lines, LINES, sizeof(char*), _compare_lines);
+  _join (lines, expected);
+
+  TEST_ASSERT_TRUE (es_sort_file (input, output, &config, &stats));
+  TEST_ASSERT_EQUAL (length, _read_output ());
+  TEST_ASSERT_EQUAL_MEMORY (expected, result, length);
+
+  TEST_ASSERT_EQUAL (LINES, stats.records);
+  TEST_ASSERT_EQUAL (length, stats.bytes);
+
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+  strcpy (input, "/tmp/test_es_in_XXXXXX");
+  strcpy (output, "/tmp/test_es_out_XXXXXX");
+  close (mkstemp (input));
+  close (mkstemp (output));
+
+}
+
+void tearDown(void) {
+
+  unlink (input);
+  unlink (output);
+
+}
+
+
+void test_ordenar_un_fichero_que_entra_en_una_sola_corrida (void) {
+
+  _assert_sorts (ES_DEFAULT_MEMORY);
+  TEST_ASSERT_EQUAL (1U, stats.runs);
+  TEST_ASSERT_EQUAL (0U, stats.merge_comparisons);
+
+}
+
+
+void test_ordenar_con_poca_memoria_para_forzar_muchas_corridas_y_verificar_el_resultado (void) {
+
+  // Trozos de 8 KiB para unos 180 KiB de datos: mas de 16 corridas
+  _assert_sorts (8U * ES_BLOCK_SIZE);
+  TEST_ASSERT_TRUE (stats.runs > 16U);
+  TEST_ASSERT_TRUE (stats.merge_comparisons <= 6U * LINES);
+
+}
+
+
+void test_ordenar_registros_cortos_que_no_entran_en_el_indice_y_partir_cada_trozo_en_corridas (void) {
+
+  // Trozos de 8 KiB de registros de 2 bytes y un indice de 16 KiB: 1024 registros por corrida
+  es_config_t config = { 8U * ES_BLOCK_SIZE, "/tmp" };
+  const size_t records = 8U * 1024U;
+  size_t counts[10] = { 0 };
+  size_t length = 0;
+
+  for (size_t i = 0; i < records; i++) {
+
+    content[2U * i] = (char)('0' + (i * 7U) % 10U);
+    content[2U * i + 1U] = '\n';
+    counts[(i * 7U) % 10U]++;
+
+  }
+
+  _write_input (content, 2U * records);
+
+  TEST_ASSERT_TRUE (es_sort_file (input, output, &config, &stats));
+  TEST_ASSERT_EQUAL (2U * records, _read_output ());
+  TEST_ASSERT_EQUAL (records, stats.records);
+  TEST_ASSERT_EQUAL (records / 1024U, stats.runs);
+
+  for (unsigned digit = 0; digit < 10U; digit++) {
+
+    for (size_t i = 0; i < counts[digit]; i++, length += 2U) {
+
+      TEST_ASSERT_EQUAL ('0' + digit, result[length]);
+      TEST_ASSERT_EQUAL ('\n', result[length + 1U]);
+
+    }
+
+  }
+
+}
+
+
+void test_agregar_el_salto_de_linea_a_la_ultima_linea_que_no_lo_tiene (void) {
+
+  _write_input ("pera\nbanana\nmanzana", 19);
+
+  TEST_ASSERT_TRUE (es_sort_file (input, output, NULL, &stats));
+  TEST_ASSERT_EQUAL (20U, _read_output ());
+  TEST_ASSERT_EQUAL_STRING ("banana\nmanzana\npera\n", result);
+
+}
+
+
+void test_ordenar_un_fichero_vacio (void) {
+
+  _write_input ("", 0);
+
+  TEST_ASSERT_TRUE (es_sort_file (input, output, NULL, &stats));
+  TEST_ASSERT_EQUAL (0U, _read_output ());
+  TEST_ASSERT_EQUAL (0U, stats.runs);
+  TEST_ASSERT_EQUAL (0U, stats.records);
+
+}
+
+
+void test_fallar_si_un_registro_no_entra_en_un_cuarto_de_la_memoria (void) {
+
+  es_config_t config = { 8U * ES_BLOCK_SIZE, NULL };
+
+  memset (content, 'x', 3U * ES_BLOCK_SIZE);
+  content[3U * ES_BLOCK_SIZE] = '\n';
+  _write_input (content, 3U * ES_BLOCK_SIZE + 1U);
+
+  TEST_ASSERT_FALSE (es_sort_file (input, output, &config, NULL));
+
+}
+
+
+void test_validar_comportamiento_ante_nulos_y_ficheros_inexistentes (void) {
+
+  es_config_t config = { 4U * ES_BLOCK_SIZE, NULL };
+
+  TEST_ASSERT_FALSE (es_sort_file (NULL, output, NULL, NULL));
+  TEST_ASSERT_FALSE (es_sort_file (input, NULL, NULL, NULL));
+  TEST_ASSERT_FALSE (es_sort_file ("/tmp/no/existe", output, NULL, NULL));
+  TEST_ASSERT_FALSE (es_sort_file (input, "/tmp/no/existe", NULL, NULL));
+  TEST_ASSERT_FALSE (es_sort_file (input, output, &config, NULL));
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,214 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo de cola equitativa ponderada
+ **
+ ** Pruebas a realizar:
+ ** - Con varias clases cargadas verificar que las extracciones se reparten segun los pesos
+ ** - Verificar que dentro de cada clase se respeta el orden de prioridad
+ ** - Verificar que las clases sin elementos no se visitan y que una clase que se activa entra al final de la ronda
+ ** - Adjuntar una cola que ya tiene elementos y verificar que se atiende
+ ** - Validar comportamiento ante nulos y clases invalidas
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "priority_queue.h"
+#include "fair_queue.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define CLASSES_NUMBER  16
+#define ELEMENTS_NUMBER 32
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+static uint8_t _memory_pools [CLASSES_NUMBER][PQ_MEMORY_SIZE(ELEMENTS_NUMBER)];
+static priority_queue_t* queues[CLASSES_NUMBER];
+static fq_class_t classes[CLASSES_NUMBER];
+static fair_queue_t fq;
+static int values[ELEMENTS_NUMBER];
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void _attach (size_t class_id, uint16_t weight) {
+
+  TEST_ASSERT_TRUE (fq_attach (&fq, class_id, queues[class_id], weight));
+
+}
+
+static void _fill (size_t class_id, unsigned count) {
+
+  for (unsigned i = 0; i < count; i++) {
+
+    TEST_ASSERT_TRUE (fq_insert (&fq, class_id, &values[i], (uint16_t)i));
+
+  }
+
+}
+
+static void _assert_classes (const size_t* expected, size_t count) {
+
+  size_t class_id = CLASSES_NUMBER;
+
+  for (size_t i = 0; i < count; i++) {
+
+    TEST_ASSERT_NOT_NULL (fq_extract (&fq, &class_id));
+    TEST_ASSERT_EQUAL (expected[i], class_id);
+
+  }
+
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+  for (size_t i = 0; i < CLASSES_NUMBER; i++) {
+
+    queues[i] = pq_create (_memory_pools[i], ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE);
+
+  }
+
+  TEST_ASSERT_TRUE (fq_init (&fq, classes, CLASSES_NUMBER));
+
+}
+
+void tearDown(void) {
+
+}
+
+
+void test_con_varias_clases_cargadas_verificar_que_las_extracciones_se_reparten_segun_los_pesos (void) {
+
+  const size_t expected[] = { 0, 1, 1, 2, 2, 2, 0, 1, 1, 2, 2, 2 };
+
+  for (size_t i = 0; i < 3; i++) {
+
+    _attach (i, (uint16_t)(i + 1));
+    _fill (i, 10);
+
+  }
+
+  TEST_ASSERT_EQUAL (30U, fq_size (&fq));
+  _assert_classes (expected, 12);
+  TEST_ASSERT_EQUAL (18U, fq_size (&fq));
+
+}
+
+
+void test_verificar_que_dentro_de_cada_clase_se_respeta_el_orden_de_prioridad (void) {
+
+  _attach (0, 2);
+  TEST_ASSERT_TRUE (fq_insert (&fq, 0, &values[0], 30));
+  TEST_ASSERT_TRUE (fq_insert (&fq, 0, &values[1], 10));
+  TEST_ASSERT_TRUE (fq_insert (&fq, 0, &values[2], 20));
+
+  TEST_ASSERT_EQUAL_PTR (&values[1], fq_peek (&fq));
+  TEST_ASSERT_EQUAL_PTR (&values[1], fq_extract (&fq, NULL));
+  TEST_ASSERT_EQUAL_PTR (&values[2], fq_extract (&fq, NULL));
+  TEST_ASSERT_EQUAL_PTR (&values[0], fq_extract (&fq, NULL));
+  TEST_ASSERT_TRUE (fq_is_empty (&fq));
+  TEST_ASSERT_NULL (fq_extract (&fq, NULL));
+
+}
+
+
+void test_verificar_que_las_clases_sin_elementos_no_se_visitan_y_que_una_clase_que_se_activa_entra_al_final_de_la_ronda (void) {
+
+  const size_t first[] = { 3, 9 };
+  const size_t second[] = { 3, 9, 12, 3, 9, 12 };
+
+  for (size_t i = 0; i < CLASSES_NUMBER; i++) {
+
+    _attach (i, 1);
+
+  }
+
+  _fill (3, 3);
+  _fill (9, 3);
+  _assert_classes (first, 2);
+
+  _fill (12, 2);
+  _assert_classes (second, 6);
+  TEST_ASSERT_TRUE (fq_is_empty (&fq));
+  TEST_ASSERT_NULL (fq.head);
+
+}
+
+
+void test_adjuntar_una_cola_que_ya_tiene_elementos_y_verificar_que_se_atiende (void) {
+
+  const size_t expected[] = { 5, 5, 5, 1, 5 };
+
+  pq_insert (queues[5], &values[0], 1);
+  pq_insert (queues[5], &values[1], 2);
+  pq_insert (queues[5], &values[2], 3);
+  pq_insert (queues[5], &values[3], 4);
+
+  _attach (5, 3);
+  _attach (1, 3);
+  _fill (1, 1);
+
+  TEST_ASSERT_EQUAL (5U, fq_size (&fq));
+  _assert_classes (expected, 5);
+  TEST_ASSERT_TRUE (fq_is_empty (&fq));
+
+}
+
+
+void test_validar_comportamiento_ante_nulos_y_clases_invalidas (void) {
+
+  TEST_ASSERT_FALSE (fq_init (NULL, classes, CLASSES_NUMBER));
+  TEST_ASSERT_FALSE (fq_init (&fq, NULL, CLASSES_NUMBER));
+  TEST_ASSERT_FALSE (fq_init (&fq, classes, 0));
+
+  TEST_ASSERT_FALSE (fq_attach (NULL, 0, queues[0], 1));
+  TEST_ASSERT_FALSE (fq_attach (&fq, CLASSES_NUMBER, queues[0], 1));
+  TEST_ASSERT_FALSE (fq_attach (&fq, 0, NULL, 1));
+  TEST_ASSERT_FALSE (fq_attach (&fq, 0, queues[0], 0));
+  _attach (0, 1);
+  TEST_ASSERT_FALSE (fq_attach (&fq, 0, queues[1], 1));
+
+  TEST_ASSERT_FALSE (fq_insert (NULL, 0, &values[0], 1));
+  TEST_ASSERT_FALSE (fq_insert (&fq, CLASSES_NUMBER, &values[0], 1));
+  TEST_ASSERT_FALSE (fq_insert (&fq, 1, &values[0], 1));
+  TEST_ASSERT_NULL (fq_peek (NULL));
+  TEST_ASSERT_NULL (fq_extract (NULL, NULL));
+  TEST_ASSERT_TRUE (fq_is_empty (NULL));
+  TEST_ASSERT_EQUAL (0U, fq_size (NULL));
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,315 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo de busqueda en grafos
+ **
+ ** Pruebas a realizar:
+ ** - Calcular distancias y caminos con Dijkstra sobre ambos tipos de cola
+ ** - Verificar que un vertice sin camino se informa como inalcanzable
+ ** - Buscar en una grilla con A* y verificar que da la misma distancia que Dijkstra explorando menos
+ ** - Repetir consultas sobre la misma busqueda y verificar que no se mezclan resultados
+ ** - Guardar un grafo en un fichero, abrirlo y verificar que se recupera igual
+ ** - Rechazar grafos y ficheros invalidos
+ ** - Validar comportamiento ante nulos y vertices fuera de rango
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "indexed_pq.h"
+#include "radix_heap.h"
+#include "graph_search.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define VERTICES       6
+#define EDGES          6
+#define GRID_SIDE      16
+#define GRID_VERTICES  (GRID_SIDE * GRID_SIDE)
+#define GRID_EDGES     (4 * GRID_SIDE * (GRID_SIDE - 1))
+#define POOL_WORDS     (GS_MEMORY_SIZE(GS_RADIX_HEAP, GRID_VERTICES, GRID_EDGES) / sizeof(uint64_t) + \
+                        GS_MEMORY_SIZE(GS_INDEXED_HEAP, GRID_VERTICES, GRID_EDGES) / sizeof(uint64_t) + 1)
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+// 0->1 (4), 0->2 (1), 2->1 (2), 2->3 (5), 1->3 (1), 3->4 (3); el 5 queda aislado
+static const uint32_t offsets[VERTICES + 1] = { 0, 2, 3, 5, 6, 6, 6 };
+static const uint32_t targets[EDGES] = { 1, 2, 3, 1, 3, 4 };
+static const uint32_t weights[EDGES] = { 4, 1, 1, 2, 5, 3 };
+
+static uint32_t grid_offsets[GRID_VERTICES + 1];
+static uint32_t grid_targets[GRID_EDGES];
+static uint32_t grid_weights[GRID_EDGES];
+
+static uint64_t _memory_pool [POOL_WORDS];
+static graph_t graph;
+static graph_search_t gs;
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void _build_grid (void) {
+
+  uint32_t edge = 0;
+
+  for (uint32_t v = 0; v < GRID_VERTICES; v++) {
+
+    uint32_t x = v % GRID_SIDE;
+    uint32_t y = v / GRID_SIDE;
+    const int32_t dx[] = { 1, -1, 0, 0 };
+    const int32_t dy[] = { 0, 0, 1, -1 };
+
+    grid_offsets[v] = edge;
+
+    for (unsigned d = 0; d < 4; d++) {
+
+      int32_t nx = (int32_t)x + dx[d];
+      int32_t ny = (int32_t)y + dy[d];
+
+      if (nx >= 0 && nx < GRID_SIDE && ny >= 0 && ny < GRID_SIDE) {
+
+        grid_targets[edge] = (uint32_t)(ny * GRID_SIDE + nx);
+        grid_weights[edge] = 1U + (v * 31U + d * 7U) % 5U; // Nunca menor que la distancia Manhattan
+        edge++;
+
+      }
+
+    }
+
+  }
+
+  grid_offsets[GRID_VERTICES] = edge;
+
+}
+
+static uint64_t _manhattan (uint32_t vertex, uint32_t target, void* ctx) {
+
+  int32_t dx = (int32_t)(vertex % GRID_SIDE) - (int32_t)(target % GRID_SIDE);
+  int32_t dy = (int32_t)(vertex / GRID_SIDE) - (int32_t)(target / GRID_SIDE);
+
+  (void)ctx;
+
+  return (uint64_t)((dx < 0 ? -dx : dx) + (dy < 0 ? -dy : dy));
+
+}
+
+static void _assert_small_graph (gs_backend_t backend) {
+
+  const uint64_t expected[] = { 0, 3, 1, 4, 7 };
+  const uint32_t expected_path[] = { 0, 2, 1, 3, 4 };
+  uint32_t path[VERTICES];
+
+  TEST_ASSERT_TRUE (gs_init (&gs, &graph, _memory_pool, backend));
+  TEST_ASSERT_EQUAL (GS_UNREACHABLE, gs_dijkstra (&gs, 0, GS_NO_VERTEX));
+
+  for (uint32_t v = 0; v < 5; v++) {
+
+    TEST_ASSERT_EQUAL (expected[v], gs_distance (&gs, v));
+
+  }
+
+  TEST_ASSERT_EQUAL (5U, gs_path (&gs, 4, path, VERTICES));
+  TEST_ASSERT_EQUAL_UINT32_ARRAY (expected_path, path, 5);
+  TEST_ASSERT_EQUAL (0U, gs_path (&gs, 4, path, 4));
+  TEST_ASSERT_EQUAL (5U, gs.stats.settled);
+
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+  TEST_ASSERT_TRUE (graph_init (&graph, VERTICES, EDGES, offsets, targets, weights));
+
+}
+
+void tearDown(void) {
+
+}
+
+
+void test_calcular_distancias_y_caminos_con_dijkstra_sobre_ambos_tipos_de_cola (void) {
+
+  _assert_small_graph (GS_INDEXED_HEAP);
+  TEST_ASSERT_EQUAL (2U, gs.stats.decreases);
+
+  _assert_small_graph (GS_RADIX_HEAP);
+  TEST_ASSERT_EQUAL (0U, gs.stats.decreases);
+  TEST_ASSERT_EQUAL (gs.stats.pushes, gs.stats.pops);
+
+}
+
+
+void test_verificar_que_un_vertice_sin_camino_se_informa_como_inalcanzable (void) {
+
+  uint32_t path[VERTICES];
+
+  TEST_ASSERT_TRUE (gs_init (&gs, &graph, _memory_pool, GS_INDEXED_HEAP));
+
+  TEST_ASSERT_EQUAL (GS_UNREACHABLE, gs_dijkstra (&gs, 0, 5));
+  TEST_ASSERT_EQUAL (GS_UNREACHABLE, gs_distance (&gs, 5));
+  TEST_ASSERT_EQUAL (0U, gs_path (&gs, 5, path, VERTICES));
+
+  TEST_ASSERT_EQUAL (GS_UNREACHABLE, gs_dijkstra (&gs, 4, 0));
+
+}
+
+
+void test_buscar_en_una_grilla_con_a_estrella_y_verificar_que_da_la_misma_distancia_que_dijkstra_explorando_menos (void) {
+
+  _build_grid ();
+  TEST_ASSERT_TRUE (graph_init (&graph, GRID_VERTICES, grid_offsets[GRID_VERTICES],
+                                grid_offsets, grid_targets, grid_weights));
+
+  for (gs_backend_t backend = GS_INDEXED_HEAP; backend <= GS_RADIX_HEAP; backend++) {
+
+    TEST_ASSERT_TRUE (gs_init (&gs, &graph, _memory_pool, backend));
+
+    for (uint32_t target = 17; target < GRID_VERTICES; target += 37) {
+
+      uint64_t dijkstra = gs_dijkstra (&gs, 0, target);
+      size_t dijkstra_settled = gs.stats.settled;
+
+      TEST_ASSERT_EQUAL (dijkstra, gs_astar (&gs, 0, target, _manhattan, NULL));
+      TEST_ASSERT_TRUE (gs.stats.settled <= dijkstra_settled);
+
+    }
+
+  }
+
+}
+
+
+void test_repetir_consultas_sobre_la_misma_busqueda_y_verificar_que_no_se_mezclan_resultados (void) {
+
+  TEST_ASSERT_TRUE (gs_init (&gs, &graph, _memory_pool, GS_RADIX_HEAP));
+
+  TEST_ASSERT_EQUAL (4U, gs_dijkstra (&gs, 0, 3));
+  TEST_ASSERT_EQUAL (4U, gs_dijkstra (&gs, 1, 4));
+
+  // El 0 no es alcanzable desde el 1: no debe quedar la distancia de la consulta anterior
+  TEST_ASSERT_EQUAL (GS_UNREACHABLE, gs_distance (&gs, 0));
+  TEST_ASSERT_EQUAL (GS_UNREACHABLE, gs_distance (&gs, 2));
+
+  gs.query = UINT32_MAX; // Fuerza la vuelta del contador de consultas
+  TEST_ASSERT_EQUAL (7U, gs_dijkstra (&gs, 0, 4));
+  TEST_ASSERT_EQUAL (1U, gs.query);
+
+}
+
+
+void test_guardar_un_grafo_en_un_fichero_abrirlo_y_verificar_que_se_recupera_igual (void) {
+
+  char path[] = "/tmp/test_graph_XXXXXX";
+  graph_t loaded;
+
+  close (mkstemp (path));
+
+  TEST_ASSERT_TRUE (graph_save (&graph, path));
+  TEST_ASSERT_TRUE (graph_open (&loaded, path));
+  TEST_ASSERT_EQUAL (VERTICES, loaded.vertex_count);
+  TEST_ASSERT_EQUAL (EDGES, loaded.edge_count);
+  TEST_ASSERT_EQUAL_UINT32_ARRAY (offsets, loaded.offsets, VERTICES + 1);
+  TEST_ASSERT_EQUAL_UINT32_ARRAY (targets, loaded.targets, EDGES);
+  TEST_ASSERT_EQUAL_UINT32_ARRAY (weights, loaded.weights, EDGES);
+
+  TEST_ASSERT_TRUE (gs_init (&gs, &loaded, _memory_pool, GS_INDEXED_HEAP));
+  TEST_ASSERT_EQUAL (7U, gs_dijkstra (&gs, 0, 4));
+
+  graph_close (&loaded);
+  TEST_ASSERT_NULL (loaded.mapping);
+  unlink (path);
+
+}
+
+
+void test_rechazar_grafos_y_ficheros_invalidos (void) {
+
+  const uint32_t bad_offsets[VERTICES + 1] = { 0, 3, 2, 5, 6, 6, 6 };
+  const uint32_t bad_targets[EDGES] = { 1, 2, 3, 1, 3, VERTICES };
+  char path[] = "/tmp/test_graph_XXXXXX";
+  graph_t loaded;
+  FILE* file = NULL;
+
+  TEST_ASSERT_FALSE (graph_init (&loaded, VERTICES, EDGES, bad_offsets, targets, weights));
+  TEST_ASSERT_FALSE (graph_init (&loaded, VERTICES, EDGES, offsets, bad_targets, weights));
+  TEST_ASSERT_FALSE (graph_init (&loaded, VERTICES, EDGES + 1, offsets, targets, weights));
+  TEST_ASSERT_FALSE (graph_init (&loaded, 0, 0, offsets, targets, weights));
+
+  close (mkstemp (path));
+  TEST_ASSERT_FALSE (graph_open (&loaded, path));
+
+  // Fichero truncado: le falta el ultimo peso
+  TEST_ASSERT_TRUE (graph_save (&graph, path));
+  TEST_ASSERT_EQUAL (0, truncate (path, (off_t)GRAPH_FILE_SIZE(VERTICES, EDGES) - 4));
+  TEST_ASSERT_FALSE (graph_open (&loaded, path));
+
+  file = fopen (path, "wb");
+  fputs ("not a graph file", file);
+  fclose (file);
+  TEST_ASSERT_FALSE (graph_open (&loaded, path));
+
+  unlink (path);
+  TEST_ASSERT_FALSE (graph_open (&loaded, path));
+
+}
+
+
+void test_validar_comportamiento_ante_nulos_y_vertices_fuera_de_rango (void) {
+
+  TEST_ASSERT_FALSE (graph_init (NULL, VERTICES, EDGES, offsets, targets, weights));
+  TEST_ASSERT_FALSE (graph_init (&graph, VERTICES, EDGES, NULL, targets, weights));
+  TEST_ASSERT_FALSE (graph_save (NULL, "/tmp/x"));
+  TEST_ASSERT_FALSE (graph_open (&graph, NULL));
+  graph_close (NULL);
+
+  TEST_ASSERT_FALSE (gs_init (NULL, &graph, _memory_pool, GS_INDEXED_HEAP));
+  TEST_ASSERT_FALSE (gs_init (&gs, NULL, _memory_pool, GS_INDEXED_HEAP));
+  TEST_ASSERT_FALSE (gs_init (&gs, &graph, NULL, GS_INDEXED_HEAP));
+  TEST_ASSERT_FALSE (gs_init (&gs, &graph, _memory_pool, (gs_backend_t)9));
+  TEST_ASSERT_TRUE (gs_init (&gs, &graph, _memory_pool, GS_INDEXED_HEAP));
+
+  TEST_ASSERT_EQUAL (GS_UNREACHABLE, gs_dijkstra (NULL, 0, 1));
+  TEST_ASSERT_EQUAL (GS_UNREACHABLE, gs_dijkstra (&gs, VERTICES, 1));
+  TEST_ASSERT_EQUAL (GS_UNREACHABLE, gs_dijkstra (&gs, 0, VERTICES));
+  TEST_ASSERT_EQUAL (GS_UNREACHABLE, gs_astar (&gs, 0, 1, NULL, NULL));
+  TEST_ASSERT_EQUAL (GS_UNREACHABLE, gs_distance (NULL, 0));
+  TEST_ASSERT_EQUAL (GS_UNREACHABLE, gs_distance (&gs, VERTICES));
+  TEST_ASSERT_EQUAL (0U, gs_path (&gs, 0, NULL, VERTICES));
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,169 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo de cola de prioridad indexada
+ **
+ ** Pruebas a realizar:
+ ** - Insertar indices con distintas claves y extraerlos en orden de clave
+ ** - Disminuir la clave de un indice encolado y verificar que adelanta sin duplicarse
+ ** - Verificar que no se acepta aumentar la clave de un indice encolado
+ ** - Vaciar la cola y verificar que los indices quedan libres para reinsertarse
+ ** - Validar comportamiento ante nulos e indices fuera de rango
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "indexed_pq.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define ELEMENTS_NUMBER 16
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+static uint64_t _memory_pool [IPQ_MEMORY_SIZE(ELEMENTS_NUMBER) / sizeof(uint64_t) + 1];
+static indexed_pq_t* ipq = NULL;
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void _assert_pop (uint32_t expected_index, uint64_t expected_key) {
+
+  uint32_t index = IPQ_ABSENT;
+  uint64_t key = 0;
+
+  TEST_ASSERT_TRUE (ipq_pop (ipq, &index, &key));
+  TEST_ASSERT_EQUAL (expected_index, index);
+  TEST_ASSERT_EQUAL (expected_key, key);
+
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+  ipq = ipq_create (_memory_pool, ELEMENTS_NUMBER);
+  TEST_ASSERT_NOT_NULL (ipq);
+
+}
+
+void tearDown(void) {
+
+}
+
+
+void test_insertar_indices_con_distintas_claves_y_extraerlos_en_orden_de_clave (void) {
+
+  for (uint32_t i = 0; i < ELEMENTS_NUMBER; i++) {
+
+    TEST_ASSERT_TRUE (ipq_push_or_decrease (ipq, i, (uint64_t)((i * 7U) % ELEMENTS_NUMBER) << 40));
+
+  }
+
+  for (uint64_t key = 0; key < ELEMENTS_NUMBER; key++) {
+
+    _assert_pop ((uint32_t)((key * 7U) % ELEMENTS_NUMBER), key << 40);
+
+  }
+
+  TEST_ASSERT_TRUE (ipq_is_empty (ipq));
+  TEST_ASSERT_FALSE (ipq_pop (ipq, NULL, NULL));
+
+}
+
+
+void test_disminuir_la_clave_de_un_indice_encolado_y_verificar_que_adelanta_sin_duplicarse (void) {
+
+  TEST_ASSERT_TRUE (ipq_push_or_decrease (ipq, 3, 30));
+  TEST_ASSERT_TRUE (ipq_push_or_decrease (ipq, 5, 50));
+  TEST_ASSERT_TRUE (ipq_push_or_decrease (ipq, 7, 70));
+
+  TEST_ASSERT_TRUE (ipq_push_or_decrease (ipq, 7, 10));
+  TEST_ASSERT_EQUAL (3U, ipq->size);
+
+  _assert_pop (7, 10);
+  _assert_pop (3, 30);
+  _assert_pop (5, 50);
+  TEST_ASSERT_FALSE (ipq_contains (ipq, 7));
+
+}
+
+
+void test_verificar_que_no_se_acepta_aumentar_la_clave_de_un_indice_encolado (void) {
+
+  TEST_ASSERT_TRUE (ipq_push_or_decrease (ipq, 1, 10));
+  TEST_ASSERT_TRUE (ipq_push_or_decrease (ipq, 2, 20));
+
+  TEST_ASSERT_FALSE (ipq_push_or_decrease (ipq, 1, 25));
+  TEST_ASSERT_FALSE (ipq_push_or_decrease (ipq, 1, 10));
+
+  _assert_pop (1, 10);
+  _assert_pop (2, 20);
+
+}
+
+
+void test_vaciar_la_cola_y_verificar_que_los_indices_quedan_libres_para_reinsertarse (void) {
+
+  TEST_ASSERT_TRUE (ipq_push_or_decrease (ipq, 4, 40));
+  TEST_ASSERT_TRUE (ipq_push_or_decrease (ipq, 9, 90));
+  TEST_ASSERT_TRUE (ipq_contains (ipq, 9));
+
+  ipq_clear (ipq);
+  TEST_ASSERT_TRUE (ipq_is_empty (ipq));
+  TEST_ASSERT_FALSE (ipq_contains (ipq, 4));
+  TEST_ASSERT_FALSE (ipq_contains (ipq, 9));
+
+  // Tras vaciar, una clave mayor se acepta como insercion nueva
+  TEST_ASSERT_TRUE (ipq_push_or_decrease (ipq, 9, 900));
+  _assert_pop (9, 900);
+
+}
+
+
+void test_validar_comportamiento_ante_nulos_e_indices_fuera_de_rango (void) {
+
+  TEST_ASSERT_NULL (ipq_create (NULL, ELEMENTS_NUMBER));
+  TEST_ASSERT_NULL (ipq_create (_memory_pool, 0));
+
+  TEST_ASSERT_FALSE (ipq_push_or_decrease (NULL, 0, 1));
+  TEST_ASSERT_FALSE (ipq_push_or_decrease (ipq, ELEMENTS_NUMBER, 1));
+  TEST_ASSERT_FALSE (ipq_pop (NULL, NULL, NULL));
+  TEST_ASSERT_FALSE (ipq_contains (NULL, 0));
+  TEST_ASSERT_FALSE (ipq_contains (ipq, ELEMENTS_NUMBER));
+  TEST_ASSERT_TRUE (ipq_is_empty (NULL));
+  ipq_clear (NULL);
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,275 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo de arbol de perdedores
+ **
+ ** Pruebas a realizar:
+ ** - Mezclar secuencias ordenadas con distintas cantidades de fuentes y verificar el orden
+ ** - Verificar que los registros iguales salen por numero de fuente
+ ** - Verificar que cada registro cuesta a lo sumo ceil(log_2(k)) comparaciones
+ ** - Mezclar con fuentes vacias desde el principio
+ ** - Validar comportamiento ante nulos
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "loser_tree.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define MAX_SOURCES  13
+#define SOURCE_SIZE  20
+
+/* === Private data type declarations ========================================================== */
+
+typedef struct {
+  uint32_t keys[SOURCE_SIZE];
+  uint32_t size;
+  uint32_t next;
+} source_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+static uint64_t _memory_pool [LT_MEMORY_SIZE(MAX_SOURCES) / sizeof(uint64_t) + 1];
+static source_t sources[MAX_SOURCES];
+static loser_tree_t* lt = NULL;
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static int _compare (uint32_t a, uint32_t b, void* ctx) {
+
+  source_t* all = (source_t*)ctx;
+  uint32_t left = all[a].keys[all[a].next];
+  uint32_t right = all[b].keys[all[b].next];
+
+  return (left > right) - (left < right);
+
+}
+
+static void _fill (uint32_t k, uint32_t size) {
+
+  uint32_t seed = 99;
+
+  for (uint32_t s = 0; s < k; s++) {
+
+    uint32_t key = 0;
+
+    for (uint32_t i = 0; i < size; i++) {
+
+      seed = seed * 1103515245U + 12345U;
+      key += (seed >> 16) % 10U;
+      sources[s].keys[i] = key;
+
+    }
+
+    sources[s].size = size;
+    sources[s].next = 0;
+
+  }
+
+}
+
+static uint32_t _create (uint32_t k) {
+
+  lt = lt_create (_memory_pool, k, _compare, sources);
+  TEST_ASSERT_NOT_NULL (lt);
+
+  for (uint32_t s = 0; s < k; s++) {
+
+    if (0 == sources[s].size) {
+
+      lt_mark_exhausted (lt, s);
+
+    }
+
+  }
+
+  lt_build (lt);
+
+  return k;
+
+}
+
+// Vacia el arbol verificando el orden y devuelve cuantos registros salieron
+static uint32_t _drain (void) {
+
+  uint32_t count = 0;
+  uint32_t last_key = 0;
+  uint32_t last_source = 0;
+
+  for (uint32_t w = lt_winner (lt); LT_NO_SOURCE != w; w = lt_winner (lt)) {
+
+    uint32_t key = sources[w].keys[sources[w].next];
+
+    TEST_ASSERT_TRUE (key > last_key || (key == last_key && w >= last_source) || 0 == count);
+    last_key = key;
+    last_source = w;
+    count++;
+
+    if (++sources[w].next < sources[w].size) {
+
+      lt_replay (lt);
+
+    } else {
+
+      lt_retire (lt);
+
+    }
+
+  }
+
+  return count;
+
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+}
+
+void tearDown(void) {
+
+}
+
+
+void test_mezclar_secuencias_ordenadas_con_distintas_cantidades_de_fuentes_y_verificar_el_orden (void) {
+
+  for (uint32_t k = 1; k <= MAX_SOURCES; k++) {
+
+    _fill (k, SOURCE_SIZE);
+    _create (k);
+
+    TEST_ASSERT_EQUAL (k * SOURCE_SIZE, _drain ());
+
+  }
+
+}
+
+
+void test_verificar_que_los_registros_iguales_salen_por_numero_de_fuente (void) {
+
+  const uint32_t expected[] = { 0, 0, 1, 1, 2, 2, 3, 3, 4, 4 };
+
+  for (uint32_t s = 0; s < 5; s++) {
+
+    sources[s].keys[0] = 7;
+    sources[s].keys[1] = 7;
+    sources[s].size = 2;
+    sources[s].next = 0;
+
+  }
+
+  _create (5);
+
+  for (uint32_t i = 0; i < 10; i++) {
+
+    uint32_t w = lt_winner (lt);
+
+    TEST_ASSERT_EQUAL (expected[i], w);
+
+    if (++sources[w].next < sources[w].size) {
+
+      lt_replay (lt);
+
+    } else {
+
+      lt_retire (lt);
+
+    }
+
+  }
+
+  TEST_ASSERT_EQUAL (LT_NO_SOURCE, lt_winner (lt));
+
+}
+
+
+void test_verificar_que_cada_registro_cuesta_a_lo_sumo_ceil_log_2_k_comparaciones (void) {
+
+  const uint32_t k = 8;
+
+  _fill (k, SOURCE_SIZE);
+  _create (k);
+  lt->comparisons = 0;
+
+  // Mientras ninguna fuente se agota cada reemplazo juega exactamente log_2(8) partidos
+  for (uint32_t i = 0; i < SOURCE_SIZE; i++) {
+
+    uint32_t w = lt_winner (lt);
+
+    sources[w].next++;
+    lt_replay (lt);
+
+  }
+
+  TEST_ASSERT_EQUAL (3U * SOURCE_SIZE, lt->comparisons);
+
+}
+
+
+void test_mezclar_con_fuentes_vacias_desde_el_principio (void) {
+
+  _fill (6, 5);
+  sources[0].size = 0;
+  sources[3].size = 0;
+  sources[5].size = 0;
+
+  _create (6);
+  TEST_ASSERT_EQUAL (15U, _drain ());
+
+  _fill (3, 5);
+  sources[0].size = 0;
+  sources[1].size = 0;
+  sources[2].size = 0;
+
+  _create (3);
+  TEST_ASSERT_EQUAL (LT_NO_SOURCE, lt_winner (lt));
+
+}
+
+
+void test_validar_comportamiento_ante_nulos (void) {
+
+  TEST_ASSERT_NULL (lt_create (NULL, 4, _compare, sources));
+  TEST_ASSERT_NULL (lt_create (_memory_pool, 4, NULL, sources));
+  TEST_ASSERT_NULL (lt_create (_memory_pool, 0, _compare, sources));
+
+  TEST_ASSERT_EQUAL (LT_NO_SOURCE, lt_winner (NULL));
+  lt_build (NULL);
+  lt_replay (NULL);
+  lt_retire (NULL);
+  lt_mark_exhausted (NULL, 0);
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,229 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo de pairing heap
+ **
+ ** Pruebas a realizar:
+ ** - Crear un heap y verificar que inicia vacio
+ ** - Insertar elementos en un heap de minima y extraerlos de menor a mayor prioridad
+ ** - Insertar elementos con la misma prioridad y extraerlos en orden de insercion
+ ** - Fusionar dos heaps y verificar el orden de extraccion, incluidos los empates
+ ** - Fusionar un heap llenado antes que el destino y verificar que los empates siguen el orden
+ **   de insercion y no el de la fusion
+ ** - Extraer muchos elementos desordenados y verificar que salen ordenados
+ ** - Validar comportamiento ante nulos y tipos distintos
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "pairing_heap.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define ELEMENTS_NUMBER 64
+
+/* === Private data type declarations ========================================================== */
+
+typedef struct {
+  ph_node_t node;
+  uint8_t value;
+} job_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+static job_t jobs[ELEMENTS_NUMBER];
+static pairing_heap_t heap;
+static pairing_heap_t other;
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void _insert (pairing_heap_t* target, uint8_t value, uint16_t priority) {
+
+  jobs[value].value = value;
+  TEST_ASSERT_TRUE (ph_insert (target, &jobs[value].node, &jobs[value].value, priority));
+
+}
+
+static uint8_t _extract_value (pairing_heap_t* target) {
+
+  ph_node_t* node = ph_extract (target);
+  TEST_ASSERT_NOT_NULL (node);
+  return *(uint8_t*)node->item.data;
+
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+  TEST_ASSERT_TRUE (ph_init (&heap, PQ_MIN_PRIORITY_QUEUE));
+  TEST_ASSERT_TRUE (ph_init (&other, PQ_MIN_PRIORITY_QUEUE));
+
+}
+
+void tearDown(void) {
+
+}
+
+
+void test_crear_un_heap_y_verificar_que_inicia_vacio (void) {
+
+  TEST_ASSERT_TRUE (ph_is_empty (&heap));
+  TEST_ASSERT_EQUAL (0U, ph_size (&heap));
+  TEST_ASSERT_NULL (ph_peek (&heap));
+  TEST_ASSERT_NULL (ph_extract (&heap));
+
+}
+
+
+void test_insertar_elementos_en_un_heap_de_minima_y_extraerlos_de_menor_a_mayor_prioridad (void) {
+
+  _insert (&heap, 1, 50);
+  _insert (&heap, 2, 30);
+  _insert (&heap, 3, 65);
+  _insert (&heap, 4, 10);
+
+  TEST_ASSERT_EQUAL (4U, ph_size (&heap));
+  TEST_ASSERT_EQUAL (4, *(uint8_t*)ph_peek (&heap)->item.data);
+
+  TEST_ASSERT_EQUAL (4, _extract_value (&heap));
+  TEST_ASSERT_EQUAL (2, _extract_value (&heap));
+  TEST_ASSERT_EQUAL (1, _extract_value (&heap));
+  TEST_ASSERT_EQUAL (3, _extract_value (&heap));
+  TEST_ASSERT_TRUE (ph_is_empty (&heap));
+
+}
+
+
+void test_insertar_elementos_con_la_misma_prioridad_y_extraerlos_en_orden_de_insercion (void) {
+
+  for (uint8_t i = 0; i < 8; i++) {
+
+    _insert (&heap, i, 50);
+
+  }
+
+  for (uint8_t i = 0; i < 8; i++) {
+
+    TEST_ASSERT_EQUAL (i, _extract_value (&heap));
+
+  }
+
+}
+
+
+void test_fusionar_dos_heaps_y_verificar_el_orden_de_extraccion_incluidos_los_empates (void) {
+
+  _insert (&heap, 1, 20);
+  _insert (&other, 2, 20);
+  _insert (&heap, 3, 10);
+  _insert (&other, 4, 20);
+  _insert (&other, 5, 5);
+
+  TEST_ASSERT_TRUE (ph_merge (&heap, &other));
+  TEST_ASSERT_EQUAL (5U, ph_size (&heap));
+  TEST_ASSERT_TRUE (ph_is_empty (&other));
+
+  TEST_ASSERT_EQUAL (5, _extract_value (&heap));
+  TEST_ASSERT_EQUAL (3, _extract_value (&heap));
+  TEST_ASSERT_EQUAL (1, _extract_value (&heap));
+  TEST_ASSERT_EQUAL (2, _extract_value (&heap));
+  TEST_ASSERT_EQUAL (4, _extract_value (&heap));
+
+}
+
+
+void test_fusionar_un_heap_llenado_antes_que_el_destino_y_verificar_que_los_empates_siguen_el_orden_de_insercion (void) {
+
+  _insert (&other, 1, 20);
+  _insert (&other, 2, 20);
+  _insert (&heap, 3, 20);
+  _insert (&heap, 4, 20);
+
+  TEST_ASSERT_TRUE (ph_merge (&heap, &other));
+  _insert (&heap, 5, 20);
+
+  // A diferencia de pq_merge, los de other salen primero porque se insertaron antes
+  for (uint8_t value = 1; value <= 5; value++) {
+
+    TEST_ASSERT_EQUAL (value, _extract_value (&heap));
+
+  }
+
+}
+
+
+void test_extraer_muchos_elementos_desordenados_y_verificar_que_salen_ordenados (void) {
+
+  uint16_t previous = 0;
+
+  for (uint8_t i = 0; i < ELEMENTS_NUMBER; i++) {
+
+    _insert (&heap, i, (uint16_t)((i * 37U) % 101U));
+
+  }
+
+  for (uint8_t i = 0; i < ELEMENTS_NUMBER; i++) {
+
+    ph_node_t* node = ph_extract (&heap);
+    TEST_ASSERT_NOT_NULL (node);
+    TEST_ASSERT_TRUE (node->item.priority >= previous);
+    previous = node->item.priority;
+
+  }
+
+  TEST_ASSERT_TRUE (ph_is_empty (&heap));
+
+}
+
+
+void test_validar_comportamiento_ante_nulos_y_tipos_distintos (void) {
+
+  pairing_heap_t max_heap;
+
+  TEST_ASSERT_FALSE (ph_init (NULL, PQ_MIN_PRIORITY_QUEUE));
+  TEST_ASSERT_FALSE (ph_insert (NULL, &jobs[0].node, &jobs[0].value, 10));
+  TEST_ASSERT_FALSE (ph_insert (&heap, NULL, &jobs[0].value, 10));
+  TEST_ASSERT_FALSE (ph_insert (&heap, &jobs[0].node, NULL, 10));
+  TEST_ASSERT_NULL (ph_peek (NULL));
+  TEST_ASSERT_NULL (ph_extract (NULL));
+  TEST_ASSERT_TRUE (ph_is_empty (NULL));
+  TEST_ASSERT_EQUAL (0U, ph_size (NULL));
+
+  TEST_ASSERT_TRUE (ph_init (&max_heap, PQ_MAX_PRIORITY_QUEUE));
+  TEST_ASSERT_FALSE (ph_merge (&heap, &max_heap));
+  TEST_ASSERT_FALSE (ph_merge (&heap, &heap));
+  TEST_ASSERT_FALSE (ph_merge (NULL, &heap));
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
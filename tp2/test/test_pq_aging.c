@@ -0,0 +1,226 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo de envejecimiento de prioridades
+ **
+ ** Pruebas a realizar:
+ ** - Sin pasar epocas verificar que se extrae como una cola de prioridad comun
+ ** - Verificar que un elemento que espera adelanta a uno mas prioritario pero mas nuevo
+ ** - Con carga sostenida de elementos prioritarios verificar que el de baja prioridad no se posterga indefinidamente
+ ** - Pasar muchas epocas con elementos en espera y verificar que la renormalizacion mantiene el orden
+ ** - Verificar el envejecimiento en una cola de maxima prioridad
+ ** - Validar comportamiento ante nulos y cola llena
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "priority_queue.h"
+#include "pq_aging.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define ELEMENTS_NUMBER 8
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+static uint8_t _memory_pool [PQ_MEMORY_SIZE(ELEMENTS_NUMBER)];
+static pq_aging_t aq;
+static int values[ELEMENTS_NUMBER] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void _insert (unsigned value, uint16_t priority) {
+
+  TEST_ASSERT_TRUE (pq_aging_insert (&aq, &values[value], priority));
+
+}
+
+static void _assert_extract (unsigned value) {
+
+  TEST_ASSERT_EQUAL_PTR (&values[value], pq_aging_extract (&aq));
+
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+  TEST_ASSERT_TRUE (pq_aging_init (&aq, _memory_pool, ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE, 1));
+
+}
+
+void tearDown(void) {
+
+}
+
+
+void test_sin_pasar_epocas_verificar_que_se_extrae_como_una_cola_de_prioridad_comun (void) {
+
+  _insert (0, 30);
+  _insert (1, 10);
+  _insert (2, 20);
+  _insert (3, 10);
+
+  TEST_ASSERT_EQUAL_PTR (&values[1], pq_aging_peek (&aq));
+  _assert_extract (1);
+  _assert_extract (3);
+  _assert_extract (2);
+  _assert_extract (0);
+  TEST_ASSERT_NULL (pq_aging_extract (&aq));
+
+}
+
+
+void test_verificar_que_un_elemento_que_espera_adelanta_a_uno_mas_prioritario_pero_mas_nuevo (void) {
+
+  _insert (0, 100);
+
+  for (unsigned i = 0; i < 60; i++) {
+
+    pq_aging_tick (&aq);
+
+  }
+
+  // Efectivas: 100 - 60 = 40 para el viejo, 50 y 30 para los nuevos
+  _insert (1, 50);
+  _insert (2, 30);
+
+  _assert_extract (2);
+  _assert_extract (0);
+  _assert_extract (1);
+
+}
+
+
+void test_con_carga_sostenida_de_elementos_prioritarios_verificar_que_el_de_baja_prioridad_no_se_posterga_indefinidamente (void) {
+
+  unsigned epochs = 0;
+
+  TEST_ASSERT_TRUE (pq_aging_init (&aq, _memory_pool, ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE, 4));
+
+  _insert (0, UINT16_MAX);
+  _insert (1, 0);
+
+  // Cada epoca llega un elemento de maxima prioridad y se atiende uno
+  while (&values[0] != pq_aging_extract (&aq)) {
+
+    pq_aging_tick (&aq);
+    _insert (1, 0);
+    epochs++;
+
+  }
+
+  TEST_ASSERT_EQUAL ((UINT16_MAX + 3) / 4, epochs);
+
+}
+
+
+void test_pasar_muchas_epocas_con_elementos_en_espera_y_verificar_que_la_renormalizacion_mantiene_el_orden (void) {
+
+  unsigned next = 0;
+
+  // Cada vuelta: se inserta con prioridad decreciente, pasan 5000 epocas y se atiende uno
+  for (unsigned round = 0; round < 100; round++) {
+
+    _insert (round % ELEMENTS_NUMBER, (uint16_t)(1000 - round));
+
+    for (unsigned i = 0; i < 5000; i++) {
+
+      pq_aging_tick (&aq);
+
+    }
+
+    if (pq_aging_size (&aq) == ELEMENTS_NUMBER / 2) {
+
+      // Por antiguedad el primero en salir es siempre el mas viejo
+      _assert_extract (next % ELEMENTS_NUMBER);
+      next++;
+
+    }
+
+  }
+
+  TEST_ASSERT_TRUE (aq.shift > 0);
+  TEST_ASSERT_EQUAL (ELEMENTS_NUMBER / 2 - 1, pq_aging_size (&aq));
+
+}
+
+
+void test_verificar_el_envejecimiento_en_una_cola_de_maxima_prioridad (void) {
+
+  TEST_ASSERT_TRUE (pq_aging_init (&aq, _memory_pool, ELEMENTS_NUMBER, PQ_MAX_PRIORITY_QUEUE, 2));
+
+  _insert (0, 100);
+
+  for (unsigned i = 0; i < 101; i++) {
+
+    pq_aging_tick (&aq);
+
+  }
+
+  // Efectivas: 100 + 2 * 101 = 302 para el viejo, 300 y 400 para los nuevos
+  _insert (1, 300);
+  _insert (2, 400);
+  _assert_extract (2);
+  _assert_extract (0);
+  _assert_extract (1);
+
+}
+
+
+void test_validar_comportamiento_ante_nulos_y_cola_llena (void) {
+
+  TEST_ASSERT_FALSE (pq_aging_init (NULL, _memory_pool, ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE, 1));
+  TEST_ASSERT_FALSE (pq_aging_init (&aq, NULL, ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE, 1));
+  TEST_ASSERT_FALSE (pq_aging_init (&aq, _memory_pool, ELEMENTS_NUMBER, (pq_type_t)5, 1));
+  TEST_ASSERT_TRUE (pq_aging_init (&aq, _memory_pool, ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE, 1));
+
+  TEST_ASSERT_FALSE (pq_aging_insert (NULL, &values[0], 1));
+  TEST_ASSERT_NULL (pq_aging_peek (NULL));
+  TEST_ASSERT_NULL (pq_aging_extract (NULL));
+  TEST_ASSERT_EQUAL (0U, pq_aging_size (NULL));
+  pq_aging_tick (NULL);
+
+  for (unsigned i = 0; i < ELEMENTS_NUMBER; i++) {
+
+    _insert (i, 1);
+
+  }
+
+  TEST_ASSERT_FALSE (pq_aging_insert (&aq, &values[0], 1));
+  TEST_ASSERT_EQUAL (ELEMENTS_NUMBER, pq_aging_size (&aq));
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
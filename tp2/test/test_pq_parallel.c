@@ -0,0 +1,271 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo de operaciones en bloque en paralelo
+ **
+ ** Pruebas a realizar:
+ ** - Insertar en bloque con varios hilos y obtener el mismo arreglo que la version secuencial
+ ** - Insertar en bloque en una cola con elementos marcados que hay que compactar
+ ** - Eliminar por predicado con varios hilos y obtener el mismo arreglo que la version secuencial
+ ** - Exportar ordenado con varios hilos, con elementos marcados, igual que la version secuencial
+ ** - Validar comportamiento ante nulos y colas pequenas
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "priority_queue.h"
+#include "pq_parallel.h"
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+// Suficientes nodos para repartir el trabajo entre varios hilos (ver PQ_PARALLEL_GRAIN)
+#define ELEMENTS_NUMBER   (12 * PQ_PARALLEL_GRAIN + 123)
+#define PRIORITY_RANGE    64 // Muchos empates, para que cuente el orden de insercion
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+static uint8_t _sequential_memory_pool [PQ_MEMORY_SIZE(ELEMENTS_NUMBER)];
+static uint8_t _parallel_memory_pool [PQ_MEMORY_SIZE(ELEMENTS_NUMBER)];
+static void* _payloads [ELEMENTS_NUMBER];
+static uint16_t _priorities [ELEMENTS_NUMBER];
+static pq_node_t _expected [ELEMENTS_NUMBER];
+static pq_node_t _out [ELEMENTS_NUMBER];
+static pq_node_t _scratch [ELEMENTS_NUMBER];
+static const size_t _thread_counts[] = { 1, 2, 3, 4, 7, 0 };
+priority_queue_t* sequential = NULL;
+priority_queue_t* parallel = NULL;
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void _fill_input (void) {
+
+  uint32_t state = 2463534242U;
+
+  for (size_t i = 0; i < ELEMENTS_NUMBER; i++) {
+
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+
+    _payloads[i] = (void*)(uintptr_t)(i + 1);
+    _priorities[i] = (uint16_t)(state % PRIORITY_RANGE);
+
+  }
+
+}
+
+static void _create_both (pq_type_t type) {
+
+  sequential = pq_create (_sequential_memory_pool, ELEMENTS_NUMBER, type);
+  parallel = pq_create (_parallel_memory_pool, ELEMENTS_NUMBER, type);
+  TEST_ASSERT_NOT_NULL (sequential);
+  TEST_ASSERT_NOT_NULL (parallel);
+
+}
+
+static void _assert_same_queue (void) {
+
+  TEST_ASSERT_EQUAL (sequential->size, parallel->size);
+  TEST_ASSERT_EQUAL (sequential->tombstones, parallel->tombstones);
+  TEST_ASSERT_EQUAL (sequential->next_insertion_index, parallel->next_insertion_index);
+  TEST_ASSERT_EQUAL_MEMORY (sequential->nodes, parallel->nodes, sequential->size * sizeof(pq_node_t));
+
+}
+
+static bool _is_multiple (const pq_node_t* node, void* ctx) {
+
+  return (node->id % *(uintptr_t*)ctx) == 0;
+
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+  _fill_input ();
+
+}
+
+void tearDown(void) {
+
+}
+
+
+void test_insertar_en_bloque_con_varios_hilos_y_obtener_el_mismo_arreglo_que_la_version_secuencial (void) {
+
+  const pq_type_t types[] = { PQ_MIN_PRIORITY_QUEUE, PQ_MAX_PRIORITY_QUEUE };
+
+  for (size_t t = 0; t < 2; t++) {
+
+    for (size_t i = 0; i < sizeof(_thread_counts) / sizeof(_thread_counts[0]); i++) {
+
+      _create_both (types[t]);
+
+      // Una parte ya en la cola, para que el bloque empate con elementos previos
+      TEST_ASSERT_TRUE (pq_insert_bulk (sequential, _payloads, _priorities, 1000));
+      TEST_ASSERT_TRUE (pq_insert_bulk (parallel, _payloads, _priorities, 1000));
+
+      TEST_ASSERT_TRUE (pq_insert_bulk (sequential, &_payloads[1000], &_priorities[1000],
+                                        ELEMENTS_NUMBER - 1000));
+      TEST_ASSERT_TRUE (pq_parallel_insert_bulk (parallel, &_payloads[1000], &_priorities[1000],
+                                                 ELEMENTS_NUMBER - 1000, _thread_counts[i]));
+
+      _assert_same_queue ();
+
+    }
+
+  }
+
+}
+
+
+void test_insertar_en_bloque_en_una_cola_con_elementos_marcados_que_hay_que_compactar (void) {
+
+  uintptr_t divisor = 3;
+  size_t removed = 0;
+  size_t incoming = 0;
+
+  _create_both (PQ_MIN_PRIORITY_QUEUE);
+  TEST_ASSERT_TRUE (pq_insert_bulk (sequential, _payloads, _priorities, ELEMENTS_NUMBER));
+  TEST_ASSERT_TRUE (pq_insert_bulk (parallel, _payloads, _priorities, ELEMENTS_NUMBER));
+
+  removed = pq_remove_if_lazy (sequential, _is_multiple, &divisor);
+  TEST_ASSERT_EQUAL (removed, pq_remove_if_lazy (parallel, _is_multiple, &divisor));
+  TEST_ASSERT_TRUE (sequential->tombstones > 0);
+  _assert_same_queue ();
+
+  // Llena la cola: solo cabe si se reclaman los huecos marcados
+  incoming = removed;
+  TEST_ASSERT_TRUE (pq_insert_bulk (sequential, _payloads, _priorities, incoming));
+  TEST_ASSERT_TRUE (pq_parallel_insert_bulk (parallel, _payloads, _priorities, incoming, 4));
+
+  _assert_same_queue ();
+  TEST_ASSERT_EQUAL (0U, parallel->tombstones);
+  TEST_ASSERT_EQUAL (ELEMENTS_NUMBER, pq_size (parallel));
+
+  TEST_ASSERT_FALSE (pq_parallel_insert_bulk (parallel, _payloads, _priorities, 1, 4));
+
+}
+
+
+void test_eliminar_por_predicado_con_varios_hilos_y_obtener_el_mismo_arreglo_que_la_version_secuencial (void) {
+
+  uintptr_t lazy_divisor = 5;
+  uintptr_t divisor = 2;
+
+  for (size_t i = 0; i < sizeof(_thread_counts) / sizeof(_thread_counts[0]); i++) {
+
+    _create_both (PQ_MAX_PRIORITY_QUEUE);
+    TEST_ASSERT_TRUE (pq_insert_bulk (sequential, _payloads, _priorities, ELEMENTS_NUMBER));
+    TEST_ASSERT_TRUE (pq_insert_bulk (parallel, _payloads, _priorities, ELEMENTS_NUMBER));
+
+    // Con elementos marcados, que se descartan sin pasar por el predicado
+    pq_remove_if_lazy (sequential, _is_multiple, &lazy_divisor);
+    pq_remove_if_lazy (parallel, _is_multiple, &lazy_divisor);
+
+    TEST_ASSERT_EQUAL (pq_remove_if (sequential, _is_multiple, &divisor),
+                       pq_parallel_remove_if (parallel, _is_multiple, &divisor, _thread_counts[i]));
+
+    _assert_same_queue ();
+
+  }
+
+}
+
+
+void test_exportar_ordenado_con_varios_hilos_con_elementos_marcados_igual_que_la_version_secuencial (void) {
+
+  uintptr_t divisor = 7;
+  size_t exported = 0;
+
+  _create_both (PQ_MIN_PRIORITY_QUEUE);
+  TEST_ASSERT_TRUE (pq_insert_bulk (sequential, _payloads, _priorities, ELEMENTS_NUMBER));
+
+  exported = pq_export_sorted (sequential, _expected);
+  TEST_ASSERT_EQUAL (ELEMENTS_NUMBER, exported);
+
+  for (size_t i = 0; i < sizeof(_thread_counts) / sizeof(_thread_counts[0]); i++) {
+
+    memset (_out, 0, sizeof(_out));
+    TEST_ASSERT_EQUAL (exported, pq_parallel_export_sorted (sequential, _out, _scratch,
+                                                             _thread_counts[i]));
+    TEST_ASSERT_EQUAL_MEMORY (_expected, _out, exported * sizeof(pq_node_t));
+
+  }
+
+  pq_remove_if_lazy (sequential, _is_multiple, &divisor);
+  TEST_ASSERT_TRUE (sequential->tombstones > 0);
+  exported = pq_export_sorted (sequential, _expected);
+  TEST_ASSERT_EQUAL (pq_size (sequential), exported);
+
+  for (size_t i = 0; i < sizeof(_thread_counts) / sizeof(_thread_counts[0]); i++) {
+
+    TEST_ASSERT_EQUAL (exported, pq_parallel_export_sorted (sequential, _out, _scratch,
+                                                             _thread_counts[i]));
+    TEST_ASSERT_EQUAL_MEMORY (_expected, _out, exported * sizeof(pq_node_t));
+
+  }
+
+}
+
+
+void test_validar_comportamiento_ante_nulos_y_colas_pequenas (void) {
+
+  uintptr_t divisor = 2;
+
+  _create_both (PQ_MIN_PRIORITY_QUEUE);
+
+  TEST_ASSERT_FALSE (pq_parallel_insert_bulk (NULL, _payloads, _priorities, 1, 4));
+  TEST_ASSERT_FALSE (pq_parallel_insert_bulk (parallel, NULL, _priorities, 1, 4));
+  TEST_ASSERT_FALSE (pq_parallel_insert_bulk (parallel, _payloads, NULL, 1, 4));
+  TEST_ASSERT_EQUAL (0U, pq_parallel_remove_if (NULL, _is_multiple, &divisor, 4));
+  TEST_ASSERT_EQUAL (0U, pq_parallel_remove_if (parallel, NULL, &divisor, 4));
+  TEST_ASSERT_EQUAL (0U, pq_parallel_export_sorted (parallel, _out, NULL, 4));
+  TEST_ASSERT_EQUAL (0U, pq_parallel_export_sorted (NULL, _out, _scratch, 4));
+
+  _payloads[5] = NULL;
+  TEST_ASSERT_FALSE (pq_parallel_insert_bulk (parallel, _payloads, _priorities, 10, 4));
+  TEST_ASSERT_TRUE (pq_is_empty (parallel));
+
+  // Una cola pequena se procesa en el hilo llamante y da el mismo resultado
+  TEST_ASSERT_TRUE (pq_insert_bulk (sequential, _payloads, _priorities, 5));
+  TEST_ASSERT_TRUE (pq_parallel_insert_bulk (parallel, _payloads, _priorities, 5, 64));
+  _assert_same_queue ();
+  TEST_ASSERT_EQUAL (5U, pq_parallel_export_sorted (parallel, _out, _scratch, 64));
+  TEST_ASSERT_EQUAL (pq_extract (sequential), _out[0].data);
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
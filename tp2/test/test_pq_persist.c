@@ -0,0 +1,343 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo de cola de prioridad persistente
+ **
+ ** Pruebas a realizar:
+ ** - Crear una cola persistente, cerrarla, reabrirla y extraer los elementos en orden
+ ** - Reabrir el fichero con otra capacidad u otro tipo y verificar que falla
+ ** - Interrumpir una insercion antes de mover nodos y verificar que se completa al reabrir
+ ** - Interrumpir una insercion a mitad de camino y verificar que se completa al reabrir
+ ** - Interrumpir una extraccion a mitad de camino y verificar que se completa al reabrir
+ ** - Validar comportamiento ante nulos, identificadores invalidos y manejadores cerrados
+ ** - Crear el fichero si no existe sin dejar el fichero temporal
+ ** - Reabrir un fichero con el largo correcto y el numero magico en cero y verificar que se reinicia
+ ** - Reabrir un fichero con la cola o el diario corruptos y verificar que falla
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "priority_queue.h"
+#include "pq_persist.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define ELEMENTS_NUMBER 16
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+static char path[] = "/tmp/test_pq_persist_XXXXXX";
+pq_persist_t persist;
+priority_queue_t* pq = NULL;
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static pq_persist_header_t* _header (void) {
+
+  return persist.header;
+
+}
+
+static void _reopen (void) {
+
+  pq_persist_close (&persist);
+  TEST_ASSERT_TRUE (pq_persist_open (&persist, path, ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE));
+  pq = persist.pq;
+
+}
+
+// Cierra el fichero corrupto, verifica que no se puede abrir y deja uno nuevo con un elemento
+static void _assert_reopen_fails (void) {
+
+  pq_persist_close (&persist);
+  TEST_ASSERT_FALSE (pq_persist_open (&persist, path, ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE));
+
+  unlink (path);
+  _reopen ();
+  TEST_ASSERT_TRUE (pq_persist_insert (&persist, 1, 10));
+
+}
+
+static void _insert_all (const uint16_t* priorities, size_t count) {
+
+  for (size_t i = 0; i < count; i++) {
+
+    TEST_ASSERT_TRUE (pq_persist_insert (&persist, i + 1, priorities[i]));
+
+  }
+
+}
+
+static void _assert_extracts (const pq_id_t* expected, size_t count) {
+
+  pq_id_t id = PQ_PERSIST_NO_ID;
+
+  for (size_t i = 0; i < count; i++) {
+
+    TEST_ASSERT_TRUE (pq_persist_extract (&persist, &id));
+    TEST_ASSERT_EQUAL (expected[i], id);
+
+  }
+
+  TEST_ASSERT_TRUE (pq_is_empty (pq));
+
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+  strcpy (path, "/tmp/test_pq_persist_XXXXXX");
+  close (mkstemp (path));
+
+  TEST_ASSERT_TRUE (pq_persist_open (&persist, path, ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE));
+  pq = persist.pq;
+
+}
+
+void tearDown(void) {
+
+  pq_persist_close (&persist);
+  unlink (path);
+
+}
+
+
+void test_crear_una_cola_persistente_cerrarla_reabrirla_y_extraer_los_elementos_en_orden (void) {
+
+  const uint16_t priorities[] = { 50, 30, 65, 10, 30 };
+  const pq_id_t expected[] = { 4, 2, 5, 1, 3 };
+  pq_id_t id = PQ_PERSIST_NO_ID;
+
+  _insert_all (priorities, 5);
+  TEST_ASSERT_TRUE (pq_persist_sync (&persist));
+
+  _reopen ();
+  TEST_ASSERT_TRUE (pq_persist_verify (&persist));
+  TEST_ASSERT_EQUAL (5U, pq_size (pq));
+  TEST_ASSERT_EQUAL (5U, pq->next_insertion_index);
+
+  TEST_ASSERT_TRUE (pq_persist_peek (&persist, &id));
+  TEST_ASSERT_EQUAL (4, id);
+
+  _assert_extracts (expected, 5);
+
+}
+
+
+void test_reabrir_el_fichero_con_otra_capacidad_u_otro_tipo_y_verificar_que_falla (void) {
+
+  TEST_ASSERT_TRUE (pq_persist_insert (&persist, 1, 10));
+  pq_persist_close (&persist);
+
+  TEST_ASSERT_FALSE (pq_persist_open (&persist, path, ELEMENTS_NUMBER + 1, PQ_MIN_PRIORITY_QUEUE));
+  TEST_ASSERT_FALSE (pq_persist_open (&persist, path, ELEMENTS_NUMBER, PQ_MAX_PRIORITY_QUEUE));
+
+  TEST_ASSERT_TRUE (pq_persist_open (&persist, path, ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE));
+  pq = persist.pq;
+  TEST_ASSERT_EQUAL (1U, pq_size (pq));
+
+}
+
+
+void test_interrumpir_una_insercion_antes_de_mover_nodos_y_verificar_que_se_completa_al_reabrir (void) {
+
+  const uint16_t priorities[] = { 10, 20, 30 };
+  const pq_id_t expected[] = { 4, 1, 2, 3 };
+  pq_persist_header_t* header = _header ();
+
+  _insert_all (priorities, 3);
+
+  // Estado tras escribir el nodo en el hueco nuevo y marcar la insercion
+  header->pending.priority = 5;
+  header->pending.insertion_index = pq->next_insertion_index;
+  header->pending.id = 4;
+  header->target_size = pq->size + 1;
+  pq->nodes[pq->size] = header->pending;
+  header->state = PQ_PERSIST_INSERTING;
+
+  _reopen ();
+  TEST_ASSERT_TRUE (pq_persist_verify (&persist));
+  TEST_ASSERT_EQUAL (4U, pq_size (pq));
+
+  _assert_extracts (expected, 4);
+
+}
+
+
+void test_interrumpir_una_insercion_a_mitad_de_camino_y_verificar_que_se_completa_al_reabrir (void) {
+
+  const uint16_t priorities[] = { 10, 20, 30, 40, 50, 60, 70 };
+  const pq_id_t expected[] = { 8, 1, 2, 3, 4, 5, 6, 7 };
+  pq_persist_header_t* header = _header ();
+
+  _insert_all (priorities, 7);
+
+  // El nodo nuevo (hueco 7) sube: el padre 3 ya se copio al hueco 7 y el padre 1 al hueco 3
+  header->pending.priority = 1;
+  header->pending.insertion_index = pq->next_insertion_index;
+  header->pending.id = 8;
+  header->target_size = pq->size + 1;
+  header->state = PQ_PERSIST_INSERTING;
+  pq->nodes[7] = pq->nodes[3];
+  pq->nodes[3] = pq->nodes[1];
+
+  _reopen ();
+  TEST_ASSERT_TRUE (pq_persist_verify (&persist));
+  TEST_ASSERT_EQUAL (8U, pq_size (pq));
+
+  _assert_extracts (expected, 8);
+
+}
+
+
+void test_interrumpir_una_extraccion_a_mitad_de_camino_y_verificar_que_se_completa_al_reabrir (void) {
+
+  const uint16_t priorities[] = { 10, 20, 30, 40, 50, 60, 70 };
+  const pq_id_t expected[] = { 2, 3, 4, 5, 6, 7 };
+  pq_persist_header_t* header = _header ();
+
+  _insert_all (priorities, 7);
+
+  // Se extrae la raiz: el hijo 1 ya subio a la raiz y el hueco quedo en el nodo 1
+  header->pending = pq->nodes[6];
+  header->target_size = 6;
+  header->state = PQ_PERSIST_EXTRACTING;
+  pq->nodes[0] = pq->nodes[1];
+
+  _reopen ();
+  TEST_ASSERT_TRUE (pq_persist_verify (&persist));
+  TEST_ASSERT_EQUAL (6U, pq_size (pq));
+
+  _assert_extracts (expected, 6);
+
+}
+
+
+void test_validar_comportamiento_ante_nulos_identificadores_invalidos_y_manejadores_cerrados (void) {
+
+  pq_id_t id = PQ_PERSIST_NO_ID;
+
+  TEST_ASSERT_FALSE (pq_persist_open (&persist, NULL, ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE));
+  TEST_ASSERT_FALSE (pq_persist_open (&persist, path, 0, PQ_MIN_PRIORITY_QUEUE));
+
+  TEST_ASSERT_FALSE (pq_persist_insert (NULL, 1, 10));
+  TEST_ASSERT_FALSE (pq_persist_insert (&persist, PQ_PERSIST_NO_ID, 10));
+  TEST_ASSERT_FALSE (pq_persist_peek (&persist, &id));
+  TEST_ASSERT_FALSE (pq_persist_extract (&persist, &id));
+  TEST_ASSERT_FALSE (pq_persist_extract (NULL, &id));
+  TEST_ASSERT_FALSE (pq_persist_sync (NULL));
+
+  TEST_ASSERT_TRUE (pq_persist_insert (&persist, 1, 10));
+  TEST_ASSERT_FALSE (pq_persist_extract (&persist, NULL));
+  TEST_ASSERT_EQUAL (1U, pq_size (pq));
+
+  pq_persist_close (&persist);
+  TEST_ASSERT_NULL (persist.header);
+  TEST_ASSERT_FALSE (pq_persist_insert (&persist, 2, 10));
+  TEST_ASSERT_FALSE (pq_persist_peek (&persist, &id));
+  TEST_ASSERT_FALSE (pq_persist_verify (&persist));
+
+}
+
+
+void test_crear_el_fichero_si_no_existe_sin_dejar_el_fichero_temporal (void) {
+
+  char temp[sizeof(path) + sizeof(".tmp")];
+  struct stat info;
+
+  pq_persist_close (&persist);
+  unlink (path);
+
+  TEST_ASSERT_TRUE (pq_persist_open (&persist, path, ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE));
+  pq = persist.pq;
+  TEST_ASSERT_TRUE (pq_persist_verify (&persist));
+
+  TEST_ASSERT_EQUAL (0, stat (path, &info));
+  TEST_ASSERT_EQUAL (PQ_PERSIST_FILE_SIZE(ELEMENTS_NUMBER), (size_t)info.st_size);
+  sprintf (temp, "%s.tmp", path);
+  TEST_ASSERT_NOT_EQUAL (0, stat (temp, &info));
+
+}
+
+
+void test_reabrir_un_fichero_con_el_numero_magico_en_cero_y_verificar_que_se_reinicia (void) {
+
+  TEST_ASSERT_TRUE (pq_persist_insert (&persist, 1, 10));
+
+  // Estado de un fichero creado hasta el tamano final pero sin completar la cabecera
+  _header ()->magic = 0;
+  pq_persist_close (&persist);
+
+  TEST_ASSERT_TRUE (pq_persist_open (&persist, path, ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE));
+  pq = persist.pq;
+  TEST_ASSERT_TRUE (pq_persist_verify (&persist));
+  TEST_ASSERT_TRUE (pq_is_empty (pq));
+
+}
+
+void test_reabrir_un_fichero_con_la_cola_o_el_diario_corruptos_y_verificar_que_falla (void) {
+
+  TEST_ASSERT_TRUE (pq_persist_insert (&persist, 1, 10));
+
+  pq->capacity = ELEMENTS_NUMBER + 1;
+  _assert_reopen_fails ();
+
+  pq->type = PQ_MAX_PRIORITY_QUEUE;
+  _assert_reopen_fails ();
+
+  pq->size = ELEMENTS_NUMBER + 1;
+  _assert_reopen_fails ();
+
+  _header ()->state = PQ_PERSIST_EXTRACTING + 1;
+  _assert_reopen_fails ();
+
+  // Una insercion que deja la cola vacia
+  _header ()->state = PQ_PERSIST_INSERTING;
+  _header ()->target_size = 0;
+  _assert_reopen_fails ();
+
+  // Una extraccion desde una cola mas grande que la capacidad
+  _header ()->state = PQ_PERSIST_EXTRACTING;
+  _header ()->target_size = ELEMENTS_NUMBER;
+  _assert_reopen_fails ();
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,265 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo de instantaneas de cola de prioridad
+ **
+ ** Pruebas a realizar:
+ ** - Tomar una instantanea en un buffer, restaurarla en otro pool y extraer en el mismo orden
+ ** - Tomar una instantanea en un fichero, restaurarla y extraer en el mismo orden
+ ** - Verificar que tomar una instantanea no modifica la cola
+ ** - Rechazar buffers pequenos, cabeceras corruptas y capacidades insuficientes
+ ** - Tomar y restaurar una instantanea en un buffer sin alinear
+ ** - Rechazar nodos que rompen el orden del monticulo o no coinciden con las lapidas
+ ** - Validar comportamiento ante nulos
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "priority_queue.h"
+#include "pq_snapshot.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define ELEMENTS_NUMBER 10
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+static uint8_t _pq_memory_pool [PQ_MEMORY_SIZE(ELEMENTS_NUMBER)];
+static uint8_t _restored_memory_pool [PQ_MEMORY_SIZE(ELEMENTS_NUMBER)];
+static uint8_t _snapshot_buffer [PQ_SNAPSHOT_SIZE(ELEMENTS_NUMBER) + 1];
+priority_queue_t* pq = NULL;
+
+/* === Private variable definitions ============================================================ */
+
+static const uint16_t priorities[] = { 50, 30, 65, 10, 30, 65 };
+static const pq_id_t expected[] = { 3, 6, 1, 2, 5, 4 };
+
+/* === Private function implementation ========================================================= */
+
+static void _assert_extracts (priority_queue_t* queue) {
+
+  for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); i++) {
+
+    TEST_ASSERT_EQUAL (expected[i], (pq_id_t)pq_extract (queue));
+
+  }
+
+  TEST_ASSERT_TRUE (pq_is_empty (queue));
+
+}
+
+// The buffer has no alignment guarantee, so the header and nodes are copied in and out
+static pq_snapshot_header_t _get_header (void) {
+
+  pq_snapshot_header_t header;
+
+  memcpy (&header, _snapshot_buffer, sizeof(header));
+  return header;
+
+}
+
+static void _set_header (const pq_snapshot_header_t* header) {
+
+  memcpy (_snapshot_buffer, header, sizeof(*header));
+
+}
+
+static pq_node_t _get_node (size_t index) {
+
+  pq_node_t node;
+
+  memcpy (&node, _snapshot_buffer + sizeof(pq_snapshot_header_t) + index * sizeof(node), sizeof(node));
+  return node;
+
+}
+
+static void _set_node (size_t index, const pq_node_t* node) {
+
+  memcpy (_snapshot_buffer + sizeof(pq_snapshot_header_t) + index * sizeof(*node), node, sizeof(*node));
+
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+  pq = pq_create (_pq_memory_pool, ELEMENTS_NUMBER, PQ_MAX_PRIORITY_QUEUE);
+  TEST_ASSERT_NOT_NULL (pq);
+
+  for (size_t i = 0; i < sizeof(priorities) / sizeof(priorities[0]); i++) {
+
+    TEST_ASSERT_TRUE (pq_insert (pq, (void*)(pq_id_t)(i + 1), priorities[i]));
+
+  }
+
+}
+
+void tearDown(void) {
+
+}
+
+
+void test_tomar_una_instantanea_en_un_buffer_restaurarla_en_otro_pool_y_extraer_en_el_mismo_orden (void) {
+
+  size_t written = pq_snapshot (pq, _snapshot_buffer, sizeof(_snapshot_buffer));
+  TEST_ASSERT_EQUAL (PQ_SNAPSHOT_SIZE(6), written);
+  TEST_ASSERT_EQUAL (written, pq_snapshot_size (pq));
+
+  priority_queue_t* restored = pq_restore (_restored_memory_pool, ELEMENTS_NUMBER,
+                                           _snapshot_buffer, written);
+  TEST_ASSERT_NOT_NULL (restored);
+  TEST_ASSERT_EQUAL (PQ_MAX_PRIORITY_QUEUE, restored->type);
+  TEST_ASSERT_EQUAL (6U, pq_size (restored));
+  TEST_ASSERT_EQUAL (pq->next_insertion_index, restored->next_insertion_index);
+
+  _assert_extracts (restored);
+
+}
+
+
+void test_tomar_una_instantanea_en_un_fichero_restaurarla_y_extraer_en_el_mismo_orden (void) {
+
+  char path[] = "/tmp/test_pq_snapshot_XXXXXX";
+  int fd = mkstemp (path);
+  TEST_ASSERT_TRUE (fd >= 0);
+  unlink (path);
+
+  TEST_ASSERT_TRUE (pq_snapshot_fd (pq, fd));
+  TEST_ASSERT_EQUAL (0, lseek (fd, 0, SEEK_SET));
+
+  priority_queue_t* restored = pq_restore_fd (_restored_memory_pool, ELEMENTS_NUMBER, fd);
+  close (fd);
+
+  TEST_ASSERT_NOT_NULL (restored);
+  _assert_extracts (restored);
+
+}
+
+
+void test_verificar_que_tomar_una_instantanea_no_modifica_la_cola (void) {
+
+  TEST_ASSERT_NOT_EQUAL (0U, pq_snapshot (pq, _snapshot_buffer, sizeof(_snapshot_buffer)));
+  TEST_ASSERT_EQUAL (6U, pq_size (pq));
+
+  _assert_extracts (pq);
+
+}
+
+
+void test_rechazar_buffers_pequenos_cabeceras_corruptas_y_capacidades_insuficientes (void) {
+
+  size_t needed = pq_snapshot_size (pq);
+
+  TEST_ASSERT_EQUAL (0U, pq_snapshot (pq, _snapshot_buffer, needed - 1));
+  TEST_ASSERT_EQUAL (needed, pq_snapshot (pq, _snapshot_buffer, needed));
+
+  TEST_ASSERT_NULL (pq_restore (_restored_memory_pool, 5, _snapshot_buffer, needed));
+  TEST_ASSERT_NULL (pq_restore (_restored_memory_pool, ELEMENTS_NUMBER, _snapshot_buffer, needed - 1));
+
+  pq_snapshot_header_t header = _get_header ();
+  header.version++;
+  _set_header (&header);
+  TEST_ASSERT_NULL (pq_restore (_restored_memory_pool, ELEMENTS_NUMBER, _snapshot_buffer, needed));
+
+  header.version--;
+  header.magic = 0;
+  _set_header (&header);
+  TEST_ASSERT_NULL (pq_restore (_restored_memory_pool, ELEMENTS_NUMBER, _snapshot_buffer, needed));
+
+}
+
+
+void test_tomar_y_restaurar_una_instantanea_en_un_buffer_sin_alinear (void) {
+
+  uint8_t* unaligned = _snapshot_buffer + 1;
+  size_t written = pq_snapshot (pq, unaligned, PQ_SNAPSHOT_SIZE(ELEMENTS_NUMBER));
+
+  TEST_ASSERT_EQUAL (PQ_SNAPSHOT_SIZE(6), written);
+
+  priority_queue_t* restored = pq_restore (_restored_memory_pool, ELEMENTS_NUMBER,
+                                           unaligned, written);
+  TEST_ASSERT_NOT_NULL (restored);
+  _assert_extracts (restored);
+
+}
+
+
+void test_rechazar_nodos_que_rompen_el_orden_del_monticulo_o_no_coinciden_con_las_lapidas (void) {
+
+  size_t needed = pq_snapshot (pq, _snapshot_buffer, sizeof(_snapshot_buffer));
+  pq_snapshot_header_t header = _get_header ();
+  pq_node_t root = _get_node (0);
+  pq_node_t leaf = _get_node (5);
+
+  // Una hoja con mas prioridad que la raiz en una cola de maxima
+  pq_node_t raised = leaf;
+  raised.priority = root.priority + 1;
+  _set_node (5, &raised);
+  TEST_ASSERT_NULL (pq_restore (_restored_memory_pool, ELEMENTS_NUMBER, _snapshot_buffer, needed));
+
+  // Una lapida (dato NULL) que la cabecera no cuenta
+  pq_node_t tombstone = leaf;
+  tombstone.data = NULL;
+  _set_node (5, &tombstone);
+  TEST_ASSERT_NULL (pq_restore (_restored_memory_pool, ELEMENTS_NUMBER, _snapshot_buffer, needed));
+
+  // Con la lapida contada la instantanea es valida
+  header.tombstones = 1;
+  _set_header (&header);
+  TEST_ASSERT_NOT_NULL (pq_restore (_restored_memory_pool, ELEMENTS_NUMBER, _snapshot_buffer, needed));
+
+  // Una lapida contada que no esta en los nodos
+  _set_node (5, &leaf);
+  TEST_ASSERT_NULL (pq_restore (_restored_memory_pool, ELEMENTS_NUMBER, _snapshot_buffer, needed));
+
+}
+
+
+void test_validar_comportamiento_ante_nulos (void) {
+
+  TEST_ASSERT_EQUAL (0U, pq_snapshot_size (NULL));
+  TEST_ASSERT_EQUAL (0U, pq_snapshot (NULL, _snapshot_buffer, sizeof(_snapshot_buffer)));
+  TEST_ASSERT_EQUAL (0U, pq_snapshot (pq, NULL, sizeof(_snapshot_buffer)));
+  TEST_ASSERT_FALSE (pq_snapshot_fd (NULL, 1));
+  TEST_ASSERT_FALSE (pq_snapshot_fd (pq, -1));
+
+  TEST_ASSERT_NULL (pq_restore (NULL, ELEMENTS_NUMBER, _snapshot_buffer, sizeof(_snapshot_buffer)));
+  TEST_ASSERT_NULL (pq_restore (_restored_memory_pool, ELEMENTS_NUMBER, NULL, sizeof(_snapshot_buffer)));
+  TEST_ASSERT_NULL (pq_restore_fd (NULL, ELEMENTS_NUMBER, 0));
+  TEST_ASSERT_NULL (pq_restore_fd (_restored_memory_pool, ELEMENTS_NUMBER, -1));
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,258 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo de trazas de cola de prioridad
+ **
+ ** Se compila con PQ_TRACE (ver project.yml), para que la cola llame a los ganchos.
+ **
+ ** Pruebas a realizar:
+ ** - Grabar creacion, inserciones, consultas y extracciones con su prioridad y tamano
+ ** - Identificar varias colas, incluida una que ya existia, y grabar una fusion con su origen
+ ** - Sobrescribir los registros mas antiguos al llenarse el anillo y guardarlos en orden
+ ** - Guardar la traza en un fichero, abrirla y rechazar ficheros corruptos
+ ** - No grabar nada antes de iniciar ni despues de detener
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "priority_queue.h"
+#include "pq_trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define ELEMENTS_NUMBER   8
+#define RING_SIZE         32
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+static uint8_t _pq_memory_pool [PQ_MEMORY_SIZE(ELEMENTS_NUMBER)];
+static uint8_t _src_memory_pool [PQ_MEMORY_SIZE(ELEMENTS_NUMBER)];
+static pq_trace_record_t _ring [RING_SIZE];
+static char path[] = "/tmp/test_pq_trace_XXXXXX";
+static uint8_t value = 1;
+priority_queue_t* pq = NULL;
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void _assert_record (const pq_trace_record_t* record, pq_trace_op_t op, uint8_t queue,
+                            uint16_t value, uint32_t size) {
+
+  TEST_ASSERT_EQUAL (op, record->op);
+  TEST_ASSERT_EQUAL (queue, record->queue);
+  TEST_ASSERT_EQUAL (value, record->value);
+  TEST_ASSERT_EQUAL (size, record->size);
+
+}
+
+static bool _is_any (const pq_node_t* node, void* ctx) {
+
+  (void)node;
+  (void)ctx;
+  return true;
+
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+  memset (_ring, 0, sizeof(_ring));
+  strcpy (path, "/tmp/test_pq_trace_XXXXXX");
+  close (mkstemp (path));
+
+  TEST_ASSERT_TRUE (pq_trace_start (_ring, RING_SIZE));
+
+}
+
+void tearDown(void) {
+
+  pq_trace_stop ();
+  unlink (path);
+
+}
+
+
+void test_grabar_creacion_inserciones_consultas_y_extracciones_con_su_prioridad_y_tamano (void) {
+
+  pq = pq_create (_pq_memory_pool, ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE);
+  pq_insert (pq, &value, 30);
+  pq_insert (pq, &value, 10);
+  pq_peek (pq);
+  pq_extract (pq);
+  pq_extract (pq);
+  pq_peek (pq);
+  pq_extract (pq); // Vacia: no se graba
+
+  TEST_ASSERT_EQUAL (7U, pq_trace_count ());
+  TEST_ASSERT_EQUAL (0U, pq_trace_dropped ());
+
+  _assert_record (&_ring[0], PQ_TRACE_CREATE, 0, PQ_MIN_PRIORITY_QUEUE, ELEMENTS_NUMBER);
+  _assert_record (&_ring[1], PQ_TRACE_INSERT, 0, 30, 1);
+  _assert_record (&_ring[2], PQ_TRACE_INSERT, 0, 10, 2);
+  _assert_record (&_ring[3], PQ_TRACE_PEEK, 0, 10, 2);
+  _assert_record (&_ring[4], PQ_TRACE_EXTRACT, 0, 10, 1);
+  _assert_record (&_ring[5], PQ_TRACE_EXTRACT, 0, 30, 0);
+  _assert_record (&_ring[6], PQ_TRACE_PEEK, 0, 0, 0);
+
+}
+
+
+void test_identificar_varias_colas_incluida_una_que_ya_existia_y_grabar_una_fusion_con_su_origen (void) {
+
+  priority_queue_t* src = NULL;
+
+  pq_trace_stop ();
+  pq = pq_create (_pq_memory_pool, ELEMENTS_NUMBER, PQ_MAX_PRIORITY_QUEUE);
+  pq_insert (pq, &value, 5);
+  TEST_ASSERT_TRUE (pq_trace_start (_ring, RING_SIZE));
+
+  src = pq_create (_src_memory_pool, ELEMENTS_NUMBER / 2, PQ_MAX_PRIORITY_QUEUE);
+  pq_insert (src, &value, 7);
+  pq_insert (src, &value, 9);
+  TEST_ASSERT_TRUE (pq_merge (pq, src));
+
+  _assert_record (&_ring[0], PQ_TRACE_CREATE, 0, PQ_MAX_PRIORITY_QUEUE, ELEMENTS_NUMBER / 2);
+  _assert_record (&_ring[1], PQ_TRACE_INSERT, 0, 7, 1);
+  _assert_record (&_ring[2], PQ_TRACE_INSERT, 0, 9, 2);
+  // La cola de destino se ve por primera vez en la fusion
+  _assert_record (&_ring[3], PQ_TRACE_CREATE, 1, PQ_MAX_PRIORITY_QUEUE, ELEMENTS_NUMBER);
+  _assert_record (&_ring[4], PQ_TRACE_MERGE, 1, 0, 3);
+  TEST_ASSERT_EQUAL (5U, pq_trace_count ());
+
+}
+
+
+void test_sobrescribir_los_registros_mas_antiguos_al_llenarse_el_anillo_y_guardarlos_en_orden (void) {
+
+  pq_trace_file_t trace;
+
+  pq = pq_create (_pq_memory_pool, ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE);
+
+  for (uint16_t i = 0; i < RING_SIZE + 4; i++) {
+
+    pq_insert (pq, &value, i);
+    pq_extract (pq);
+
+  }
+
+  TEST_ASSERT_EQUAL (RING_SIZE, pq_trace_count ());
+  TEST_ASSERT_EQUAL (2 * (RING_SIZE + 4) + 1 - RING_SIZE, pq_trace_dropped ());
+
+  pq_trace_stop ();
+  TEST_ASSERT_TRUE (pq_trace_save (path));
+  TEST_ASSERT_TRUE (pq_trace_open (&trace, path));
+  TEST_ASSERT_EQUAL (RING_SIZE, trace.count);
+  TEST_ASSERT_EQUAL (pq_trace_dropped (), trace.dropped);
+
+  // Se conservan los ultimos: insercion y extraccion de las prioridades 20 a 35
+  for (uint16_t i = 0; i < RING_SIZE / 2; i++) {
+
+    _assert_record (&trace.records[2 * i], PQ_TRACE_INSERT, 0, 20 + i, 1);
+    _assert_record (&trace.records[2 * i + 1], PQ_TRACE_EXTRACT, 0, 20 + i, 0);
+
+  }
+
+  pq_trace_close (&trace);
+  TEST_ASSERT_NULL (trace.records);
+
+}
+
+
+void test_guardar_la_traza_en_un_fichero_abrirla_y_rechazar_ficheros_corruptos (void) {
+
+  pq_trace_file_t trace;
+  uint32_t garbage = 0;
+  FILE* file = NULL;
+
+  pq = pq_create (_pq_memory_pool, ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE);
+  pq_insert (pq, &value, 3);
+  pq_insert (pq, &value, 8);
+  TEST_ASSERT_EQUAL (2U, pq_remove_if (pq, _is_any, NULL));
+
+  pq_trace_stop ();
+  TEST_ASSERT_TRUE (pq_trace_save (path));
+  TEST_ASSERT_TRUE (pq_trace_open (&trace, path));
+  TEST_ASSERT_EQUAL (4U, trace.count);
+  TEST_ASSERT_EQUAL (0U, trace.dropped);
+  _assert_record (&trace.records[0], PQ_TRACE_CREATE, 0, PQ_MIN_PRIORITY_QUEUE, ELEMENTS_NUMBER);
+  _assert_record (&trace.records[2], PQ_TRACE_INSERT, 0, 8, 2);
+  _assert_record (&trace.records[3], PQ_TRACE_REMOVE, 0, 2, 0);
+  pq_trace_close (&trace);
+
+  // Un registro de mas al final: el tamano no cuadra con la cabecera
+  file = fopen (path, "ab");
+  TEST_ASSERT_NOT_NULL (file);
+  fwrite (&garbage, sizeof(garbage), 1, file);
+  fclose (file);
+  TEST_ASSERT_FALSE (pq_trace_open (&trace, path));
+
+  file = fopen (path, "wb");
+  TEST_ASSERT_NOT_NULL (file);
+  fwrite (&garbage, sizeof(garbage), 1, file);
+  fclose (file);
+  TEST_ASSERT_FALSE (pq_trace_open (&trace, path));
+
+  TEST_ASSERT_FALSE (pq_trace_open (NULL, path));
+  TEST_ASSERT_FALSE (pq_trace_open (&trace, NULL));
+  TEST_ASSERT_FALSE (pq_trace_save (NULL));
+
+}
+
+
+void test_no_grabar_nada_antes_de_iniciar_ni_despues_de_detener (void) {
+
+  pq_trace_stop ();
+  TEST_ASSERT_FALSE (pq_trace_start (NULL, RING_SIZE));
+  TEST_ASSERT_FALSE (pq_trace_start (_ring, 0));
+
+  pq = pq_create (_pq_memory_pool, ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE);
+  pq_insert (pq, &value, 3);
+  TEST_ASSERT_EQUAL (PQ_TRACE_MAX_QUEUES, pq_trace_queue_id (pq));
+
+  TEST_ASSERT_TRUE (pq_trace_start (_ring, RING_SIZE));
+  pq_extract (pq);
+  pq_trace_stop ();
+  pq_insert (pq, &value, 4);
+
+  TEST_ASSERT_EQUAL (2U, pq_trace_count ());
+  _assert_record (&_ring[0], PQ_TRACE_CREATE, 0, PQ_MIN_PRIORITY_QUEUE, ELEMENTS_NUMBER);
+  _assert_record (&_ring[1], PQ_TRACE_EXTRACT, 0, 3, 0);
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
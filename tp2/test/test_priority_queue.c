@@ -29,6 +29,18 @@ SPDX-License-Identifier: MIT
  ** - Insertar varios elementos con la misma prioridad y verificar que se extraen en orden de inserción
  ** - Comprobar que peek devuelve el elemento con mayor prioridad sin extraerlo de la cola
  ** - Validar comportamiento ante nulos
+ ** - Recorrer la cola en orden de extraccion sin modificarla
+ ** - Recorrer solo los primeros elementos con una frontera pequena
+ ** - Eliminar los elementos que cumplen un predicado y conservar el orden de insercion del resto
+ ** - Eliminar de forma diferida y verificar que los elementos marcados no se extraen
+ ** - Recorrer una cola con lapidas bajo la raiz y verificar que ocupan lugar en la frontera
+ ** - Insertar en una cola llena con elementos marcados y verificar que se recuperan sus huecos
+ ** - Fusionar una cola pequena en una grande y verificar el orden, incluidos los empates
+ ** - Fusionar dos colas de tamano parecido y verificar el orden, incluidos los empates
+ ** - Rechazar fusiones sin espacio o entre colas de distinto tipo
+ ** - Insertar en bloque y verificar el orden, incluidos los empates con los elementos previos
+ ** - Exportar ordenado sin modificar la cola y sin incluir los elementos marcados
+ ** - Crear una cola sobre un pool sucio sin tocar los huecos y verificar que funciona igual
  **
  ** \addtogroup name Module denomination
  ** \brief Brief description of the module
@@ -54,6 +66,7 @@ typedef struct {
 
 #define ELEMENTS_NUMBER 10
 static uint8_t _pq_memory_pool [PQ_MEMORY_SIZE(ELEMENTS_NUMBER)];
+static uint8_t _src_memory_pool [PQ_MEMORY_SIZE(ELEMENTS_NUMBER)];
 priority_queue_t* pq = NULL;
 
 /* === Private variable definitions ============================================================ */
@@ -70,6 +83,41 @@ static void _create_queue(pq_type_t type) {
 
 }
 
+/**
+ *Predicate used by remove tests: selects odd values
+ */
+static bool _is_odd (const pq_node_t* node, void* ctx) {
+
+  (void)ctx;
+  return (*(uint8_t*)node->data % 2) != 0;
+
+}
+
+/**
+ *Predicate used by remove tests: selects the value passed as context
+ */
+static bool _is_value (const pq_node_t* node, void* ctx) {
+
+  return *(uint8_t*)node->data == *(uint8_t*)ctx;
+
+}
+
+/**
+ *Helper to fill the queue with values 1..ELEMENTS_NUMBER, grouped in two priorities
+ */
+static void _fill_queue (data_t* data) {
+
+  _create_queue(PQ_MAX_PRIORITY_QUEUE);
+  for (uint8_t i = 0; i < ELEMENTS_NUMBER; i++) {
+
+    data[i].value = i + 1;
+    data[i].priority = (i < ELEMENTS_NUMBER / 2) ? 10 : 20;
+    TEST_ASSERT_TRUE(pq_insert(pq, &data[i].value, data[i].priority));
+
+  }
+
+}
+
 /* === Public function implementation ========================================================== */
 
 void setUp(void) {
@@ -281,6 +329,380 @@ void test_validar_comportamiento_ante_nulos (void) {
 
 }
 
+
+void test_recorrer_la_cola_en_orden_de_extraccion_sin_modificarla (void) {
+
+  data_t data[] = {
+    { .value = 1, .priority = 50 },
+    { .value = 2, .priority = 30 },
+    { .value = 3, .priority = 65 },
+    { .value = 4, .priority = 10 },
+    { .value = 5, .priority = 30 },
+    { .value = 6, .priority = 65 },
+  };
+  const uint8_t expected[] = { 3, 6, 1, 2, 5, 4 };
+  size_t frontier[PQ_ITER_FRONTIER_SIZE(ELEMENTS_NUMBER)];
+  pq_iter_t iter;
+
+  _create_queue(PQ_MAX_PRIORITY_QUEUE);
+  for (uint8_t i = 0; i < 6; i++) {
+
+    TEST_ASSERT_TRUE(pq_insert(pq, &data[i].value, data[i].priority));
+
+  }
+
+  TEST_ASSERT_TRUE(pq_iter_sorted(&iter, pq, frontier, PQ_ITER_FRONTIER_SIZE(ELEMENTS_NUMBER)));
+  for (uint8_t i = 0; i < 6; i++) {
+
+    const pq_node_t* node = pq_iter_next(&iter);
+    TEST_ASSERT_NOT_NULL(node);
+    TEST_ASSERT_EQUAL(expected[i], *(uint8_t*)node->data);
+
+  }
+  TEST_ASSERT_NULL(pq_iter_next(&iter));
+  TEST_ASSERT_FALSE(iter.truncated);
+
+  // La cola sigue intacta
+  TEST_ASSERT_EQUAL(6U, pq_size(pq));
+  for (uint8_t i = 0; i < 6; i++) {
+
+    TEST_ASSERT_EQUAL(expected[i], *(uint8_t*)pq_extract(pq));
+
+  }
+
+}
+
+
+void test_recorrer_solo_los_primeros_elementos_con_una_frontera_pequena (void) {
+
+  data_t data[ELEMENTS_NUMBER];
+  size_t frontier[PQ_ITER_FRONTIER_SIZE(3)];
+  pq_iter_t iter;
+
+  _create_queue(PQ_MIN_PRIORITY_QUEUE);
+  for (uint8_t i = 0; i < ELEMENTS_NUMBER; i++) {
+
+    data[i].value = i;
+    data[i].priority = (uint16_t)(100 - 10 * i);
+    TEST_ASSERT_TRUE(pq_insert(pq, &data[i].value, data[i].priority));
+
+  }
+
+  TEST_ASSERT_TRUE(pq_iter_sorted(&iter, pq, frontier, PQ_ITER_FRONTIER_SIZE(3)));
+  TEST_ASSERT_EQUAL(9, *(uint8_t*)pq_iter_next(&iter)->data);
+  TEST_ASSERT_EQUAL(8, *(uint8_t*)pq_iter_next(&iter)->data);
+  TEST_ASSERT_EQUAL(7, *(uint8_t*)pq_iter_next(&iter)->data);
+  TEST_ASSERT_FALSE(iter.truncated);
+
+  // Una frontera de una sola entrada no deja avanzar y lo indica
+  TEST_ASSERT_TRUE(pq_iter_sorted(&iter, pq, frontier, PQ_ITER_FRONTIER_SIZE(0)));
+  TEST_ASSERT_NULL(pq_iter_next(&iter));
+  TEST_ASSERT_TRUE(iter.truncated);
+
+  TEST_ASSERT_FALSE(pq_iter_sorted(NULL, pq, frontier, PQ_ITER_FRONTIER_SIZE(3)));
+  TEST_ASSERT_FALSE(pq_iter_sorted(&iter, NULL, frontier, PQ_ITER_FRONTIER_SIZE(3)));
+  TEST_ASSERT_FALSE(pq_iter_sorted(&iter, pq, NULL, PQ_ITER_FRONTIER_SIZE(3)));
+  TEST_ASSERT_NULL(pq_iter_next(NULL));
+
+}
+
+
+void test_eliminar_los_elementos_que_cumplen_un_predicado_y_conservar_el_orden_de_insercion_del_resto (void) {
+
+  data_t data[ELEMENTS_NUMBER];
+  const uint8_t expected[] = { 6, 8, 10, 2, 4 };
+
+  _fill_queue(data);
+
+  TEST_ASSERT_EQUAL(5U, pq_remove_if(pq, _is_odd, NULL));
+  TEST_ASSERT_EQUAL(5U, pq_size(pq));
+
+  for (uint8_t i = 0; i < 5; i++) {
+
+    TEST_ASSERT_EQUAL(expected[i], *(uint8_t*)pq_extract(pq));
+
+  }
+  TEST_ASSERT_TRUE(pq_is_empty(pq));
+
+  TEST_ASSERT_EQUAL(0U, pq_remove_if(NULL, _is_odd, NULL));
+  TEST_ASSERT_EQUAL(0U, pq_remove_if(pq, NULL, NULL));
+
+}
+
+
+void test_eliminar_de_forma_diferida_y_verificar_que_los_elementos_marcados_no_se_extraen (void) {
+
+  data_t data[ELEMENTS_NUMBER];
+  const uint8_t expected[] = { 6, 8, 10, 2, 4 };
+  size_t frontier[PQ_ITER_FRONTIER_SIZE_TOMBSTONES(5, 5)];
+  pq_iter_t iter;
+
+  _fill_queue(data);
+
+  TEST_ASSERT_EQUAL(5U, pq_remove_if_lazy(pq, _is_odd, NULL));
+  TEST_ASSERT_EQUAL(5U, pq_size(pq));
+  TEST_ASSERT_EQUAL(6, *(uint8_t*)pq_peek(pq));
+
+  // La frontera alcanza para los 5 elementos y las 5 lapidas que se recorren
+  TEST_ASSERT_EQUAL(5U, pq->tombstones);
+  TEST_ASSERT_TRUE(pq_iter_sorted(&iter, pq, frontier, PQ_ITER_FRONTIER_SIZE_TOMBSTONES(5, 5)));
+  for (uint8_t i = 0; i < 5; i++) {
+
+    TEST_ASSERT_EQUAL(expected[i], *(uint8_t*)pq_iter_next(&iter)->data);
+
+  }
+  TEST_ASSERT_NULL(pq_iter_next(&iter));
+  TEST_ASSERT_FALSE(iter.truncated);
+
+  for (uint8_t i = 0; i < 5; i++) {
+
+    TEST_ASSERT_EQUAL(expected[i], *(uint8_t*)pq_extract(pq));
+
+  }
+  TEST_ASSERT_TRUE(pq_is_empty(pq));
+  TEST_ASSERT_NULL(pq_extract(pq));
+
+}
+
+
+void test_recorrer_una_cola_con_lapidas_bajo_la_raiz_y_verificar_que_ocupan_lugar_en_la_frontera (void) {
+
+  uint8_t values[7];
+  size_t frontier[PQ_ITER_FRONTIER_SIZE_TOMBSTONES(2, 2)];
+  pq_iter_t iter;
+
+  _create_queue(PQ_MIN_PRIORITY_QUEUE);
+  for (uint8_t i = 0; i < 7; i++) {
+
+    values[i] = (uint8_t)(i + 1);
+    TEST_ASSERT_TRUE(pq_insert(pq, &values[i], values[i]));
+
+  }
+
+  // Los dos hijos de la raiz quedan como lapidas
+  TEST_ASSERT_EQUAL(1U, pq_remove_if_lazy(pq, _is_value, &values[1]));
+  TEST_ASSERT_EQUAL(1U, pq_remove_if_lazy(pq, _is_value, &values[2]));
+
+  // Sin contar las lapidas la frontera se llena antes del segundo elemento
+  TEST_ASSERT_TRUE(pq_iter_sorted(&iter, pq, frontier, PQ_ITER_FRONTIER_SIZE(2)));
+  TEST_ASSERT_EQUAL(1, *(uint8_t*)pq_iter_next(&iter)->data);
+  TEST_ASSERT_NULL(pq_iter_next(&iter));
+  TEST_ASSERT_TRUE(iter.truncated);
+
+  TEST_ASSERT_TRUE(pq_iter_sorted(&iter, pq, frontier, PQ_ITER_FRONTIER_SIZE_TOMBSTONES(2, 2)));
+  TEST_ASSERT_EQUAL(1, *(uint8_t*)pq_iter_next(&iter)->data);
+  TEST_ASSERT_EQUAL(4, *(uint8_t*)pq_iter_next(&iter)->data);
+  TEST_ASSERT_FALSE(iter.truncated);
+
+}
+
+
+void test_insertar_en_una_cola_llena_con_elementos_marcados_y_verificar_que_se_recuperan_sus_huecos (void) {
+
+  data_t data[ELEMENTS_NUMBER];
+  data_t extra = { .value = 11, .priority = 15 };
+
+  _fill_queue(data);
+
+  // Un unico elemento marcado no llega a compactar la cola
+  TEST_ASSERT_EQUAL(1U, pq_remove_if_lazy(pq, _is_value, &data[2].value));
+  TEST_ASSERT_EQUAL(ELEMENTS_NUMBER - 1, pq_size(pq));
+  TEST_ASSERT_EQUAL(ELEMENTS_NUMBER, pq->size);
+
+  TEST_ASSERT_TRUE(pq_insert(pq, &extra.value, extra.priority));
+  TEST_ASSERT_EQUAL(ELEMENTS_NUMBER, pq_size(pq));
+  TEST_ASSERT_EQUAL(0U, pq->tombstones);
+
+  // Prioridad 20 (6..10), luego el nuevo (15) y por ultimo prioridad 10 sin el 3
+  TEST_ASSERT_EQUAL(6, *(uint8_t*)pq_extract(pq));
+  for (uint8_t i = 0; i < 4; i++) {
+
+    pq_extract(pq);
+
+  }
+  TEST_ASSERT_EQUAL(11, *(uint8_t*)pq_extract(pq));
+  TEST_ASSERT_EQUAL(1, *(uint8_t*)pq_extract(pq));
+  TEST_ASSERT_EQUAL(2, *(uint8_t*)pq_extract(pq));
+  TEST_ASSERT_EQUAL(4, *(uint8_t*)pq_extract(pq));
+
+}
+
+
+void test_fusionar_una_cola_pequena_en_una_grande_y_verificar_el_orden_incluidos_los_empates (void) {
+
+  data_t data[ELEMENTS_NUMBER];
+  data_t extra[] = { { .value = 11, .priority = 20 }, { .value = 12, .priority = 5 } };
+  priority_queue_t* src = pq_create(_src_memory_pool, ELEMENTS_NUMBER, PQ_MAX_PRIORITY_QUEUE);
+
+  _fill_queue(data);
+  TEST_ASSERT_EQUAL(5U, pq_remove_if(pq, _is_odd, NULL));
+
+  TEST_ASSERT_TRUE(pq_insert(src, &extra[0].value, extra[0].priority));
+  TEST_ASSERT_TRUE(pq_insert(src, &extra[1].value, extra[1].priority));
+
+  TEST_ASSERT_TRUE(pq_merge(pq, src));
+  TEST_ASSERT_EQUAL(7U, pq_size(pq));
+  TEST_ASSERT_TRUE(pq_is_empty(src));
+
+  TEST_ASSERT_EQUAL(6, *(uint8_t*)pq_extract(pq));
+  TEST_ASSERT_EQUAL(8, *(uint8_t*)pq_extract(pq));
+  TEST_ASSERT_EQUAL(10, *(uint8_t*)pq_extract(pq));
+  TEST_ASSERT_EQUAL(11, *(uint8_t*)pq_extract(pq));
+  TEST_ASSERT_EQUAL(2, *(uint8_t*)pq_extract(pq));
+  TEST_ASSERT_EQUAL(4, *(uint8_t*)pq_extract(pq));
+  TEST_ASSERT_EQUAL(12, *(uint8_t*)pq_extract(pq));
+
+}
+
+
+void test_fusionar_dos_colas_de_tamano_parecido_y_verificar_el_orden_incluidos_los_empates (void) {
+
+  data_t data[ELEMENTS_NUMBER];
+  priority_queue_t* src = pq_create(_src_memory_pool, ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE);
+
+  _create_queue(PQ_MIN_PRIORITY_QUEUE);
+  for (uint8_t i = 0; i < ELEMENTS_NUMBER; i++) {
+
+    data[i].value = i;
+    data[i].priority = (uint16_t)(i % 3);
+    TEST_ASSERT_TRUE(pq_insert((i % 2) ? src : pq, &data[i].value, data[i].priority));
+
+  }
+
+  TEST_ASSERT_TRUE(pq_merge(pq, src));
+  TEST_ASSERT_EQUAL(ELEMENTS_NUMBER, pq_size(pq));
+
+  // Por prioridad; en empate primero los de destino (pares) y luego los de origen (impares)
+  const uint8_t expected[] = { 0, 6, 3, 9, 4, 1, 7, 2, 8, 5 };
+  for (uint8_t i = 0; i < ELEMENTS_NUMBER; i++) {
+
+    TEST_ASSERT_EQUAL(expected[i], *(uint8_t*)pq_extract(pq));
+
+  }
+
+}
+
+
+void test_rechazar_fusiones_sin_espacio_o_entre_colas_de_distinto_tipo (void) {
+
+  data_t data[ELEMENTS_NUMBER];
+  priority_queue_t* src = pq_create(_src_memory_pool, ELEMENTS_NUMBER, PQ_MAX_PRIORITY_QUEUE);
+
+  _fill_queue(data);
+  TEST_ASSERT_TRUE(pq_insert(src, &data[0].value, data[0].priority));
+
+  TEST_ASSERT_FALSE(pq_merge(pq, src));
+  TEST_ASSERT_EQUAL(1U, pq_size(src));
+
+  src = pq_create(_src_memory_pool, ELEMENTS_NUMBER, PQ_MIN_PRIORITY_QUEUE);
+  TEST_ASSERT_FALSE(pq_merge(pq, src));
+  TEST_ASSERT_FALSE(pq_merge(pq, pq));
+  TEST_ASSERT_FALSE(pq_merge(NULL, src));
+  TEST_ASSERT_FALSE(pq_merge(pq, NULL));
+
+}
+
+
+
+void test_insertar_en_bloque_y_verificar_el_orden_incluidos_los_empates_con_los_elementos_previos (void) {
+
+  data_t data[ELEMENTS_NUMBER];
+  void* payloads[ELEMENTS_NUMBER];
+  uint16_t priorities[ELEMENTS_NUMBER];
+  const uint8_t expected[] = { 3, 6, 1, 2, 5, 4, 7 };
+
+  _create_queue(PQ_MAX_PRIORITY_QUEUE);
+
+  for (uint8_t i = 0; i < 7; i++) {
+
+    data[i].value = i + 1;
+    payloads[i] = &data[i].value;
+    priorities[i] = (i % 3) * 10;
+
+  }
+
+  TEST_ASSERT_TRUE(pq_insert(pq, payloads[0], 10));
+  TEST_ASSERT_TRUE(pq_insert_bulk(pq, &payloads[1], &priorities[1], 6));
+  TEST_ASSERT_EQUAL(7U, pq_size(pq));
+  TEST_ASSERT_EQUAL(7U, pq->next_insertion_index);
+
+  for (uint8_t i = 0; i < 7; i++) {
+
+    TEST_ASSERT_EQUAL(expected[i], *(uint8_t*)pq_extract(pq));
+
+  }
+
+  // Todo o nada: sin espacio o con algun dato nulo no se inserta ninguno
+  payloads[2] = NULL;
+  TEST_ASSERT_FALSE(pq_insert_bulk(pq, payloads, priorities, 7));
+  TEST_ASSERT_FALSE(pq_insert_bulk(pq, &payloads[3], priorities, ELEMENTS_NUMBER + 1));
+  TEST_ASSERT_FALSE(pq_insert_bulk(NULL, payloads, priorities, 1));
+  TEST_ASSERT_TRUE(pq_is_empty(pq));
+
+}
+
+
+void test_exportar_ordenado_sin_modificar_la_cola_y_sin_incluir_los_elementos_marcados (void) {
+
+  data_t data[ELEMENTS_NUMBER];
+  pq_node_t out[ELEMENTS_NUMBER];
+  uint8_t value = 7;
+  const uint8_t expected[] = { 6, 8, 9, 10, 1, 2, 3, 4, 5 };
+
+  _fill_queue(data);
+  TEST_ASSERT_EQUAL(1U, pq_remove_if_lazy(pq, _is_value, &value));
+
+  TEST_ASSERT_EQUAL(9U, pq_export_sorted(pq, out));
+  TEST_ASSERT_EQUAL(9U, pq_size(pq));
+
+  for (uint8_t i = 0; i < 9; i++) {
+
+    TEST_ASSERT_EQUAL(expected[i], *(uint8_t*)out[i].data);
+    TEST_ASSERT_EQUAL(expected[i], *(uint8_t*)pq_extract(pq));
+
+  }
+
+  TEST_ASSERT_EQUAL(0U, pq_export_sorted(NULL, out));
+  TEST_ASSERT_EQUAL(0U, pq_export_sorted(pq, NULL));
+
+}
+
+
+
+void test_crear_una_cola_sobre_un_pool_sucio_sin_tocar_los_huecos_y_verificar_que_funciona_igual (void) {
+
+  data_t data[ELEMENTS_NUMBER];
+  const uint8_t expected[] = { 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 };
+
+  memset(_pq_memory_pool, 0xA5, sizeof(_pq_memory_pool));
+  _create_queue(PQ_MAX_PRIORITY_QUEUE);
+
+  for (size_t i = 0; i < ELEMENTS_NUMBER * sizeof(pq_node_t); i++) {
+
+    TEST_ASSERT_EQUAL_HEX8(0xA5, ((uint8_t*)pq->nodes)[i]);
+
+  }
+
+  TEST_ASSERT_TRUE(pq_is_empty(pq));
+  TEST_ASSERT_NULL(pq_peek(pq));
+
+  for (uint8_t i = 0; i < ELEMENTS_NUMBER; i++) {
+
+    data[i].value = i + 1;
+    TEST_ASSERT_TRUE(pq_insert(pq, &data[i].value, i));
+
+  }
+
+  for (uint8_t i = 0; i < ELEMENTS_NUMBER; i++) {
+
+    TEST_ASSERT_EQUAL(expected[i], *(uint8_t*)pq_extract(pq));
+
+  }
+
+  TEST_ASSERT_NULL(pq_extract(pq));
+
+}
+
 /* === End of documentation ==================================================================== */
 
 /** @} End of module definition for doxygen */
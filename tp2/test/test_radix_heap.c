@@ -0,0 +1,189 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo de monticulo radix
+ **
+ ** Pruebas a realizar:
+ ** - Insertar claves desordenadas y extraerlas en orden creciente
+ ** - Intercalar inserciones y extracciones monotonas como lo hace Dijkstra
+ ** - Verificar que se rechaza una clave menor que la ultima extraida
+ ** - Llenar el monticulo, vaciarlo y verificar que admite claves desde cero
+ ** - Validar comportamiento ante nulos
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "radix_heap.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define ELEMENTS_NUMBER 64
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+static uint64_t _memory_pool [RADIX_HEAP_MEMORY_SIZE(ELEMENTS_NUMBER) / sizeof(uint64_t) + 1];
+static radix_heap_t* rh = NULL;
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static uint64_t _pop_key (void) {
+
+  uint64_t key = 0;
+  uint32_t value = 0;
+
+  TEST_ASSERT_TRUE (rh_pop (rh, &key, &value));
+  TEST_ASSERT_EQUAL ((uint32_t)key, value);
+
+  return key;
+
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+  rh = rh_create (_memory_pool, ELEMENTS_NUMBER);
+  TEST_ASSERT_NOT_NULL (rh);
+
+}
+
+void tearDown(void) {
+
+}
+
+
+void test_insertar_claves_desordenadas_y_extraerlas_en_orden_creciente (void) {
+
+  const uint64_t keys[] = { 900, 3, 1ULL << 40, 77, 3, 0, 512, (1ULL << 40) + 1 };
+  const uint64_t sorted[] = { 0, 3, 3, 77, 512, 900, 1ULL << 40, (1ULL << 40) + 1 };
+
+  for (unsigned i = 0; i < 8; i++) {
+
+    TEST_ASSERT_TRUE (rh_push (rh, keys[i], (uint32_t)keys[i]));
+
+  }
+
+  TEST_ASSERT_EQUAL (8U, rh_size (rh));
+
+  for (unsigned i = 0; i < 8; i++) {
+
+    TEST_ASSERT_EQUAL (sorted[i], _pop_key ());
+
+  }
+
+  TEST_ASSERT_TRUE (rh_is_empty (rh));
+  TEST_ASSERT_FALSE (rh_pop (rh, NULL, NULL));
+
+}
+
+
+void test_intercalar_inserciones_y_extracciones_monotonas_como_lo_hace_dijkstra (void) {
+
+  uint64_t last = 0;
+  uint32_t seed = 12345;
+
+  TEST_ASSERT_TRUE (rh_push (rh, 0, 0));
+
+  for (unsigned round = 0; round < 1000; round++) {
+
+    uint64_t key = _pop_key ();
+
+    TEST_ASSERT_TRUE (key >= last);
+    last = key;
+
+    // Cada extraccion relaja hasta dos aristas con pesos aleatorios
+    for (unsigned i = 0; i < 2 && rh_size (rh) < ELEMENTS_NUMBER; i++) {
+
+      seed = seed * 1103515245U + 12345U;
+      TEST_ASSERT_TRUE (rh_push (rh, key + (seed >> 20), (uint32_t)(key + (seed >> 20))));
+
+    }
+
+  }
+
+}
+
+
+void test_verificar_que_se_rechaza_una_clave_menor_que_la_ultima_extraida (void) {
+
+  TEST_ASSERT_TRUE (rh_push (rh, 10, 10));
+  TEST_ASSERT_TRUE (rh_push (rh, 20, 20));
+  TEST_ASSERT_EQUAL (10U, _pop_key ());
+
+  TEST_ASSERT_FALSE (rh_push (rh, 9, 9));
+  TEST_ASSERT_TRUE (rh_push (rh, 10, 10));
+  TEST_ASSERT_EQUAL (10U, _pop_key ());
+  TEST_ASSERT_EQUAL (20U, _pop_key ());
+
+}
+
+
+void test_llenar_el_monticulo_vaciarlo_y_verificar_que_admite_claves_desde_cero (void) {
+
+  for (uint32_t i = 0; i < ELEMENTS_NUMBER; i++) {
+
+    TEST_ASSERT_TRUE (rh_push (rh, 100 + i, 100 + i));
+
+  }
+
+  TEST_ASSERT_FALSE (rh_push (rh, 200, 200));
+  TEST_ASSERT_EQUAL (100U, _pop_key ());
+
+  rh_clear (rh);
+  TEST_ASSERT_TRUE (rh_is_empty (rh));
+
+  for (uint32_t i = 0; i < ELEMENTS_NUMBER; i++) {
+
+    TEST_ASSERT_TRUE (rh_push (rh, ELEMENTS_NUMBER - i, ELEMENTS_NUMBER - i));
+
+  }
+
+  TEST_ASSERT_EQUAL (1U, _pop_key ());
+
+}
+
+
+void test_validar_comportamiento_ante_nulos (void) {
+
+  TEST_ASSERT_NULL (rh_create (NULL, ELEMENTS_NUMBER));
+  TEST_ASSERT_NULL (rh_create (_memory_pool, 0));
+  TEST_ASSERT_FALSE (rh_push (NULL, 1, 1));
+  TEST_ASSERT_FALSE (rh_pop (NULL, NULL, NULL));
+  TEST_ASSERT_TRUE (rh_is_empty (NULL));
+  TEST_ASSERT_EQUAL (0U, rh_size (NULL));
+  rh_clear (NULL);
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
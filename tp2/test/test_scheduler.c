@@ -0,0 +1,332 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo planificador cooperativo
+ **
+ ** Pruebas a realizar:
+ ** - Liberar varias tareas a la vez y verificar que se despachan por plazo mas cercano
+ ** - Con prioridad fija verificar que se despachan por prioridad y en orden de llegada
+ ** - No despachar una tarea antes de su instante de liberacion
+ ** - Verificar la reliberacion periodica y el conteo de activaciones
+ ** - Verificar el conteo de plazos incumplidos y la fluctuacion de inicio
+ ** - Ejecutar mucho mas tiempo que el alcance de las claves y verificar que no se pierde el orden
+ ** - Atrasarse mas que SCHED_MAX_INTERVAL y verificar que las claves saturadas no adelantan a otras
+ ** - Validar comportamiento ante nulos y parametros invalidos
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include "unity.h"
+#include "priority_queue.h"
+#include "scheduler.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define TASKS_NUMBER 8
+#define LOG_SIZE     64
+
+/* === Private data type declarations ========================================================== */
+
+typedef struct {
+  unsigned id;
+  uint64_t cost;   // Ticks que avanza el reloj al ejecutar
+} job_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+static uint8_t _releases_pool [PQ_MEMORY_SIZE(TASKS_NUMBER)];
+static uint8_t _ready_pool [PQ_MEMORY_SIZE(TASKS_NUMBER)];
+static scheduler_t sched;
+static sched_task_t tasks[TASKS_NUMBER];
+static job_t jobs[TASKS_NUMBER];
+static uint64_t fake_now;
+static unsigned log_ids[LOG_SIZE];
+static size_t log_size;
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static uint64_t _clock (void* ctx) {
+
+  (void)ctx;
+  return fake_now;
+
+}
+
+static void _job (void* ctx) {
+
+  job_t* job = (job_t*)ctx;
+
+  fake_now += job->cost;
+
+  if (log_size < LOG_SIZE) {
+
+    log_ids[log_size++] = job->id;
+
+  }
+
+}
+
+static void _init (sched_policy_t policy) {
+
+  TEST_ASSERT_TRUE (sched_init (&sched, _releases_pool, _ready_pool, TASKS_NUMBER,
+                                policy, _clock, NULL));
+
+}
+
+static void _task (unsigned i, uint32_t period, uint32_t deadline, uint16_t priority) {
+
+  TEST_ASSERT_TRUE (sched_task_init (&tasks[i], _job, &jobs[i], period, deadline, priority));
+
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+  fake_now = 1000;
+  log_size = 0;
+
+  for (unsigned i = 0; i < TASKS_NUMBER; i++) {
+
+    jobs[i].id = i;
+    jobs[i].cost = 0;
+
+  }
+
+}
+
+void tearDown(void) {
+
+}
+
+
+void test_liberar_varias_tareas_a_la_vez_y_verificar_que_se_despachan_por_plazo_mas_cercano (void) {
+
+  const uint32_t deadlines[] = { 300, 100, 200, 100 };
+  const unsigned expected[] = { 1, 3, 2, 0 };
+
+  _init (SCHED_EDF);
+
+  for (unsigned i = 0; i < 4; i++) {
+
+    _task (i, SCHED_ONE_SHOT, deadlines[i], 0);
+    TEST_ASSERT_TRUE (sched_add (&sched, &tasks[i], fake_now));
+
+  }
+
+  while (sched_run_once (&sched)) { }
+
+  TEST_ASSERT_EQUAL (4U, log_size);
+  TEST_ASSERT_EQUAL_UINT_ARRAY (expected, log_ids, 4);
+  TEST_ASSERT_EQUAL (0U, sched_pending (&sched));
+
+}
+
+
+void test_con_prioridad_fija_verificar_que_se_despachan_por_prioridad_y_en_orden_de_llegada (void) {
+
+  const uint16_t priorities[] = { 5, 1, 5, 0 };
+  const unsigned expected[] = { 3, 1, 0, 2 };
+
+  _init (SCHED_FIXED_PRIORITY);
+
+  for (unsigned i = 0; i < 4; i++) {
+
+    _task (i, SCHED_ONE_SHOT, 1, priorities[i]);
+    TEST_ASSERT_TRUE (sched_add (&sched, &tasks[i], fake_now));
+
+  }
+
+  while (sched_run_once (&sched)) { }
+
+  TEST_ASSERT_EQUAL_UINT_ARRAY (expected, log_ids, 4);
+
+}
+
+
+void test_no_despachar_una_tarea_antes_de_su_instante_de_liberacion (void) {
+
+  uint64_t release = 0;
+
+  _init (SCHED_EDF);
+  _task (0, SCHED_ONE_SHOT, 10, 0);
+  TEST_ASSERT_TRUE (sched_add (&sched, &tasks[0], fake_now + 50));
+
+  TEST_ASSERT_TRUE (sched_next_release (&sched, &release));
+  TEST_ASSERT_EQUAL (fake_now + 50, release);
+
+  fake_now += 49;
+  TEST_ASSERT_FALSE (sched_run_once (&sched));
+
+  fake_now += 1;
+  TEST_ASSERT_TRUE (sched_run_once (&sched));
+  TEST_ASSERT_FALSE (sched_next_release (&sched, &release));
+
+}
+
+
+void test_verificar_la_reliberacion_periodica_y_el_conteo_de_activaciones (void) {
+
+  _init (SCHED_EDF);
+  _task (0, 10, 10, 0);
+  _task (1, 25, 25, 0);
+  TEST_ASSERT_TRUE (sched_add (&sched, &tasks[0], fake_now));
+  TEST_ASSERT_TRUE (sched_add (&sched, &tasks[1], fake_now));
+
+  for (unsigned tick = 0; tick < 100; tick++) {
+
+    while (sched_run_once (&sched)) { }
+    fake_now++;
+
+  }
+
+  TEST_ASSERT_EQUAL (10U, tasks[0].activations);
+  TEST_ASSERT_EQUAL (4U, tasks[1].activations);
+  TEST_ASSERT_EQUAL (14U, sched.dispatched);
+  TEST_ASSERT_EQUAL (0U, sched.misses);
+  TEST_ASSERT_EQUAL (2U, sched_pending (&sched));
+
+}
+
+
+void test_verificar_el_conteo_de_plazos_incumplidos_y_la_fluctuacion_de_inicio (void) {
+
+  _init (SCHED_EDF);
+  _task (0, SCHED_ONE_SHOT, 10, 0);
+  _task (1, SCHED_ONE_SHOT, 20, 0);
+  jobs[0].cost = 15;
+  jobs[1].cost = 1;
+  TEST_ASSERT_TRUE (sched_add (&sched, &tasks[0], fake_now));
+  TEST_ASSERT_TRUE (sched_add (&sched, &tasks[1], fake_now));
+
+  while (sched_run_once (&sched)) { }
+
+  // La tarea 0 termina en 15 (plazo 10); la 1 empieza en 15 y termina en 16 (plazo 20)
+  TEST_ASSERT_EQUAL (1U, tasks[0].misses);
+  TEST_ASSERT_EQUAL (0U, tasks[1].misses);
+  TEST_ASSERT_EQUAL (1U, sched.misses);
+  TEST_ASSERT_EQUAL (0U, tasks[0].max_jitter);
+  TEST_ASSERT_EQUAL (15U, tasks[1].max_jitter);
+  TEST_ASSERT_EQUAL (15U, tasks[1].total_jitter);
+
+}
+
+
+void test_ejecutar_mucho_mas_tiempo_que_el_alcance_de_las_claves_y_verificar_que_no_se_pierde_el_orden (void) {
+
+  const uint64_t start = fake_now;
+  const uint64_t duration = 10ULL * UINT16_MAX;
+
+  _init (SCHED_EDF);
+  _task (0, 1000, 1000, 0);
+  _task (1, SCHED_MAX_INTERVAL, SCHED_MAX_INTERVAL, 0);
+  _task (2, 7, 3, 0);
+  TEST_ASSERT_TRUE (sched_add (&sched, &tasks[0], fake_now));
+  TEST_ASSERT_TRUE (sched_add (&sched, &tasks[1], fake_now));
+  TEST_ASSERT_TRUE (sched_add (&sched, &tasks[2], fake_now + SCHED_MAX_INTERVAL));
+
+  while (fake_now < start + duration) {
+
+    while (sched_run_once (&sched)) { }
+    fake_now++;
+
+  }
+
+  TEST_ASSERT_EQUAL ((duration - 1) / 1000 + 1, tasks[0].activations);
+  TEST_ASSERT_EQUAL ((duration - 1) / SCHED_MAX_INTERVAL + 1, tasks[1].activations);
+  TEST_ASSERT_EQUAL ((duration - SCHED_MAX_INTERVAL + 6) / 7, tasks[2].activations);
+  TEST_ASSERT_EQUAL (0U, sched.misses);
+  TEST_ASSERT_EQUAL (0U, tasks[0].max_jitter);
+  TEST_ASSERT_TRUE (sched.base > start);
+
+}
+
+
+void test_atrasarse_mas_que_sched_max_interval_y_verificar_que_las_claves_saturadas_no_adelantan_a_otras (void) {
+
+  const uint64_t start = fake_now;
+  const uint64_t late = start + 6ULL * SCHED_MAX_INTERVAL;
+
+  _init (SCHED_FIXED_PRIORITY);
+  _task (0, 1000, 1000, 0);
+  _task (1, SCHED_ONE_SHOT, 0, 1);
+  _task (2, SCHED_ONE_SHOT, 0, 1);
+  TEST_ASSERT_TRUE (sched_add (&sched, &tasks[0], start));
+
+  // La tarea 0 se atrasa y retiene la base: las otras dos se liberan con la clave saturada
+  fake_now = late;
+  TEST_ASSERT_TRUE (sched_add (&sched, &tasks[1], late + 10));
+  TEST_ASSERT_TRUE (sched_add (&sched, &tasks[2], late + 5));
+
+  // Ninguna liberacion pendiente de la tarea 0 queda detras de las saturadas
+  while (sched_run_once (&sched)) { }
+
+  TEST_ASSERT_EQUAL ((late - start) / 1000 + 1, tasks[0].activations);
+  TEST_ASSERT_EQUAL (0U, tasks[1].activations);
+  TEST_ASSERT_EQUAL (0U, tasks[2].activations);
+
+  // Las saturadas salen en orden de liberacion
+  fake_now = late + 10;
+  log_size = 0;
+  while (sched_run_once (&sched)) { }
+
+  TEST_ASSERT_EQUAL (2U, log_size);
+  TEST_ASSERT_EQUAL (2U, log_ids[0]);
+  TEST_ASSERT_EQUAL (1U, log_ids[1]);
+
+}
+
+
+void test_validar_comportamiento_ante_nulos_y_parametros_invalidos (void) {
+
+  TEST_ASSERT_FALSE (sched_init (NULL, _releases_pool, _ready_pool, TASKS_NUMBER, SCHED_EDF, _clock, NULL));
+  TEST_ASSERT_FALSE (sched_init (&sched, NULL, _ready_pool, TASKS_NUMBER, SCHED_EDF, _clock, NULL));
+  TEST_ASSERT_FALSE (sched_init (&sched, _releases_pool, _ready_pool, TASKS_NUMBER, SCHED_EDF, NULL, NULL));
+  TEST_ASSERT_FALSE (sched_init (&sched, _releases_pool, _ready_pool, TASKS_NUMBER, (sched_policy_t)7, _clock, NULL));
+  _init (SCHED_EDF);
+
+  TEST_ASSERT_FALSE (sched_task_init (NULL, _job, NULL, 10, 10, 0));
+  TEST_ASSERT_FALSE (sched_task_init (&tasks[0], NULL, NULL, 10, 10, 0));
+  TEST_ASSERT_FALSE (sched_task_init (&tasks[0], _job, NULL, SCHED_MAX_INTERVAL + 1, 10, 0));
+  TEST_ASSERT_FALSE (sched_task_init (&tasks[0], _job, NULL, 10, SCHED_MAX_INTERVAL + 1, 0));
+  _task (0, 10, 10, 0);
+
+  TEST_ASSERT_FALSE (sched_add (NULL, &tasks[0], fake_now));
+  TEST_ASSERT_FALSE (sched_add (&sched, NULL, fake_now));
+  TEST_ASSERT_FALSE (sched_add (&sched, &tasks[0], fake_now + SCHED_MAX_INTERVAL + 1));
+  TEST_ASSERT_FALSE (sched_run_once (NULL));
+  TEST_ASSERT_FALSE (sched_run_once (&sched));
+  TEST_ASSERT_FALSE (sched_next_release (&sched, NULL));
+  TEST_ASSERT_EQUAL (0U, sched_pending (NULL));
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,322 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Fichero de pruebas unitarias del modulo de rueda de temporizadores
+ **
+ ** Pruebas a realizar:
+ ** - Armar un temporizador cercano y verificar que vence exactamente en su tick
+ ** - Armar temporizadores en cada nivel de la rueda y verificar que vencen en su tick
+ ** - Armar un temporizador lejano que desborda a la cola y verificar que vence en su tick
+ ** - Cancelar temporizadores de la rueda y del desborde y verificar que no vencen
+ ** - Rearmar un temporizador lejano mas veces que la capacidad del desborde
+ ** - Cancelar un temporizador del desborde y reutilizar su memoria antes de su epoca
+ ** - Armar un temporizador en el limite del alcance garantizado con la base lo mas atrasada posible
+ ** - Rearmar un temporizador desde su propia funcion de vencimiento (periodico)
+ ** - Armar muchos temporizadores y verificar que vencen en orden de plazo
+ ** - Validar comportamiento ante nulos y desborde lleno
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+#include <string.h>
+#include "unity.h"
+#include "priority_queue.h"
+#include "timer_wheel.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define OVERFLOW_CAPACITY 4
+#define TIMERS_NUMBER     200
+
+/* === Private data type declarations ========================================================== */
+
+typedef struct {
+  tw_timer_t timer;
+  uint64_t fired_at;
+  unsigned fired;
+  uint64_t period;
+} probe_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+static uint8_t _overflow_pool [PQ_MEMORY_SIZE(OVERFLOW_CAPACITY)];
+static timer_wheel_t tw;
+static probe_t probes[TIMERS_NUMBER];
+static uint64_t last_fired;
+static bool in_order;
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void _on_expire (void* ctx) {
+
+  probe_t* probe = (probe_t*)ctx;
+
+  probe->fired_at = tw.now;
+  probe->fired++;
+
+  in_order = in_order && (tw.now >= last_fired) && (tw.now == probe->timer.deadline);
+  last_fired = tw.now;
+
+  if (probe->period > 0) {
+
+    tw_arm (&tw, &probe->timer, tw.now + probe->period);
+
+  }
+
+}
+
+static void _arm (probe_t* probe, uint64_t deadline) {
+
+  TEST_ASSERT_TRUE (tw_arm (&tw, &probe->timer, deadline));
+  TEST_ASSERT_TRUE (tw_is_armed (&probe->timer));
+
+}
+
+/* === Public function implementation ========================================================== */
+
+void setUp(void) {
+
+  TEST_ASSERT_TRUE (tw_init (&tw, _overflow_pool, OVERFLOW_CAPACITY, 1000));
+
+  for (unsigned i = 0; i < TIMERS_NUMBER; i++) {
+
+    tw_timer_init (&probes[i].timer, _on_expire, &probes[i]);
+    probes[i].fired_at = 0;
+    probes[i].fired = 0;
+    probes[i].period = 0;
+
+  }
+
+  last_fired = 0;
+  in_order = true;
+
+}
+
+void tearDown(void) {
+
+}
+
+
+void test_armar_un_temporizador_cercano_y_verificar_que_vence_exactamente_en_su_tick (void) {
+
+  _arm (&probes[0], 1005);
+
+  TEST_ASSERT_EQUAL (0U, tw_advance (&tw, 1004));
+  TEST_ASSERT_EQUAL (0U, probes[0].fired);
+
+  TEST_ASSERT_EQUAL (1U, tw_advance (&tw, 1005));
+  TEST_ASSERT_EQUAL (1005U, probes[0].fired_at);
+  TEST_ASSERT_FALSE (tw_is_armed (&probes[0].timer));
+
+}
+
+
+void test_armar_temporizadores_en_cada_nivel_de_la_rueda_y_verificar_que_vencen_en_su_tick (void) {
+
+  const uint64_t deadlines[] = { 1001, 1100, 1000 + 5000, 1000 + 300000, 1000 + 10000000 };
+
+  for (unsigned i = 0; i < 5; i++) {
+
+    _arm (&probes[i], deadlines[i]);
+
+  }
+
+  TEST_ASSERT_EQUAL (5U, tw_advance (&tw, 1000 + 10000000));
+
+  for (unsigned i = 0; i < 5; i++) {
+
+    TEST_ASSERT_EQUAL (deadlines[i], probes[i].fired_at);
+
+  }
+  TEST_ASSERT_TRUE (in_order);
+
+}
+
+
+void test_armar_un_temporizador_lejano_que_desborda_a_la_cola_y_verificar_que_vence_en_su_tick (void) {
+
+  const uint64_t deadline = 3 * TW_SPAN + 12345;
+
+  _arm (&probes[0], deadline);
+  TEST_ASSERT_EQUAL (1U, pq_size (tw.overflow));
+
+  TEST_ASSERT_EQUAL (0U, tw_advance (&tw, deadline - 1));
+  TEST_ASSERT_EQUAL (0U, pq_size (tw.overflow));
+
+  TEST_ASSERT_EQUAL (1U, tw_advance (&tw, deadline + 10));
+  TEST_ASSERT_EQUAL (deadline, probes[0].fired_at);
+
+}
+
+
+void test_cancelar_temporizadores_de_la_rueda_y_del_desborde_y_verificar_que_no_vencen (void) {
+
+  _arm (&probes[0], 1010);
+  _arm (&probes[1], 1010);
+  _arm (&probes[2], 2 * TW_SPAN);
+
+  TEST_ASSERT_TRUE (tw_cancel (&tw, &probes[0].timer));
+  TEST_ASSERT_TRUE (tw_cancel (&tw, &probes[2].timer));
+  TEST_ASSERT_FALSE (tw_cancel (&tw, &probes[0].timer));
+
+  // Rearmado tras cancelar: la entrada vieja del desborde ya es una lapida
+  _arm (&probes[2], 2 * TW_SPAN + 7);
+
+  TEST_ASSERT_EQUAL (2U, tw_advance (&tw, 3 * TW_SPAN));
+  TEST_ASSERT_EQUAL (0U, probes[0].fired);
+  TEST_ASSERT_EQUAL (1U, probes[1].fired);
+  TEST_ASSERT_EQUAL (1U, probes[2].fired);
+  TEST_ASSERT_EQUAL (2 * TW_SPAN + 7, probes[2].fired_at);
+
+}
+
+
+void test_rearmar_un_temporizador_lejano_mas_veces_que_la_capacidad_del_desborde (void) {
+
+  const uint64_t deadline = (1ULL << 30) - 1;
+
+  for (unsigned i = 0; i < 2 * OVERFLOW_CAPACITY + 1; i++) {
+
+    _arm (&probes[0], deadline - i);
+    TEST_ASSERT_EQUAL (1U, pq_size (tw.overflow));
+
+  }
+
+  // El resto del desborde sigue disponible para otros temporizadores
+  for (unsigned i = 1; i < OVERFLOW_CAPACITY; i++) {
+
+    _arm (&probes[i], deadline);
+
+  }
+
+  TEST_ASSERT_EQUAL (OVERFLOW_CAPACITY, tw_advance (&tw, deadline));
+  TEST_ASSERT_EQUAL (1U, probes[0].fired);
+  TEST_ASSERT_EQUAL (deadline - 2 * OVERFLOW_CAPACITY, probes[0].fired_at);
+
+}
+
+
+void test_cancelar_un_temporizador_del_desborde_y_reutilizar_su_memoria_antes_de_su_epoca (void) {
+
+  _arm (&probes[0], 2 * TW_SPAN);
+  _arm (&probes[1], 2 * TW_SPAN + 1);
+
+  TEST_ASSERT_TRUE (tw_cancel (&tw, &probes[0].timer));
+
+  // La memoria del temporizador cancelado se puede liberar o reutilizar en seguida
+  memset (&probes[0], 0xA5, sizeof (probes[0]));
+
+  TEST_ASSERT_EQUAL (1U, tw_advance (&tw, 3 * TW_SPAN));
+  TEST_ASSERT_EQUAL (1U, probes[1].fired);
+
+}
+
+
+void test_armar_un_temporizador_en_el_limite_del_alcance_garantizado_con_la_base_lo_mas_atrasada_posible (void) {
+
+  // Ultima epoca antes de que se mueva la base de las claves del desborde
+  const uint64_t epoch = TW_RENORMALIZE_EPOCHS - 1;
+  const uint64_t deadline = (epoch + TW_REACH_EPOCHS) * TW_SPAN;
+
+  TEST_ASSERT_EQUAL (0U, tw_advance (&tw, epoch * TW_SPAN));
+  TEST_ASSERT_EQUAL (0U, tw.overflow_base);
+
+  _arm (&probes[0], deadline);
+  TEST_ASSERT_FALSE (tw_arm (&tw, &probes[1].timer, deadline + TW_SPAN));
+
+  // Al empezar la epoca siguiente la base avanza y el alcance vuelve a crecer
+  TEST_ASSERT_EQUAL (0U, tw_advance (&tw, (epoch + 1) * TW_SPAN));
+  _arm (&probes[1], deadline + TW_SPAN);
+
+  TEST_ASSERT_EQUAL (2U, tw_advance (&tw, deadline + TW_SPAN));
+  TEST_ASSERT_EQUAL (deadline, probes[0].fired_at);
+  TEST_ASSERT_EQUAL (deadline + TW_SPAN, probes[1].fired_at);
+
+}
+
+
+void test_rearmar_un_temporizador_desde_su_propia_funcion_de_vencimiento (void) {
+
+  probes[0].period = 100;
+  _arm (&probes[0], 1100);
+
+  TEST_ASSERT_EQUAL (10U, tw_advance (&tw, 2000));
+  TEST_ASSERT_EQUAL (10U, probes[0].fired);
+  TEST_ASSERT_EQUAL (2000U, probes[0].fired_at);
+  TEST_ASSERT_TRUE (tw_is_armed (&probes[0].timer));
+
+}
+
+
+void test_armar_muchos_temporizadores_y_verificar_que_vencen_en_orden_de_plazo (void) {
+
+  for (unsigned i = 0; i < TIMERS_NUMBER; i++) {
+
+    _arm (&probes[i], 1001 + (i * 7919U) % 70000U);
+
+  }
+
+  TEST_ASSERT_EQUAL (TIMERS_NUMBER, tw_advance (&tw, 1000 + 70000));
+  TEST_ASSERT_TRUE (in_order);
+
+  for (unsigned i = 0; i < TIMERS_NUMBER; i++) {
+
+    TEST_ASSERT_EQUAL (1U, probes[i].fired);
+
+  }
+
+}
+
+
+void test_validar_comportamiento_ante_nulos_y_desborde_lleno (void) {
+
+  TEST_ASSERT_FALSE (tw_init (NULL, _overflow_pool, OVERFLOW_CAPACITY, 0));
+  TEST_ASSERT_FALSE (tw_init (&tw, NULL, OVERFLOW_CAPACITY, 0));
+  TEST_ASSERT_TRUE (tw_init (&tw, _overflow_pool, OVERFLOW_CAPACITY, 0));
+
+  TEST_ASSERT_FALSE (tw_arm (NULL, &probes[0].timer, 10));
+  TEST_ASSERT_FALSE (tw_arm (&tw, NULL, 10));
+  TEST_ASSERT_FALSE (tw_cancel (NULL, &probes[0].timer));
+  TEST_ASSERT_FALSE (tw_is_armed (NULL));
+  TEST_ASSERT_EQUAL (0U, tw_advance (NULL, 10));
+
+  for (unsigned i = 0; i < OVERFLOW_CAPACITY; i++) {
+
+    _arm (&probes[i], 5 * TW_SPAN);
+
+  }
+
+  TEST_ASSERT_FALSE (tw_arm (&tw, &probes[OVERFLOW_CAPACITY].timer, 5 * TW_SPAN));
+  TEST_ASSERT_FALSE (tw_arm (&tw, &probes[OVERFLOW_CAPACITY].timer, (TW_MAX_EPOCHS + 1ULL) * TW_SPAN));
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,120 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief External sort command line tool
+ **
+ ** Sorts the lines of a file that does not need to fit in memory (see external_sort.h) and
+ ** prints the phase times and throughput to stderr.
+ **
+ ** Usage: esort.elf [-m megabytes] [-t temp_dir] input output
+ **
+ ** \addtogroup tools module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "external_sort.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define MEGABYTE (1024U * 1024U)
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void _usage(const char* name) {
+
+  fprintf(stderr, "Uso: %s [-m megabytes] [-t directorio_temporal] entrada salida\n", name);
+
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char** argv) {
+
+  es_config_t config = { ES_DEFAULT_MEMORY, ES_DEFAULT_TEMP_DIR };
+  es_stats_t stats;
+  int option = 0;
+  double seconds = 0.0;
+
+  while (-1 != (option = getopt(argc, argv, "m:t:"))) {
+
+    if ('m' == option) {
+
+      config.memory_limit = (size_t)strtoull(optarg, NULL, 0) * MEGABYTE;
+
+    } else if ('t' == option) {
+
+      config.temp_dir = optarg;
+
+    } else {
+
+      _usage(argv[0]);
+      return EXIT_FAILURE;
+
+    }
+
+  }
+
+  if (argc - optind != 2) {
+
+    _usage(argv[0]);
+    return EXIT_FAILURE;
+
+  }
+
+  if (!es_sort_file(argv[optind], argv[optind + 1], &config, &stats)) {
+
+    fprintf(stderr, "No se pudo ordenar %s\n", argv[optind]);
+    return EXIT_FAILURE;
+
+  }
+
+  seconds = (double)(stats.run_ns + stats.merge_ns) / 1e9;
+
+  fprintf(stderr, "%zu registros, %zu bytes, %zu corridas\n", stats.records, stats.bytes, stats.runs);
+  fprintf(stderr, "corridas %.3f s, mezcla %.3f s (%.2f comparaciones por registro)\n",
+          (double)stats.run_ns / 1e9, (double)stats.merge_ns / 1e9,
+          (stats.records > 0) ? (double)stats.merge_comparisons / (double)stats.records : 0.0);
+  fprintf(stderr, "%.1f MB/s\n", (seconds > 0.0) ? (double)stats.bytes / seconds / 1e6 : 0.0);
+
+  return EXIT_SUCCESS;
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,547 @@
+/************************************************************************************************
+Copyright (c) <2025>, <copyright holders>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Priority queue trace replay tool
+ **
+ ** Re-executes a trace recorded with pq_trace (see pq_trace.h) against one of the queue
+ ** backends and reports:
+ ** - Throughput: the whole trace replayed several times without per call timers.
+ ** - Latency: one more replay timing every call, with percentiles per operation.
+ ** - Peak memory of the backend: the pools of the array queue, which are sized by capacity,
+ **   or the header and live nodes of the pairing heap.
+ **
+ ** Removals by predicate are replayed by removing as many nodes as the trace shows; the
+ ** pairing heap has no arbitrary removal, so it extracts them instead. Calls that find the
+ ** queue in a state the trace does not explain (an extract on an empty queue because the trace
+ ** started after the queue was filled, for instance) have no effect and are counted.
+ **
+ ** Usage: pq_replay.elf [-b heap|pairing] [-r repetitions] trace
+ **
+ ** \addtogroup tools module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "pairing_heap.h"
+#include "pq_trace.h"
+#include "priority_queue.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define DEFAULT_REPETITIONS   5
+#define OPERATIONS            (PQ_TRACE_MERGE + 1)
+
+/* === Private data type declarations ========================================================== */
+
+typedef struct {
+
+  pq_type_t type;
+  size_t capacity;           // Largest of the trace, so every re-creation fits
+  void* pool;                // Array queue
+  priority_queue_t* pq;
+  pairing_heap_t heap;
+  bool allocated;            // Its memory is already accounted
+
+} replay_queue_t;
+
+typedef struct {
+
+  replay_queue_t queues[PQ_TRACE_MAX_QUEUES];
+  size_t queue_count;
+  ph_node_t* nodes;          // Pairing heap nodes, shared by every queue
+  ph_node_t** free_nodes;
+  size_t free_count;
+  size_t bytes;
+  size_t peak_bytes;
+  size_t ignored;            // Calls without effect
+
+} replay_t;
+
+typedef struct {
+
+  const char* name;
+  void (*create)(replay_t* r, replay_queue_t* q);
+  bool (*insert)(replay_t* r, replay_queue_t* q, uint16_t priority);
+  bool (*peek)(replay_queue_t* q);
+  bool (*extract)(replay_t* r, replay_queue_t* q);
+  size_t (*size)(replay_queue_t* q);
+  void (*remove)(replay_t* r, replay_queue_t* q, size_t count);
+  bool (*merge)(replay_t* r, replay_queue_t* dst, replay_queue_t* src);
+
+} backend_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static uint8_t _payload;
+
+static const char* const _operation_names[OPERATIONS] = {
+  "", "create", "insert", "peek", "extract", "remove", "merge",
+};
+
+/* === Private function implementation ========================================================= */
+
+static uint64_t _now_ns(void) {
+
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+
+}
+
+static void _account(replay_t* r, size_t added, size_t removed) {
+
+  r->bytes = r->bytes + added - removed;
+  r->peak_bytes = (r->bytes > r->peak_bytes) ? r->bytes : r->peak_bytes;
+
+}
+
+/* --- Array queue (priority_queue_t) ---------------------------------------------------------- */
+
+static bool _remove_first(const pq_node_t* node, void* ctx) {
+
+  size_t* remaining = (size_t*)ctx;
+  bool selected = (*remaining > 0);
+
+  (void)node;
+  *remaining -= selected;
+  return selected;
+
+}
+
+static void _heap_create(replay_t* r, replay_queue_t* q) {
+
+  if (!q->allocated) {
+    _account(r, PQ_MEMORY_SIZE(q->capacity), 0); // The pool is allocated once per queue
+    q->allocated = true;
+  }
+
+  q->pq = pq_create(q->pool, q->capacity, q->type);
+
+}
+
+static bool _heap_insert(replay_t* r, replay_queue_t* q, uint16_t priority) {
+
+  (void)r;
+  return pq_insert(q->pq, &_payload, priority);
+
+}
+
+static bool _heap_peek(replay_queue_t* q) {
+
+  return NULL != pq_peek(q->pq);
+
+}
+
+static bool _heap_extract(replay_t* r, replay_queue_t* q) {
+
+  (void)r;
+  return NULL != pq_extract(q->pq);
+
+}
+
+static size_t _heap_size(replay_queue_t* q) {
+
+  return pq_size(q->pq);
+
+}
+
+static void _heap_remove(replay_t* r, replay_queue_t* q, size_t count) {
+
+  (void)r;
+  pq_remove_if(q->pq, _remove_first, &count);
+
+}
+
+static bool _heap_merge(replay_t* r, replay_queue_t* dst, replay_queue_t* src) {
+
+  (void)r;
+  return pq_merge(dst->pq, src->pq);
+
+}
+
+/* --- Pairing heap ---------------------------------------------------------------------------- */
+
+static bool _pairing_extract(replay_t* r, replay_queue_t* q) {
+
+  ph_node_t* node = ph_extract(&q->heap);
+
+  if (NULL != node) {
+    r->free_nodes[r->free_count++] = node;
+    _account(r, 0, sizeof(ph_node_t));
+  }
+
+  return NULL != node;
+
+}
+
+static void _pairing_create(replay_t* r, replay_queue_t* q) {
+
+  while (_pairing_extract(r, q)) {
+    // Nodes left from the previous life of the queue go back to the pool
+  }
+
+  if (!q->allocated) {
+    _account(r, sizeof(pairing_heap_t), 0);
+    q->allocated = true;
+  }
+
+  ph_init(&q->heap, q->type);
+
+}
+
+static bool _pairing_insert(replay_t* r, replay_queue_t* q, uint16_t priority) {
+
+  bool successful = (r->free_count > 0 && ph_size(&q->heap) < q->capacity);
+
+  if (successful) {
+    ph_insert(&q->heap, r->free_nodes[--r->free_count], &_payload, priority);
+    _account(r, sizeof(ph_node_t), 0);
+  }
+
+  return successful;
+
+}
+
+static bool _pairing_peek(replay_queue_t* q) {
+
+  return NULL != ph_peek(&q->heap);
+
+}
+
+static size_t _pairing_size(replay_queue_t* q) {
+
+  return ph_size(&q->heap);
+
+}
+
+static void _pairing_remove(replay_t* r, replay_queue_t* q, size_t count) {
+
+  for (size_t i = 0; i < count; i++) {
+    _pairing_extract(r, q);
+  }
+
+}
+
+static bool _pairing_merge(replay_t* r, replay_queue_t* dst, replay_queue_t* src) {
+
+  (void)r;
+  return ph_merge(&dst->heap, &src->heap);
+
+}
+
+static const backend_t _backends[] = {
+  { "heap", _heap_create, _heap_insert, _heap_peek, _heap_extract, _heap_size, _heap_remove,
+    _heap_merge },
+  { "pairing", _pairing_create, _pairing_insert, _pairing_peek, _pairing_extract, _pairing_size,
+    _pairing_remove, _pairing_merge },
+};
+
+/* --- Replay ---------------------------------------------------------------------------------- */
+
+// Sizes every queue for the largest capacity (or size) the trace shows
+static bool _prepare(replay_t* r, const pq_trace_file_t* trace, size_t* counts) {
+
+  size_t total = 0;
+  bool successful = true;
+
+  memset(r, 0, sizeof(*r));
+
+  for (size_t i = 0; i < trace->count; i++) {
+
+    const pq_trace_record_t* record = &trace->records[i];
+    replay_queue_t* q = &r->queues[record->queue];
+
+    if (record->queue >= r->queue_count) {
+      r->queue_count = (size_t)record->queue + 1;
+    }
+
+    if (PQ_TRACE_CREATE == record->op) {
+      q->type = (pq_type_t)record->value;
+    }
+
+    if (record->size > q->capacity) {
+      q->capacity = record->size;
+    }
+
+    counts[(record->op < OPERATIONS) ? record->op : 0]++;
+
+  }
+
+  for (size_t i = 0; successful && i < r->queue_count; i++) {
+
+    replay_queue_t* q = &r->queues[i];
+
+    q->type = (PQ_UNKNOWN_PRIORITY_QUEUE == q->type) ? PQ_MIN_PRIORITY_QUEUE : q->type;
+    q->capacity = (0 == q->capacity) ? 1 : q->capacity; // A queue whose CREATE was overwritten
+    q->pool = malloc(PQ_MEMORY_SIZE(q->capacity));
+    total += q->capacity;
+    successful = (NULL != q->pool);
+
+  }
+
+  r->nodes = successful ? malloc((total + 1) * sizeof(ph_node_t)) : NULL;
+  r->free_nodes = successful ? malloc((total + 1) * sizeof(ph_node_t*)) : NULL;
+
+  return successful && NULL != r->nodes && NULL != r->free_nodes;
+
+}
+
+static void _reset(replay_t* r, const backend_t* backend, size_t node_count) {
+
+  for (size_t i = 0; i < r->queue_count; i++) {
+    backend->create(r, &r->queues[i]);
+  }
+
+  // Every queue is empty again: all the pairing nodes are free
+  r->free_count = 0;
+  for (size_t i = 0; i < node_count; i++) {
+    r->free_nodes[r->free_count++] = &r->nodes[i];
+  }
+
+  r->ignored = 0;
+
+}
+
+static bool _replay_one(replay_t* r, const backend_t* backend, const pq_trace_record_t* record) {
+
+  replay_queue_t* q = &r->queues[record->queue];
+  bool done = true;
+
+  switch (record->op) {
+
+    case PQ_TRACE_CREATE:
+      backend->create(r, q);
+      break;
+
+    case PQ_TRACE_INSERT:
+      done = backend->insert(r, q, record->value);
+      break;
+
+    case PQ_TRACE_PEEK:
+      done = backend->peek(q) || 0 == record->size;
+      break;
+
+    case PQ_TRACE_EXTRACT:
+      done = backend->extract(r, q);
+      break;
+
+    case PQ_TRACE_REMOVE:
+      done = backend->size(q) >= record->size;
+      if (done) {
+        backend->remove(r, q, backend->size(q) - record->size);
+      }
+      break;
+
+    case PQ_TRACE_MERGE:
+      done = record->value < r->queue_count && backend->merge(r, q, &r->queues[record->value]);
+      break;
+
+    default:
+      done = false;
+      break;
+
+  }
+
+  return done;
+
+}
+
+static int _compare_ns(const void* a, const void* b) {
+
+  uint64_t x = *(const uint64_t*)a;
+  uint64_t y = *(const uint64_t*)b;
+  return (x > y) - (x < y);
+
+}
+
+static void _report_latency(const char* name, uint64_t* samples, size_t count) {
+
+  uint64_t total = 0;
+
+  if (count > 0) {
+
+    for (size_t i = 0; i < count; i++) {
+      total += samples[i];
+    }
+
+    qsort(samples, count, sizeof(uint64_t), _compare_ns);
+
+    printf("%-9s %10zu %8.1f %8llu %8llu %8llu %8llu %8llu\n", name, count,
+           (double)total / (double)count, (unsigned long long)samples[count / 2],
+           (unsigned long long)samples[count * 9 / 10], (unsigned long long)samples[count * 99 / 100],
+           (unsigned long long)samples[count * 999 / 1000], (unsigned long long)samples[count - 1]);
+
+  }
+
+}
+
+static void _usage(const char* name) {
+
+  fprintf(stderr, "Uso: %s [-b heap|pairing] [-r repeticiones] traza\n", name);
+
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char** argv) {
+
+  const backend_t* backend = &_backends[0];
+  int repetitions = DEFAULT_REPETITIONS;
+  pq_trace_file_t trace;
+  replay_t* r = malloc(sizeof(replay_t));
+  size_t counts[OPERATIONS] = { 0 };
+  uint64_t* samples[OPERATIONS] = { NULL };
+  size_t sampled[OPERATIONS] = { 0 };
+  size_t node_count = 0;
+  uint64_t start = 0;
+  double seconds = 0.0;
+  int option = 0;
+
+  while (-1 != (option = getopt(argc, argv, "b:r:"))) {
+
+    if ('b' == option && 0 == strcmp(optarg, "pairing")) {
+
+      backend = &_backends[1];
+
+    } else if ('b' == option && 0 == strcmp(optarg, "heap")) {
+
+      backend = &_backends[0];
+
+    } else if ('r' == option && atoi(optarg) > 0) {
+
+      repetitions = atoi(optarg);
+
+    } else {
+
+      _usage(argv[0]);
+      return EXIT_FAILURE;
+
+    }
+
+  }
+
+  if (argc - optind != 1 || NULL == r) {
+
+    _usage(argv[0]);
+    return EXIT_FAILURE;
+
+  }
+
+  if (!pq_trace_open(&trace, argv[optind])) {
+
+    fprintf(stderr, "No se pudo abrir la traza %s\n", argv[optind]);
+    return EXIT_FAILURE;
+
+  }
+
+  if (!_prepare(r, &trace, counts)) {
+
+    fprintf(stderr, "Sin memoria para las colas de la traza\n");
+    return EXIT_FAILURE;
+
+  }
+
+  for (size_t i = 0; i < r->queue_count; i++) {
+    node_count += r->queues[i].capacity;
+  }
+
+  for (size_t op = 0; op < OPERATIONS; op++) {
+    samples[op] = malloc((counts[op] + 1) * sizeof(uint64_t));
+  }
+
+  printf("traza: %zu registros (%llu perdidos), %zu colas, backend %s\n", trace.count,
+         (unsigned long long)trace.dropped, r->queue_count, backend->name);
+
+  // Throughput, without timers between calls
+  start = _now_ns();
+  for (int i = 0; i < repetitions; i++) {
+
+    _reset(r, backend, node_count);
+
+    for (size_t j = 0; j < trace.count; j++) {
+      r->ignored += !_replay_one(r, backend, &trace.records[j]);
+    }
+
+  }
+  seconds = (double)(_now_ns() - start) / 1e9;
+
+  printf("rendimiento: %.2f Mops/s (%d repeticiones, incluye reiniciar las colas)\n",
+         (double)trace.count * repetitions / seconds / 1e6, repetitions);
+
+  // Latency of every call; the peak memory is measured on this pass
+  _reset(r, backend, node_count);
+  r->peak_bytes = r->bytes;
+
+  for (size_t j = 0; j < trace.count; j++) {
+
+    const pq_trace_record_t* record = &trace.records[j];
+    size_t op = (record->op < OPERATIONS) ? record->op : 0;
+    uint64_t begin = _now_ns();
+
+    r->ignored += !_replay_one(r, backend, record);
+    samples[op][sampled[op]++] = _now_ns() - begin;
+
+  }
+
+  printf("%-9s %10s %8s %8s %8s %8s %8s %8s (ns)\n", "operacion", "cantidad", "media", "p50",
+         "p90", "p99", "p99.9", "max");
+
+  for (size_t op = PQ_TRACE_CREATE; op < OPERATIONS; op++) {
+    _report_latency(_operation_names[op], samples[op], sampled[op]);
+  }
+
+  printf("memoria pico: %zu bytes\n", r->peak_bytes);
+  printf("llamadas sin efecto: %zu\n", r->ignored);
+
+  for (size_t op = 0; op < OPERATIONS; op++) {
+    free(samples[op]);
+  }
+
+  for (size_t i = 0; i < r->queue_count; i++) {
+    free(r->queues[i].pool);
+  }
+
+  free(r->free_nodes);
+  free(r->nodes);
+  free(r);
+  pq_trace_close(&trace);
+
+  return EXIT_SUCCESS;
+
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,85 @@
+# Cota total de pila de cada funcion a partir del grafo de llamadas de gcc -fcallgraph-info=su
+#
+# Suma el marco de cada funcion al del camino de llamadas mas costoso que sale de ella. Las
+# funciones que no estan en el grafo (qsort, las llamadas indirectas a los predicados del
+# usuario) no se pueden acotar: se informan aparte y no se suman. Falla si hay recursion, un
+# marco dinamico sin cota o una funcion publica (sin _ inicial) por encima de LIMIT bytes.
+#
+# Uso: awk -v LIMIT=bytes -f stack_bound.awk fichero.ci
+
+function short_name(title) {
+  sub(/^.*:/, "", title)
+  return title
+}
+
+function total(node,  i, callee, worst, bound) {
+  if (node in memo) {
+    return memo[node]
+  }
+  if (!(node in frame)) {
+    excluded[node] = 1
+    return 0
+  }
+  if (node in visiting) {
+    printf "Recursion en %s: la pila no tiene cota\n", short_name(node)
+    failed = 1
+    return 0
+  }
+  visiting[node] = 1
+  worst = 0
+  for (i = 1; i <= calls[node]; i++) {
+    callee = callee_of[node, i]
+    bound = total(callee)
+    if (bound > worst) {
+      worst = bound
+    }
+  }
+  delete visiting[node]
+  memo[node] = frame[node] + worst
+  return memo[node]
+}
+
+/^node:/ {
+  match($0, /title: "[^"]*"/)
+  title = substr($0, RSTART + 8, RLENGTH - 9)
+  order[++nodes] = title
+  if (match($0, /[0-9]+ bytes \([a-z,]*\)/)) {
+    usage = substr($0, RSTART, RLENGTH)
+    frame[title] = usage + 0
+    if (usage ~ /dynamic\)/) {
+      printf "%s usa pila dinamica sin cota\n", short_name(title)
+      failed = 1
+    }
+  }
+}
+
+/^edge:/ {
+  match($0, /sourcename: "[^"]*"/)
+  source = substr($0, RSTART + 13, RLENGTH - 14)
+  match($0, /targetname: "[^"]*"/)
+  target = substr($0, RSTART + 13, RLENGTH - 14)
+  callee_of[source, ++calls[source]] = target
+}
+
+END {
+  for (i = 1; i <= nodes; i++) {
+    node = order[i]
+    name = short_name(node)
+    if ((node in frame) && name !~ /^_/) {
+      bound = total(node)
+      printf "%-24s %5d bytes\n", name, bound
+      if (bound > worst) {
+        worst = bound
+      }
+    }
+  }
+  for (node in excluded) {
+    printf "Sin contar: %s\n", (node == "__indirect_call") ? "llamadas indirectas" : node
+  }
+  printf "Cota total: %d bytes (limite %d)\n", worst, LIMIT
+  if (worst > LIMIT) {
+    printf "La cota total supera el limite de %d bytes\n", LIMIT
+    failed = 1
+  }
+  exit failed
+}